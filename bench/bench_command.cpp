@@ -0,0 +1,103 @@
+/**
+ * @file bench_command.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "benchmark.h"
+#include "command.h"
+
+/**
+ * @brief A command line of every command family, parsed round robin.
+ */
+static const char *lines[] = {
+    "read D1",
+    "write D2 1",
+    "config pin D5 output",
+    "config show",
+    "stats reset",
+    "metrics",
+    "log wifi debug",
+    "bogus command",
+};
+
+static void BM_SplitCommand( bench::State &state ){
+    std::vector<String> command;
+    String line = "config pin D5 output";
+    for( auto _: state ){
+        command.clear();
+        splitCommand( line, command );
+        bench::doNotOptimize( command.data() );
+    }
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_SplitCommand );
+
+static void BM_ParseCommand( bench::State &state ){
+    std::vector<String> names;
+    for( const char *line: lines ) names.push_back( String( line ).substring( 0, String( line ).indexOf( ' ' ) ) );
+    size_t index = 0;
+    for( auto _: state ){
+        bench::doNotOptimize( parseCommand( names[index] ) );
+        if( ++index == names.size() ) index = 0;
+    }
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_ParseCommand );
+
+static void BM_ParsePinCommand( bench::State &state ){
+    const String pins[] = { "A0", "D0", "D1", "D4", "D8", "D9" };
+    size_t index = 0;
+    for( auto _: state ){
+        bench::doNotOptimize( parsePinCommand( pins[index] ) );
+        if( ++index == sizeof( pins ) / sizeof( pins[0] ) ) index = 0;
+    }
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_ParsePinCommand );
+
+static void BM_ParseConfigCommand( bench::State &state ){
+    const String names[] = { "show", "pin", "ssid", "tcp-port", "save-delay", "fast-boot" };
+    size_t index = 0;
+    for( auto _: state ){
+        bench::doNotOptimize( parseConfigCommand( names[index] ) );
+        if( ++index == sizeof( names ) / sizeof( names[0] ) ) index = 0;
+    }
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_ParseConfigCommand );
+
+static void BM_SplitAndParseLine( bench::State &state ){
+    std::vector<String> command;
+    size_t index = 0;
+    for( auto _: state ){
+        command.clear();
+        splitCommand( lines[index], command );
+        bench::doNotOptimize( parseCommand( command[0] ) );
+        if( ++index == sizeof( lines ) / sizeof( lines[0] ) ) index = 0;
+    }
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_SplitAndParseLine );
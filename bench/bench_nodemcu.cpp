@@ -0,0 +1,213 @@
+/**
+ * @file bench_nodemcu.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "benchmark.h"
+#include "nodemcu.h"
+#include "logger.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/**
+ * @brief Server ports of the benchmark board are moved by this offset, 333 becomes 20333.
+ */
+#define BENCH_PORT_OFFSET 20000
+
+/**
+ * @brief The board all NodeMCU benchmarks run on, started once with D1 as input and D2 as output.
+ */
+static NodeMCU &node(){
+    static hal::Board board;
+    static NodeMCU *instance = nullptr;
+    hal::select( &board );
+    if( !instance ) {
+        board.PortOffset = BENCH_PORT_OFFSET;
+        instance = new NodeMCU();
+        instance->run();
+        NullPrint out;
+        instance->execute_command( { "config", "pin", "D1", "input" }, PROTOCOL_SERIAL, out );
+        instance->execute_command( { "config", "pin", "D2", "output" }, PROTOCOL_SERIAL, out );
+        instance->execute_command( { "log", "all", "warn" }, PROTOCOL_SERIAL, out );
+    }
+    board.SerialOut.clear();
+    return *instance;
+}
+
+static void BM_DispatchRead( bench::State &state ){
+    NodeMCU &nodeMCU = node();
+    NullPrint out;
+    std::vector<String> command = { "read", "D1" };
+    for( auto _: state ) bench::doNotOptimize( nodeMCU.execute_command( command, PROTOCOL_TCP, out ) );
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_DispatchRead );
+
+static void BM_DispatchWrite( bench::State &state ){
+    NodeMCU &nodeMCU = node();
+    NullPrint out;
+    std::vector<String> high = { "write", "D2", "1" };
+    std::vector<String> low = { "write", "D2", "0" };
+    bool level = false;
+    for( auto _: state ){
+        level = !level;
+        bench::doNotOptimize( nodeMCU.execute_command( level ? high : low, PROTOCOL_TCP, out ) );
+    }
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_DispatchWrite );
+
+static void BM_DispatchMetrics( bench::State &state ){
+    NodeMCU &nodeMCU = node();
+    NullPrint out;
+    std::vector<String> command = { "metrics" };
+    for( auto _: state ) bench::doNotOptimize( nodeMCU.execute_command( command, PROTOCOL_TCP, out ) );
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_DispatchMetrics );
+
+static void BM_DispatchUnknown( bench::State &state ){
+    NodeMCU &nodeMCU = node();
+    NullPrint out;
+    std::vector<String> command = { "bogus" };
+    for( auto _: state ) bench::doNotOptimize( nodeMCU.execute_command( command, PROTOCOL_TCP, out ) );
+    hal::board().SerialOut.clear();
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_DispatchUnknown );
+
+/**
+ * @brief A configuration control with a stored configuration file, on its own board.
+ */
+static ConfigControl &config(){
+    static hal::Board board;
+    static ConfigControl *instance = nullptr;
+    hal::select( &board );
+    if( !instance ) {
+        board.ManualClock = true;
+        instance = new ConfigControl();
+        instance->loadConfig();
+        instance->markUpdated();
+        hal::advance( CONFIG_SAVE_DELAY_DEFAULT * 1000 );
+        instance->saveConfig();
+    }
+    board.SerialOut.clear();
+    return *instance;
+}
+
+static void BM_ConfigLoad( bench::State &state ){
+    ConfigControl &configControl = config();
+    for( auto _: state ) configControl.loadConfig();
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_ConfigLoad );
+
+static void BM_ConfigSaveUnchanged( bench::State &state ){
+    // The stored file has the same content, the flash write is skipped
+    ConfigControl &configControl = config();
+    for( auto _: state ){
+        configControl.markUpdated();
+        hal::advance( configControl.SaveDelay * 1000 );
+        configControl.saveConfig();
+    }
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_ConfigSaveUnchanged );
+
+static void BM_ConfigSaveChanged( bench::State &state ){
+    ConfigControl &configControl = config();
+    for( auto _: state ){
+        configControl.MaxClients = configControl.MaxClients == 12 ? 13 : 12;
+        configControl.markUpdated();
+        hal::advance( configControl.SaveDelay * 1000 );
+        configControl.saveConfig();
+    }
+    hal::board().SerialOut.clear();
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_ConfigSaveChanged );
+
+static void BM_ConfigShow( bench::State &state ){
+    ConfigControl &configControl = config();
+    NullPrint out;
+    for( auto _: state ) configControl.printConfig( out );
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_ConfigShow );
+
+static void BM_LoopIdle( bench::State &state ){
+    NodeMCU &nodeMCU = node();
+    for( auto _: state ) nodeMCU.run();
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_LoopIdle );
+
+static void BM_LoopSerialCommand( bench::State &state ){
+    NodeMCU &nodeMCU = node();
+    hal::Board &board = hal::board();
+    for( auto _: state ){
+        board.SerialIn += "read D1\n";
+        nodeMCU.run();
+        board.SerialOut.clear();
+    }
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_LoopSerialCommand );
+
+static void BM_LoopTcpCommand( bench::State &state ){
+    NodeMCU &nodeMCU = node();
+
+    // A loopback client on the TCP server of the board, accepted by the first loop iterations
+    int fd = socket( AF_INET, SOCK_STREAM, 0 );
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons( 333 + BENCH_PORT_OFFSET );
+    inet_pton( AF_INET, "127.0.0.1", &address.sin_addr );
+    int flag = 1;
+    setsockopt( fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof( flag ) );
+    if( connect( fd, reinterpret_cast<sockaddr*>( &address ), sizeof( address ) ) < 0 ) {
+        perror( "BM_LoopTcpCommand: connect" );
+        close( fd );
+        return;
+    }
+
+    // Every iteration sends a command and runs the loop until the result line is back
+    char reply[64];
+    for( auto _: state ){
+        send( fd, "read D1\n", 8, 0 );
+        for( ;; ){
+            nodeMCU.run();
+            ssize_t length = recv( fd, reply, sizeof( reply ), MSG_DONTWAIT );
+            if( length > 0 && memchr( reply, '=', length ) ) break;
+        }
+    }
+    close( fd );
+    state.setItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_LoopTcpCommand );
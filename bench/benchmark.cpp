@@ -0,0 +1,172 @@
+/**
+ * @file benchmark.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+
+namespace bench {
+
+/**
+ * @brief A registered benchmark.
+ */
+struct Benchmark {
+    const char *Name;
+    void ( *Function )( State &state );
+};
+
+/**
+ * @brief Return the registered benchmarks, in registration order.
+ */
+static std::vector<Benchmark> &benchmarks(){
+    static std::vector<Benchmark> list;
+    return list;
+}
+
+static uint64_t nowNs(){
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+State::State( uint64_t iterations )
+: m_Iterations( iterations )
+, m_Items( 0 )
+, m_ElapsedNs( 0 )
+, m_Started( 0 )
+{}
+
+State::Iterator State::begin(){
+    resumeTiming();
+    return Iterator{ this, m_Iterations };
+}
+
+bool State::Iterator::operator!=( const Iterator & ) const {
+    if( Remaining ) return true;
+    Owner->pauseTiming();
+    return false;
+}
+
+void State::pauseTiming(){
+    if( m_Started ) m_ElapsedNs += nowNs() - m_Started;
+    m_Started = 0;
+}
+
+void State::resumeTiming(){
+    m_Started = nowNs();
+}
+
+int add( const char *name, void ( *function )( State &state ) ){
+    benchmarks().push_back( { name, function } );
+    return 0;
+}
+
+static void usage(){
+    printf( "usage: benchmark [options] [filter]\n"
+            "  --min-time SECONDS  minimum measuring time per benchmark (0.5)\n"
+            "  --save FILE         write the results as baseline\n"
+            "  --compare FILE      compare with a saved baseline\n"
+            "  --threshold PERCENT slowdown that counts as regression (10)\n" );
+}
+
+/**
+ * @brief Run the benchmarks that match the filter of the command line and print the results.
+ *
+ * @return int process exit code, 1 if a result is slower than the compared baseline
+ */
+int run( int argc, char **argv ){
+    double minTime = 0.5;
+    double threshold = 10;
+    const char *filter = "";
+    const char *save = nullptr;
+    const char *compare = nullptr;
+    for( int i = 1; i < argc; i++ ){
+        bool value = i + 1 < argc;
+        if( !strcmp( argv[i], "--min-time" ) && value ) minTime = atof( argv[++i] );
+        else if( !strcmp( argv[i], "--save" ) && value ) save = argv[++i];
+        else if( !strcmp( argv[i], "--compare" ) && value ) compare = argv[++i];
+        else if( !strcmp( argv[i], "--threshold" ) && value ) threshold = atof( argv[++i] );
+        else if( argv[i][0] == '-' ) {
+            usage();
+            return 2;
+        }
+        else filter = argv[i];
+    }
+
+    // The baseline file has one "name ns" line per benchmark
+    std::map<std::string, double> baseline;
+    if( compare ) {
+        std::ifstream file( compare );
+        std::string name;
+        double ns;
+        while( file >> name >> ns ) baseline[name] = ns;
+    }
+
+    std::FILE *output = save ? fopen( save, "w" ) : nullptr;
+    int regressions = 0;
+    printf( "%-36s %14s %12s %14s\n", "Benchmark", "Time", "Iterations", "Items/s" );
+    for( const Benchmark &benchmark: benchmarks() ){
+        if( !strstr( benchmark.Name, filter ) ) continue;
+
+        // Grow the amount of iterations until a run takes long enough to be measured reliably
+        uint64_t iterations = 1;
+        for( ;; ){
+            State state( iterations );
+            benchmark.Function( state );
+            double seconds = state.elapsedNs() / 1e9;
+            if( seconds >= minTime || iterations >= 1000000000ULL ) {
+                double ns = static_cast<double>( state.elapsedNs() ) / iterations;
+                printf( "%-36s %11.1f ns %12llu", benchmark.Name, ns, static_cast<unsigned long long>( iterations ) );
+                if( state.itemsProcessed() ) printf( " %12.0f/s", state.itemsProcessed() / seconds );
+                if( baseline.count( benchmark.Name ) ) {
+                    double change = ( ns / baseline[benchmark.Name] - 1 ) * 100;
+                    printf( "  %+.1f%%%s", change, change > threshold ? " REGRESSION" : "" );
+                    if( change > threshold ) regressions++;
+                }
+                printf( "\n" );
+                if( output ) fprintf( output, "%s %.1f\n", benchmark.Name, ns );
+                break;
+            }
+            double factor = seconds > 0 ? minTime * 1.4 / seconds : 10;
+            iterations = static_cast<uint64_t>( iterations * std::min( std::max( factor, 2.0 ), 10.0 ) );
+        }
+    }
+    if( output ) fclose( output );
+    return regressions ? 1 : 0;
+}
+
+}
+
+int main( int argc, char **argv ){
+    return bench::run( argc, argv );
+}
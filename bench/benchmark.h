@@ -0,0 +1,112 @@
+/**
+ * @file benchmark.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <cstdint>
+#include <string>
+
+namespace bench {
+
+/**
+ * @brief The state of a running benchmark, iterate it to run the measured code:
+ *
+ *     static void BM_Something( bench::State &state ){
+ *         for( auto _: state ) something();
+ *     }
+ *     BENCHMARK( BM_Something );
+ */
+class State {
+public:
+    State( uint64_t iterations );
+
+    /**
+     * @brief The value of the loop variable, marked unused so it needs no name.
+     */
+    struct __attribute__( ( unused ) ) Value {};
+
+    /**
+     * @brief The iterator of the measured loop, starts the timer on begin and stops it at the end.
+     */
+    struct Iterator {
+        State *Owner;
+        uint64_t Remaining;
+        bool operator!=( const Iterator & ) const;
+        void operator++() { Remaining--; }
+        Value operator*() const { return Value(); }
+    };
+    Iterator begin();
+    Iterator end() { return Iterator{ this, 0 }; }
+
+    /**
+     * @brief Leave the setup code of an iteration out of the measurement.
+     */
+    void pauseTiming();
+    void resumeTiming();
+
+    /**
+     * @brief Report items per second, for example commands or bytes.
+     */
+    void setItemsProcessed( uint64_t items ) { m_Items = items; }
+
+    uint64_t iterations() const { return m_Iterations; }
+    uint64_t elapsedNs() const { return m_ElapsedNs; }
+    uint64_t itemsProcessed() const { return m_Items; }
+
+private:
+    uint64_t m_Iterations;
+    uint64_t m_Items;
+    uint64_t m_ElapsedNs;
+    uint64_t m_Started;
+};
+
+/**
+ * @brief Register a benchmark, used by the BENCHMARK macro.
+ */
+int add( const char *name, void ( *function )( State &state ) );
+
+/**
+ * @brief Keep the compiler from optimizing a value away.
+ */
+template<typename T> inline void doNotOptimize( const T &value ){
+    asm volatile( "" : : "r,m"( value ) : "memory" );
+}
+
+/**
+ * @brief Run the benchmarks that match the filter of the command line and print the results.
+ *
+ * @return int process exit code, 1 if a result is slower than the compared baseline
+ */
+int run( int argc, char **argv );
+
+}
+
+#define BENCHMARK( function ) static int function##Registered = bench::add( #function, function )
+
+#endif
@@ -0,0 +1,244 @@
+/**
+ * @file client.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef CLIENT_H
+#define CLIENT_H
+
+#include "transport.h"
+#include <future>
+#include <atomic>
+#include <map>
+#include <memory>
+
+namespace nodemcu {
+
+/**
+ * @brief Called with the new value of a subscribed pin.
+ */
+typedef std::function<void( const std::string &pin, int value )> PinCallback;
+
+/**
+ * @brief The Client class is the typed API of one board on top of a transport.
+ * Every command returns a future or calls a callback, so any amount of commands can be
+ * in flight at the same time. The client runs its own event loop thread unless a shared
+ * loop is given, one shared loop can serve many clients.
+ */
+class Client {
+public:
+    /**
+     * @brief Create a client that talks to the TCP server of the board.
+     *
+     * @param host the host name or IP address of the board
+     * @param port the TCP port of the board
+     * @param options the connection settings
+     * @param loop a shared event loop, nullptr to start a loop for this client
+     */
+    static std::unique_ptr<Client> tcp( const std::string &host, uint16_t port = 333, const Options &options = Options(), EventLoop *loop = nullptr );
+
+    /**
+     * @brief Create a client that talks to the HTTP server of the board.
+     *
+     * @param host the host name or IP address of the board
+     * @param port the HTTP port of the board
+     * @param options the connection settings
+     * @param loop a shared event loop, nullptr to start a loop for this client
+     */
+    static std::unique_ptr<Client> http( const std::string &host, uint16_t port = 80, const Options &options = Options(), EventLoop *loop = nullptr );
+
+    /**
+     * @brief Create a client that talks to the board over the serial port.
+     *
+     * @param device the serial device, for example /dev/ttyUSB0
+     * @param baudRate the baud rate of the text mode of the board
+     * @param binaryBaud the baud rate of the binary mode, 0 stays in text mode
+     * @param options the connection settings
+     * @param loop a shared event loop, nullptr to start a loop for this client
+     */
+    static std::unique_ptr<Client> serial( const std::string &device, uint32_t baudRate = 115200, uint32_t binaryBaud = 0, const Options &options = Options(), EventLoop *loop = nullptr );
+
+    /**
+     * @brief Construct a new Client object
+     *
+     * @param loop a shared event loop, nullptr to start a loop for this client
+     * @param create creates the transport on the loop thread
+     */
+    Client( EventLoop *loop, std::function<Transport*( EventLoop *loop )> create );
+
+    /**
+     * @brief Destroy the Client object, pending commands fail with RESULT_DISCONNECTED.
+     */
+    ~Client();
+
+    /**
+     * @brief Open the connection now instead of with the first command.
+     */
+    void connect();
+
+    /**
+     * @brief Send a command line, the callback is called on the loop thread.
+     */
+    void command( const std::string &line, Callback done );
+
+    /**
+     * @brief Send a command line.
+     */
+    std::future<Reply> command( const std::string &line );
+
+    /**
+     * @brief Read a pin, the value is returned by Reply::value().
+     *
+     * @param pin the pin name, A0 or D0 to D8
+     */
+    std::future<Reply> read( const std::string &pin );
+
+    /**
+     * @brief Write a value to an output pin.
+     *
+     * @param pin the pin name, D0 to D8
+     * @param value the value to write
+     */
+    std::future<Reply> write( const std::string &pin, int value );
+
+    /**
+     * @brief Write several output pins at once, the board sets all of them or none.
+     *
+     * @param values the pin names and their values, 0 or 1
+     */
+    std::future<Reply> write( const std::vector<std::pair<std::string, int>> &values );
+
+    /**
+     * @brief Change a setting of the board, for example configure( "timeout", "60000" ).
+     */
+    std::future<Reply> configure( const std::string &setting, const std::string &value );
+
+    /**
+     * @brief Set the mode of a pin.
+     *
+     * @param pin the pin name
+     * @param mode input or output
+     */
+    std::future<Reply> configurePin( const std::string &pin, const std::string &mode );
+
+    /**
+     * @brief Send several command lines at once, the replies are in the same order.
+     */
+    std::future<std::vector<Reply>> batch( const std::vector<std::string> &lines );
+
+    /**
+     * @brief Read a pin periodically and call the callback when its value changes.
+     * The board has no push messages, so the subscription polls with a read command.
+     *
+     * @param pin the pin name
+     * @param intervalMs the poll interval
+     * @param changed called on the loop thread with the first value and every change
+     * @return uint32_t the ID of the subscription
+     */
+    uint32_t subscribe( const std::string &pin, uint32_t intervalMs, PinCallback changed );
+
+    /**
+     * @brief Stop a subscription.
+     */
+    void unsubscribe( uint32_t id );
+
+    /**
+     * @brief Set the callback for the log lines of the board (serial only).
+     */
+    void onLog( std::function<void( const std::string &line )> log );
+
+    /**
+     * @brief Return a copy of the counters of the transport.
+     */
+    TransportStats stats();
+
+    /**
+     * @brief Return the amount of commands that are queued or waiting for a reply.
+     */
+    size_t pending();
+
+    /**
+     * @brief Return true if the connection is up.
+     */
+    bool connected();
+
+    /**
+     * @brief Return the board address.
+     */
+    std::string address();
+
+private:
+    /**
+     * @brief A pin that is polled.
+     */
+    struct Subscription {
+        std::string Pin;
+        PinCallback Changed;
+        uint32_t Timer;
+        bool Reading;
+        bool Known;
+        int Value;
+    };
+
+    /**
+     * @brief Run a task on the loop thread and wait for it.
+     */
+    void runInLoop( std::function<void()> task );
+
+    /**
+     * @brief Poll a subscribed pin.
+     */
+    void poll( uint32_t id );
+
+    /**
+     * @brief The loop created by this client, if no shared loop was given.
+     */
+    std::unique_ptr<EventLoop> m_OwnLoop;
+
+    /**
+     * @brief The event loop that handles the transport.
+     */
+    EventLoop *m_Loop;
+
+    /**
+     * @brief The transport, only used on the loop thread.
+     */
+    Transport *m_Transport;
+
+    /**
+     * @brief The subscriptions by ID, only used on the loop thread.
+     */
+    std::map<uint32_t, Subscription> m_Subscriptions;
+
+    /**
+     * @brief The ID of the next subscription.
+     */
+    std::atomic<uint32_t> m_NextSubscription;
+};
+
+}
+
+#endif
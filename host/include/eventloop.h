@@ -0,0 +1,210 @@
+/**
+ * @file eventloop.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef EVENTLOOP_H
+#define EVENTLOOP_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nodemcu {
+
+/**
+ * @brief Return a monotonic time stamp in milliseconds.
+ */
+uint64_t nowMs();
+
+/**
+ * @brief Return a monotonic time stamp in microseconds.
+ */
+uint64_t nowUs();
+
+/**
+ * @brief The EventLoop class waits for socket events with epoll and runs timers and posted tasks.
+ * Every connection is handled on the thread of its loop, so one loop can serve many boards.
+ * The loop either runs in its own thread (start) or is driven by the caller (runOnce).
+ */
+class EventLoop {
+public:
+    /**
+     * @brief Handler called with the epoll events of a watched file descriptor.
+     */
+    typedef std::function<void( uint32_t events )> Handler;
+
+    /**
+     * @brief Construct a new Event Loop object
+     */
+    EventLoop();
+
+    /**
+     * @brief Destroy the Event Loop object, stops the thread if it is running.
+     */
+    ~EventLoop();
+
+    /**
+     * @brief Run the loop in a new thread.
+     */
+    void start();
+
+    /**
+     * @brief Stop the thread of the loop and wait for it.
+     */
+    void stop();
+
+    /**
+     * @brief Wait for events and handle them once.
+     *
+     * @param timeoutMs maximum time to wait when there is no timer due earlier
+     */
+    void runOnce( int timeoutMs );
+
+    /**
+     * @brief Run a task on the loop thread, may be called from any thread.
+     *
+     * @param task the task to run
+     */
+    void post( std::function<void()> task );
+
+    /**
+     * @brief Return true when called from the thread that runs the loop.
+     */
+    bool inLoop() const;
+
+    /**
+     * @brief Watch a file descriptor, only call on the loop thread.
+     *
+     * @param fd the file descriptor
+     * @param events the epoll events to wait for
+     * @param handler the handler for the events
+     * @return true if the descriptor is watched
+     */
+    bool watch( int fd, uint32_t events, Handler handler );
+
+    /**
+     * @brief Change the events of a watched file descriptor, only call on the loop thread.
+     */
+    bool modify( int fd, uint32_t events );
+
+    /**
+     * @brief Stop watching a file descriptor, only call on the loop thread.
+     */
+    void unwatch( int fd );
+
+    /**
+     * @brief Run a task after a delay and repeat it when an interval is given, only call on the loop thread.
+     *
+     * @param delayMs the time until the first run
+     * @param intervalMs the repeat interval, 0 runs the task once
+     * @param task the task to run
+     * @return uint32_t the ID of the timer
+     */
+    uint32_t addTimer( uint32_t delayMs, uint32_t intervalMs, std::function<void()> task );
+
+    /**
+     * @brief Cancel a timer, only call on the loop thread.
+     */
+    void cancelTimer( uint32_t id );
+
+private:
+    /**
+     * @brief A timer waiting to run.
+     */
+    struct Timer {
+        uint64_t Due;
+        uint32_t Interval;
+        std::function<void()> Task;
+    };
+
+    /**
+     * @brief Run the posted tasks.
+     */
+    void runPosted();
+
+    /**
+     * @brief Run the timers that are due.
+     */
+    void runTimers();
+
+    /**
+     * @brief The epoll instance.
+     */
+    int m_Epoll;
+
+    /**
+     * @brief The eventfd used to wake the loop for posted tasks.
+     */
+    int m_Wake;
+
+    /**
+     * @brief The handlers of the watched file descriptors.
+     */
+    std::map<int, Handler> m_Handlers;
+
+    /**
+     * @brief The timers ordered by ID.
+     */
+    std::map<uint32_t, Timer> m_Timers;
+
+    /**
+     * @brief The ID of the next timer.
+     */
+    uint32_t m_NextTimer;
+
+    /**
+     * @brief Tasks posted by other threads.
+     */
+    std::vector<std::function<void()>> m_Posted;
+
+    /**
+     * @brief Protects the posted tasks.
+     */
+    std::mutex m_Mutex;
+
+    /**
+     * @brief The thread of the loop when started.
+     */
+    std::thread m_Thread;
+
+    /**
+     * @brief The ID of the thread that runs the loop.
+     */
+    std::thread::id m_LoopThread;
+
+    /**
+     * @brief Flag which is set to false to stop the thread.
+     */
+    volatile bool m_Running;
+};
+
+}
+
+#endif
@@ -0,0 +1,190 @@
+/**
+ * @file fleet.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FLEET_H
+#define FLEET_H
+
+#include "client.h"
+
+namespace nodemcu {
+
+/**
+ * @brief The settings of a fleet.
+ */
+struct FleetOptions {
+    /**
+     * @brief The connection settings of every board.
+     */
+    Options Connection;
+
+    /**
+     * @brief Maximum amount of boards that run commands at the same time, 0 for all.
+     */
+    uint32_t Concurrency = 0;
+
+    /**
+     * @brief How often a command that timed out or lost its connection is sent again.
+     * Commands the board answered with an error code are not retried.
+     */
+    uint32_t Retries = 2;
+
+    /**
+     * @brief Delay (in ms) before a retry.
+     */
+    uint32_t RetryDelayMs = 100;
+};
+
+/**
+ * @brief The outcome of a fleet run on one board.
+ */
+struct BoardResult {
+    /**
+     * @brief The board address, for example "192.168.0.222:333".
+     */
+    std::string Board;
+
+    /**
+     * @brief The replies in the order of the command lines.
+     */
+    std::vector<Reply> Replies;
+
+    /**
+     * @brief Amount of times the board was sent commands, 1 without retries.
+     */
+    uint32_t Attempts = 0;
+
+    /**
+     * @brief Time (in us) from the first command until the last reply of the board, retries included.
+     */
+    uint64_t LatencyUs = 0;
+
+    /**
+     * @brief Return true if every command succeeded.
+     */
+    bool ok() const;
+};
+
+/**
+ * @brief The Fleet class keeps a TCP connection to every board of a fleet on one event loop
+ * and sends the same commands to all boards in parallel, so updating the whole fleet takes
+ * about one round-trip instead of one round-trip per board.
+ */
+class Fleet {
+public:
+    /**
+     * @brief Construct a new Fleet object
+     *
+     * @param options the settings of the fleet
+     */
+    Fleet( const FleetOptions &options = FleetOptions() );
+
+    /**
+     * @brief Destroy the Fleet object, closes all connections.
+     */
+    ~Fleet();
+
+    /**
+     * @brief Add a board, its connection is opened right away and kept open.
+     *
+     * @param host the host name or IP address of the board
+     * @param port the TCP port of the board, ConfigControl::PortTCP
+     */
+    void add( const std::string &host, uint16_t port = 333 );
+
+    /**
+     * @brief Return the amount of boards.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Return the amount of boards with an open connection.
+     */
+    size_t connected();
+
+    /**
+     * @brief Send command lines to every board. The lines of one board are pipelined,
+     * the future has one result per board in the order the boards were added.
+     */
+    std::future<std::vector<BoardResult>> run( const std::vector<std::string> &lines );
+
+    /**
+     * @brief Read pins on every board, a snapshot of the fleet.
+     *
+     * @param pins the pin names, the replies are in the same order
+     */
+    std::future<std::vector<BoardResult>> read( const std::vector<std::string> &pins );
+
+private:
+    /**
+     * @brief The state of one run.
+     */
+    struct Run;
+
+    /**
+     * @brief Send the commands of a board that have no reply yet.
+     */
+    void send( const std::shared_ptr<Run> &run, size_t board );
+
+    /**
+     * @brief Start boards as far as the concurrency allows.
+     */
+    void startBoards( const std::shared_ptr<Run> &run );
+
+    /**
+     * @brief The settings of the fleet.
+     */
+    FleetOptions m_Options;
+
+    /**
+     * @brief The loop that handles the connections of all boards.
+     */
+    EventLoop m_Loop;
+
+    /**
+     * @brief The boards in the order they were added.
+     */
+    std::vector<std::unique_ptr<Client>> m_Boards;
+
+    /**
+     * @brief Set while the fleet is destroyed.
+     */
+    std::atomic<bool> m_Closing;
+};
+
+/**
+ * @brief Format fleet results as a text table: one row per board with the latency,
+ * the attempts and the reply of every command (the value, or the result name on failure).
+ *
+ * @param lines the command lines, used as column titles
+ * @param results the results of Fleet::run
+ */
+std::string formatTable( const std::vector<std::string> &lines, const std::vector<BoardResult> &results );
+
+}
+
+#endif
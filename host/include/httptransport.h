@@ -0,0 +1,153 @@
+/**
+ * @file httptransport.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef HTTPTRANSPORT_H
+#define HTTPTRANSPORT_H
+
+#include "transport.h"
+
+namespace nodemcu {
+
+/**
+ * @brief The HttpTransport class maps commands on the HTTP routes of the board.
+ * Supported are read (GET /read), write (POST /write), config (POST /configure and
+ * GET /configure/show), stats (GET /stats) and metrics (GET /metrics), other commands
+ * fail with RESULT_UNSUPPORTED. The connection is reused while the board keeps it open
+ * and requests are only pipelined after the board answered without "Connection: close".
+ */
+class HttpTransport : public Transport {
+public:
+    /**
+     * @brief Construct a new Http Transport object
+     *
+     * @param loop the event loop that handles the connection
+     * @param host the host name or IP address of the board
+     * @param port the HTTP port of the board (ConfigControl::PortHTTP)
+     * @param options the connection settings
+     */
+    HttpTransport( EventLoop *loop, const std::string &host, uint16_t port, const Options &options );
+
+    /**
+     * @brief Destroy the Http Transport object
+     */
+    ~HttpTransport();
+
+    /**
+     * @brief Return the board address as http://host:port.
+     */
+    std::string address() const override;
+
+protected:
+    int open() override;
+    bool encode( Request &request, std::string &out ) override;
+    void receive( const char *data, size_t length ) override;
+    void closedEvent() override;
+    uint32_t depth() const override;
+
+private:
+    /**
+     * @brief The kinds of requests, they decide how the response body is read.
+     */
+    enum Kind {
+        KIND_TEXT,
+        KIND_RESULT
+    };
+
+    /**
+     * @brief Parse the status line and the headers of the response.
+     *
+     * @return false if they are not complete yet
+     */
+    bool parseHeaders();
+
+    /**
+     * @brief Parse the body of the response.
+     *
+     * @return false if it is not complete yet
+     */
+    bool parseBody();
+
+    /**
+     * @brief Complete the oldest request with the parsed response.
+     */
+    void finish();
+
+    /**
+     * @brief The host name or IP address of the board.
+     */
+    std::string m_Host;
+
+    /**
+     * @brief The HTTP port of the board.
+     */
+    uint16_t m_Port;
+
+    /**
+     * @brief Received bytes that have not been parsed.
+     */
+    std::string m_Buffer;
+
+    /**
+     * @brief The status code of the response being received, 0 while the headers are incomplete.
+     */
+    int m_Status;
+
+    /**
+     * @brief The content length of the response, -1 when the body ends at the end of the connection.
+     */
+    long m_ContentLength;
+
+    /**
+     * @brief Flag which is set when the body is sent in chunks.
+     */
+    bool m_Chunked;
+
+    /**
+     * @brief Flag which is set when the board closes the connection after the response.
+     */
+    bool m_Close;
+
+    /**
+     * @brief Flag which is set when the board keeps connections open, pipelining is used from then on.
+     */
+    bool m_KeepAlive;
+
+    /**
+     * @brief The amount of requests the board still serves on the connection (Keep-Alive max), UINT32_MAX when unknown.
+     */
+    uint32_t m_Remaining;
+
+    /**
+     * @brief The body of the response being received.
+     */
+    std::string m_Body;
+};
+
+}
+
+#endif
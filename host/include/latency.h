@@ -0,0 +1,128 @@
+/**
+ * @file latency.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace nodemcu {
+
+/**
+ * @brief The LatencyHistogram class collects latencies in log-linear buckets.
+ * Every power of two is split in 32 buckets, so a percentile is accurate to about 3%
+ * while a histogram takes the same memory for a thousand or a billion samples.
+ */
+class LatencyHistogram {
+public:
+    /**
+     * @brief Construct a new Latency Histogram object
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Add a latency.
+     *
+     * @param us the latency in microseconds
+     */
+    void record( uint64_t us );
+
+    /**
+     * @brief Add the samples of another histogram.
+     */
+    void merge( const LatencyHistogram &other );
+
+    /**
+     * @brief Remove all samples.
+     */
+    void reset();
+
+    /**
+     * @brief Return the latency (in us) below which the given fraction of the samples is.
+     *
+     * @param fraction the fraction, for example 0.99 for p99
+     */
+    uint64_t percentile( double fraction ) const;
+
+    /**
+     * @brief Return the amount of samples.
+     */
+    uint64_t count() const;
+
+    /**
+     * @brief Return the average latency in microseconds.
+     */
+    uint64_t mean() const;
+
+    /**
+     * @brief Return the largest latency in microseconds.
+     */
+    uint64_t max() const;
+
+    /**
+     * @brief Return a one line summary: count, mean, p50, p99, p999 and max in milliseconds.
+     */
+    std::string summary() const;
+
+private:
+    /**
+     * @brief Return the bucket of a latency.
+     */
+    static size_t bucket( uint64_t us );
+
+    /**
+     * @brief Return the highest latency of a bucket.
+     */
+    static uint64_t upperBound( size_t bucket );
+
+    /**
+     * @brief The amount of samples per bucket.
+     */
+    std::vector<uint64_t> m_Buckets;
+
+    /**
+     * @brief The amount of samples.
+     */
+    uint64_t m_Count;
+
+    /**
+     * @brief The sum of all samples.
+     */
+    uint64_t m_Sum;
+
+    /**
+     * @brief The largest sample.
+     */
+    uint64_t m_Max;
+};
+
+}
+
+#endif
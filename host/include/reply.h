@@ -0,0 +1,142 @@
+/**
+ * @file reply.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef REPLY_H
+#define REPLY_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace nodemcu {
+
+/**
+ * @brief The result codes of the host library, the board result codes (command.h) are passed through unchanged.
+ */
+enum Result : uint16_t {
+    RESULT_SUCCESS = 0x0000,
+    RESULT_HTTP = 0xFCC1,
+    RESULT_TCP = 0xFCC2,
+    RESULT_SERIAL = 0xFCC3,
+    RESULT_BUSY = 0xFCCB,
+    RESULT_EVICTED = 0xFCCC,
+    RESULT_DISCONNECTED = 0xFCCD,
+    RESULT_TIMEOUT = 0xFCCE,
+    RESULT_UNSUPPORTED = 0xFCCF
+};
+
+/**
+ * @brief The reply of the board to one command.
+ */
+struct Reply {
+    /**
+     * @brief The result code of the board or of the host library.
+     */
+    uint16_t Result = RESULT_TIMEOUT;
+
+    /**
+     * @brief The reply text without the result line, for a read command the value of the pin.
+     */
+    std::string Text;
+
+    /**
+     * @brief Time (in us) between sending the command and receiving the reply.
+     */
+    uint64_t LatencyUs = 0;
+
+    /**
+     * @brief Return true if the command succeeded.
+     */
+    bool ok() const { return Result == RESULT_SUCCESS; }
+
+    /**
+     * @brief Return the reply text as a number, the value of a read command.
+     */
+    int value() const { return std::atoi( Text.c_str() ); }
+};
+
+/**
+ * @brief Callback called with the reply of a command on the thread of the event loop.
+ */
+typedef std::function<void( const Reply &reply )> Callback;
+
+/**
+ * @brief A command waiting to be sent or waiting for its reply.
+ */
+struct Request {
+    /**
+     * @brief The command and its arguments.
+     */
+    std::vector<std::string> Command;
+
+    /**
+     * @brief Called once with the reply.
+     */
+    Callback Done;
+
+    /**
+     * @brief Time (in ms) at which the request fails with RESULT_TIMEOUT.
+     */
+    uint64_t Deadline = 0;
+
+    /**
+     * @brief Time (in us) the request was sent.
+     */
+    uint64_t Sent = 0;
+
+    /**
+     * @brief Sequence number of the request, used by transports that can match replies out of order.
+     */
+    uint32_t Sequence = 0;
+
+    /**
+     * @brief Transport specific kind of the request, used to interpret the reply.
+     */
+    int Kind = 0;
+};
+
+/**
+ * @brief Join a command and its arguments to a command line without newline.
+ */
+std::string joinCommand( const std::vector<std::string> &command );
+
+/**
+ * @brief Split a command line into the command and its arguments.
+ */
+std::vector<std::string> splitCommand( const std::string &line );
+
+/**
+ * @brief Return a short name for a result code, for example "timeout" or "0xF100".
+ */
+std::string resultName( uint16_t result );
+
+}
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file serialtransport.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SERIALTRANSPORT_H
+#define SERIALTRANSPORT_H
+
+#include "transport.h"
+
+namespace nodemcu {
+
+/**
+ * @brief The SerialTransport class sends commands over the USB serial port of the board.
+ * In text mode it sends command lines and reads the result lines like the TcpTransport.
+ * In binary mode it switches the board with "serial binary <baud>" after opening the port
+ * and sends COBS framed commands with a sequence number (see the README), replies may then
+ * be matched out of order and log frames are passed to OnLog.
+ */
+class SerialTransport : public Transport {
+public:
+    /**
+     * @brief Construct a new Serial Transport object
+     *
+     * @param loop the event loop that handles the connection
+     * @param device the serial device, for example /dev/ttyUSB0
+     * @param baudRate the baud rate of the text mode of the board
+     * @param binaryBaud the baud rate of the binary mode, 0 stays in text mode
+     * @param options the connection settings
+     */
+    SerialTransport( EventLoop *loop, const std::string &device, uint32_t baudRate, uint32_t binaryBaud, const Options &options );
+
+    /**
+     * @brief Destroy the Serial Transport object
+     */
+    ~SerialTransport();
+
+    /**
+     * @brief Return the serial device.
+     */
+    std::string address() const override;
+
+protected:
+    int open() override;
+    bool encode( Request &request, std::string &out ) override;
+    void receive( const char *data, size_t length ) override;
+    void connectedEvent() override;
+    void closedEvent() override;
+    uint32_t depth() const override;
+    bool ordered() const override;
+
+private:
+    /**
+     * @brief Set the baud rate of the open port.
+     */
+    bool setBaudRate( uint32_t baudRate );
+
+    /**
+     * @brief Decode, check and handle a received frame.
+     */
+    void handleFrame();
+
+    /**
+     * @brief The serial device.
+     */
+    std::string m_Device;
+
+    /**
+     * @brief The baud rate of the text mode.
+     */
+    uint32_t m_BaudRate;
+
+    /**
+     * @brief The baud rate of the binary mode, 0 for text mode.
+     */
+    uint32_t m_BinaryBaud;
+
+    /**
+     * @brief The open port.
+     */
+    int m_Fd;
+
+    /**
+     * @brief Flag which is set when the board switched to binary mode.
+     */
+    bool m_Binary;
+
+    /**
+     * @brief The sequence number of the next command frame.
+     */
+    uint8_t m_Sequence;
+
+    /**
+     * @brief The frame being received in binary mode.
+     */
+    std::string m_Frame;
+
+    /**
+     * @brief The reply data frames received per sequence number.
+     */
+    std::string m_ReplyData[256];
+
+    /**
+     * @brief The incomplete log line received in log frames.
+     */
+    std::string m_LogLine;
+};
+
+}
+
+#endif
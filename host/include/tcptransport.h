@@ -0,0 +1,91 @@
+/**
+ * @file tcptransport.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef TCPTRANSPORT_H
+#define TCPTRANSPORT_H
+
+#include "transport.h"
+
+namespace nodemcu {
+
+/**
+ * @brief Open a non-blocking TCP connection.
+ *
+ * @param host the host name or IP address
+ * @param port the TCP port
+ * @return int the socket or -1 on failure
+ */
+int openTcpSocket( const std::string &host, uint16_t port );
+
+/**
+ * @brief The TcpTransport class sends command lines to the TCP server of the board.
+ * The board handles the lines of a connection in order and ends every reply with
+ * the result line "=XXXX", so many commands can be sent without waiting.
+ */
+class TcpTransport : public Transport {
+public:
+    /**
+     * @brief Construct a new Tcp Transport object
+     *
+     * @param loop the event loop that handles the connection
+     * @param host the host name or IP address of the board
+     * @param port the TCP port of the board (ConfigControl::PortTCP)
+     * @param options the connection settings
+     */
+    TcpTransport( EventLoop *loop, const std::string &host, uint16_t port, const Options &options );
+
+    /**
+     * @brief Destroy the Tcp Transport object
+     */
+    ~TcpTransport();
+
+    /**
+     * @brief Return the board address as host:port.
+     */
+    std::string address() const override;
+
+protected:
+    int open() override;
+    bool encode( Request &request, std::string &out ) override;
+    void receive( const char *data, size_t length ) override;
+
+private:
+    /**
+     * @brief The host name or IP address of the board.
+     */
+    std::string m_Host;
+
+    /**
+     * @brief The TCP port of the board.
+     */
+    uint16_t m_Port;
+};
+
+}
+
+#endif
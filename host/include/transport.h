@@ -0,0 +1,330 @@
+/**
+ * @file transport.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include "eventloop.h"
+#include "reply.h"
+#include <deque>
+
+namespace nodemcu {
+
+/**
+ * @brief The connection settings of a transport.
+ */
+struct Options {
+    /**
+     * @brief Time (in ms) a command may take from submitting until its reply.
+     */
+    uint32_t TimeoutMs = 2000;
+
+    /**
+     * @brief Maximum amount of commands sent without waiting for their replies.
+     */
+    uint32_t PipelineDepth = 16;
+
+    /**
+     * @brief Reconnect automatically when the connection is lost.
+     */
+    bool Reconnect = true;
+
+    /**
+     * @brief First delay (in ms) before reconnecting, doubled after every failed attempt.
+     */
+    uint32_t ReconnectMinMs = 100;
+
+    /**
+     * @brief Maximum delay (in ms) before reconnecting.
+     */
+    uint32_t ReconnectMaxMs = 5000;
+};
+
+/**
+ * @brief The counters of a transport.
+ */
+struct TransportStats {
+    uint64_t Sent = 0;
+    uint64_t Completed = 0;
+    uint64_t Failed = 0;
+    uint64_t Timeouts = 0;
+    uint64_t Connects = 0;
+    uint64_t Disconnects = 0;
+    uint64_t BytesOut = 0;
+    uint64_t BytesIn = 0;
+};
+
+/**
+ * @brief The Transport class keeps the connection to one board and pipelines the commands on it.
+ * Commands are queued until the connection is up and at most PipelineDepth commands wait for a reply.
+ * A lost connection is reopened with a growing delay, the commands that were sent fail with
+ * RESULT_DISCONNECTED and the queued commands are sent after reconnecting.
+ * All functions must be called on the thread of the event loop.
+ */
+class Transport {
+public:
+    /**
+     * @brief Construct a new Transport object
+     *
+     * @param loop the event loop that handles the connection
+     * @param options the connection settings
+     */
+    Transport( EventLoop *loop, const Options &options );
+
+    /**
+     * @brief Destroy the Transport object, fails the remaining commands.
+     */
+    virtual ~Transport();
+
+    /**
+     * @brief Queue a command and connect if needed.
+     *
+     * @param request the command, Done is called with the reply
+     */
+    void submit( Request request );
+
+    /**
+     * @brief Open the connection without waiting for the first command.
+     */
+    void begin();
+
+    /**
+     * @brief Close the connection and fail all commands with RESULT_DISCONNECTED.
+     */
+    void close();
+
+    /**
+     * @brief Return true if the connection is up.
+     */
+    bool connected() const;
+
+    /**
+     * @brief Return the amount of commands that are queued or waiting for a reply.
+     */
+    size_t pending() const;
+
+    /**
+     * @brief Return the counters of the transport.
+     */
+    const TransportStats &stats() const;
+
+    /**
+     * @brief Return a description of the board address, for example "192.168.1.20:3000".
+     */
+    virtual std::string address() const = 0;
+
+    /**
+     * @brief Called with the log lines the board sends between replies.
+     */
+    std::function<void( const std::string &line )> OnLog;
+
+protected:
+    /**
+     * @brief Start opening the connection.
+     *
+     * @return int the non-blocking file descriptor or -1 on failure
+     */
+    virtual int open() = 0;
+
+    /**
+     * @brief Encode a command for sending.
+     *
+     * @param request the command, Kind and Sequence may be set
+     * @param out the bytes to send are appended to this buffer
+     * @return false if the transport does not support the command
+     */
+    virtual bool encode( Request &request, std::string &out ) = 0;
+
+    /**
+     * @brief Parse received bytes and complete the commands they reply to.
+     */
+    virtual void receive( const char *data, size_t length ) = 0;
+
+    /**
+     * @brief Called when the connection is up, before queued commands are sent.
+     */
+    virtual void connectedEvent();
+
+    /**
+     * @brief Called when the connection has been closed.
+     */
+    virtual void closedEvent();
+
+    /**
+     * @brief Return the amount of commands that may wait for a reply.
+     */
+    virtual uint32_t depth() const;
+
+    /**
+     * @brief Return true if replies arrive in the order the commands were sent.
+     * After a timeout an ordered stream can not be trusted anymore and is reconnected.
+     */
+    virtual bool ordered() const;
+
+    /**
+     * @brief Complete a command that has been sent.
+     *
+     * @param index the position of the command in the in flight list, 0 is the oldest
+     * @param result the result code
+     * @param text the reply text
+     */
+    void complete( size_t index, uint16_t result, const std::string &text );
+
+    /**
+     * @brief Parse text lines, lines are collected until the result line "=XXXX" ends the reply.
+     * Lines starting with a log level prefix ("[I] ") are passed to OnLog.
+     */
+    void receiveLines( const char *data, size_t length );
+
+    /**
+     * @brief Send bytes that are not part of a command.
+     */
+    void send( const std::string &data );
+
+    /**
+     * @brief Close the connection and reconnect.
+     *
+     * @param failure true to wait before reconnecting, false to reconnect right away
+     */
+    void restart( bool failure );
+
+    /**
+     * @brief Send queued commands as far as the pipeline depth allows.
+     */
+    void pump();
+
+    /**
+     * @brief The event loop that handles the connection.
+     */
+    EventLoop *m_Loop;
+
+    /**
+     * @brief The connection settings.
+     */
+    Options m_Options;
+
+    /**
+     * @brief The commands that have been sent, oldest first.
+     */
+    std::deque<Request> m_InFlight;
+
+    /**
+     * @brief The commands waiting to be sent.
+     */
+    std::deque<Request> m_Queue;
+
+    /**
+     * @brief The counters of the transport.
+     */
+    TransportStats m_Stats;
+
+private:
+    /**
+     * @brief The states of the connection.
+     */
+    enum State {
+        STATE_CLOSED,
+        STATE_CONNECTING,
+        STATE_CONNECTED,
+        STATE_WAITING
+    };
+
+    /**
+     * @brief Open the connection.
+     */
+    void connect();
+
+    /**
+     * @brief Handle the events of the file descriptor.
+     */
+    void handleEvents( uint32_t events );
+
+    /**
+     * @brief Write the output buffer as far as the socket accepts it.
+     */
+    void flush();
+
+    /**
+     * @brief Fail the commands whose deadline has passed.
+     */
+    void checkTimeouts();
+
+    /**
+     * @brief Close the file descriptor and fail the commands that have been sent.
+     */
+    void disconnect();
+
+    /**
+     * @brief Fail a command.
+     */
+    void fail( Request &request, uint16_t result );
+
+    /**
+     * @brief The file descriptor of the connection.
+     */
+    int m_Fd;
+
+    /**
+     * @brief The state of the connection.
+     */
+    State m_State;
+
+    /**
+     * @brief Bytes waiting to be written.
+     */
+    std::string m_Out;
+
+    /**
+     * @brief The text of the reply being received by receiveLines.
+     */
+    std::string m_Text;
+
+    /**
+     * @brief The incomplete line being received by receiveLines.
+     */
+    std::string m_Line;
+
+    /**
+     * @brief Delay (in ms) before the next reconnect.
+     */
+    uint32_t m_Backoff;
+
+    /**
+     * @brief The timer that checks the timeouts.
+     */
+    uint32_t m_TickTimer;
+
+    /**
+     * @brief The timer that reconnects after a failure, 0 if none is waiting.
+     */
+    uint32_t m_ReconnectTimer;
+};
+
+}
+
+#endif
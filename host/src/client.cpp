@@ -0,0 +1,326 @@
+/**
+ * @file client.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "client.h"
+#include "httptransport.h"
+#include "serialtransport.h"
+#include "tcptransport.h"
+
+namespace nodemcu {
+
+/**
+ * @brief Create a client that talks to the TCP server of the board.
+ *
+ * @param host the host name or IP address of the board
+ * @param port the TCP port of the board
+ * @param options the connection settings
+ * @param loop a shared event loop, nullptr to start a loop for this client
+ */
+std::unique_ptr<Client> Client::tcp( const std::string &host, uint16_t port, const Options &options, EventLoop *loop ){
+    return std::unique_ptr<Client>( new Client( loop, [ = ]( EventLoop *loop ){ return new TcpTransport( loop, host, port, options ); } ) );
+}
+
+/**
+ * @brief Create a client that talks to the HTTP server of the board.
+ *
+ * @param host the host name or IP address of the board
+ * @param port the HTTP port of the board
+ * @param options the connection settings
+ * @param loop a shared event loop, nullptr to start a loop for this client
+ */
+std::unique_ptr<Client> Client::http( const std::string &host, uint16_t port, const Options &options, EventLoop *loop ){
+    return std::unique_ptr<Client>( new Client( loop, [ = ]( EventLoop *loop ){ return new HttpTransport( loop, host, port, options ); } ) );
+}
+
+/**
+ * @brief Create a client that talks to the board over the serial port.
+ *
+ * @param device the serial device, for example /dev/ttyUSB0
+ * @param baudRate the baud rate of the text mode of the board
+ * @param binaryBaud the baud rate of the binary mode, 0 stays in text mode
+ * @param options the connection settings
+ * @param loop a shared event loop, nullptr to start a loop for this client
+ */
+std::unique_ptr<Client> Client::serial( const std::string &device, uint32_t baudRate, uint32_t binaryBaud, const Options &options, EventLoop *loop ){
+    return std::unique_ptr<Client>( new Client( loop, [ = ]( EventLoop *loop ){ return new SerialTransport( loop, device, baudRate, binaryBaud, options ); } ) );
+}
+
+/**
+ * @brief Construct a new Client object
+ *
+ * @param loop a shared event loop, nullptr to start a loop for this client
+ * @param create creates the transport on the loop thread
+ */
+Client::Client( EventLoop *loop, std::function<Transport*( EventLoop *loop )> create )
+: m_Loop( loop )
+, m_Transport( nullptr )
+, m_NextSubscription( 1 )
+{
+    if( !m_Loop ) {
+        m_OwnLoop.reset( new EventLoop() );
+        m_Loop = m_OwnLoop.get();
+        m_Loop->start();
+    }
+    runInLoop( [ this, create ](){ m_Transport = create( m_Loop ); } );
+}
+
+/**
+ * @brief Destroy the Client object, pending commands fail with RESULT_DISCONNECTED.
+ */
+Client::~Client(){
+    runInLoop( [ this ](){
+        for( auto &subscription: m_Subscriptions ) m_Loop->cancelTimer( subscription.second.Timer );
+        m_Subscriptions.clear();
+        delete m_Transport;
+        m_Transport = nullptr;
+    });
+    if( m_OwnLoop ) m_OwnLoop->stop();
+}
+
+/**
+ * @brief Open the connection now instead of with the first command.
+ */
+void Client::connect(){
+    runInLoop( [ this ](){ m_Transport->begin(); } );
+}
+
+/**
+ * @brief Send a command line, the callback is called on the loop thread.
+ */
+void Client::command( const std::string &line, Callback done ){
+    Request request;
+    request.Command = splitCommand( line );
+    request.Done = done;
+    if( m_Loop->inLoop() ) {
+        m_Transport->submit( std::move( request ) );
+        return;
+    }
+    m_Loop->post( [ this, request ](){ m_Transport->submit( request ); } );
+}
+
+/**
+ * @brief Send a command line.
+ */
+std::future<Reply> Client::command( const std::string &line ){
+    std::shared_ptr<std::promise<Reply>> promise = std::make_shared<std::promise<Reply>>();
+    command( line, [ promise ]( const Reply &reply ){ promise->set_value( reply ); } );
+    return promise->get_future();
+}
+
+/**
+ * @brief Read a pin, the value is returned by Reply::value().
+ *
+ * @param pin the pin name, A0 or D0 to D8
+ */
+std::future<Reply> Client::read( const std::string &pin ){
+    return command( "read " + pin );
+}
+
+/**
+ * @brief Write a value to an output pin.
+ *
+ * @param pin the pin name, D0 to D8
+ * @param value the value to write
+ */
+std::future<Reply> Client::write( const std::string &pin, int value ){
+    return command( "write " + pin + " " + std::to_string( value ) );
+}
+
+/**
+ * @brief Write several output pins at once, the board sets all of them or none.
+ *
+ * @param values the pin names and their values, 0 or 1
+ */
+std::future<Reply> Client::write( const std::vector<std::pair<std::string, int>> &values ){
+    std::string line = "write";
+    for( const auto &value: values ) line += " " + value.first + "=" + std::to_string( value.second );
+    return command( line );
+}
+
+/**
+ * @brief Change a setting of the board, for example configure( "timeout", "60000" ).
+ */
+std::future<Reply> Client::configure( const std::string &setting, const std::string &value ){
+    return command( "config " + setting + " " + value );
+}
+
+/**
+ * @brief Set the mode of a pin.
+ *
+ * @param pin the pin name
+ * @param mode input or output
+ */
+std::future<Reply> Client::configurePin( const std::string &pin, const std::string &mode ){
+    return command( "config pin " + pin + " " + mode );
+}
+
+/**
+ * @brief Send several command lines at once, the replies are in the same order.
+ */
+std::future<std::vector<Reply>> Client::batch( const std::vector<std::string> &lines ){
+    struct Batch {
+        std::promise<std::vector<Reply>> Promise;
+        std::vector<Reply> Replies;
+        size_t Remaining;
+    };
+    std::shared_ptr<Batch> batch = std::make_shared<Batch>();
+    batch->Replies.resize( lines.size() );
+    batch->Remaining = lines.size();
+    std::future<std::vector<Reply>> future = batch->Promise.get_future();
+    if( lines.empty() ) batch->Promise.set_value( batch->Replies );
+
+    // The replies arrive on the loop thread, so the counter needs no lock
+    for( size_t i = 0; i < lines.size(); i++ ){
+        command( lines[i], [ batch, i ]( const Reply &reply ){
+            batch->Replies[i] = reply;
+            if( --batch->Remaining == 0 ) batch->Promise.set_value( std::move( batch->Replies ) );
+        });
+    }
+    return future;
+}
+
+/**
+ * @brief Read a pin periodically and call the callback when its value changes.
+ * The board has no push messages, so the subscription polls with a read command.
+ *
+ * @param pin the pin name
+ * @param intervalMs the poll interval
+ * @param changed called on the loop thread with the first value and every change
+ * @return uint32_t the ID of the subscription
+ */
+uint32_t Client::subscribe( const std::string &pin, uint32_t intervalMs, PinCallback changed ){
+    uint32_t id = m_NextSubscription++;
+    runInLoop( [ this, id, pin, intervalMs, changed ](){
+        Subscription &subscription = m_Subscriptions[id];
+        subscription.Pin = pin;
+        subscription.Changed = changed;
+        subscription.Reading = false;
+        subscription.Known = false;
+        subscription.Value = 0;
+        subscription.Timer = m_Loop->addTimer( 0, intervalMs ? intervalMs : 1, [ this, id ](){ poll( id ); } );
+    });
+    return id;
+}
+
+/**
+ * @brief Stop a subscription.
+ */
+void Client::unsubscribe( uint32_t id ){
+    runInLoop( [ this, id ](){
+        auto subscription = m_Subscriptions.find( id );
+        if( subscription == m_Subscriptions.end() ) return;
+        m_Loop->cancelTimer( subscription->second.Timer );
+        m_Subscriptions.erase( subscription );
+    });
+}
+
+/**
+ * @brief Set the callback for the log lines of the board (serial only).
+ */
+void Client::onLog( std::function<void( const std::string &line )> log ){
+    runInLoop( [ this, log ](){ m_Transport->OnLog = log; } );
+}
+
+/**
+ * @brief Return a copy of the counters of the transport.
+ */
+TransportStats Client::stats(){
+    TransportStats stats;
+    runInLoop( [ this, &stats ](){ stats = m_Transport->stats(); } );
+    return stats;
+}
+
+/**
+ * @brief Return true if the connection is up.
+ */
+bool Client::connected(){
+    bool connected = false;
+    runInLoop( [ this, &connected ](){ connected = m_Transport->connected(); } );
+    return connected;
+}
+
+/**
+ * @brief Return the amount of commands that are queued or waiting for a reply.
+ */
+size_t Client::pending(){
+    size_t pending = 0;
+    runInLoop( [ this, &pending ](){ pending = m_Transport->pending(); } );
+    return pending;
+}
+
+/**
+ * @brief Return the board address.
+ */
+std::string Client::address(){
+    std::string address;
+    runInLoop( [ this, &address ](){ address = m_Transport->address(); } );
+    return address;
+}
+
+/**
+ * @brief Run a task on the loop thread and wait for it.
+ */
+void Client::runInLoop( std::function<void()> task ){
+    if( m_Loop->inLoop() ) {
+        task();
+        return;
+    }
+    std::promise<void> done;
+    m_Loop->post( [ &task, &done ](){
+        task();
+        done.set_value();
+    });
+    done.get_future().wait();
+}
+
+/**
+ * @brief Poll a subscribed pin.
+ */
+void Client::poll( uint32_t id ){
+    auto subscription = m_Subscriptions.find( id );
+    if( subscription == m_Subscriptions.end() || subscription->second.Reading ) return;
+    subscription->second.Reading = true;
+
+    Request request;
+    request.Command = { "read", subscription->second.Pin };
+    request.Done = [ this, id ]( const Reply &reply ){
+        auto subscription = m_Subscriptions.find( id );
+        if( subscription == m_Subscriptions.end() ) return;
+        Subscription &pin = subscription->second;
+        pin.Reading = false;
+        if( !reply.ok() ) return;
+        if( pin.Known && pin.Value == reply.value() ) return;
+        pin.Known = true;
+        pin.Value = reply.value();
+        PinCallback changed = pin.Changed;
+        changed( pin.Pin, pin.Value );
+    };
+    m_Transport->submit( std::move( request ) );
+}
+
+}
@@ -0,0 +1,244 @@
+/**
+ * @file eventloop.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "eventloop.h"
+#include <chrono>
+#include <csignal>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace nodemcu {
+
+/**
+ * @brief Return a monotonic time stamp in milliseconds.
+ */
+uint64_t nowMs(){
+    return std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+/**
+ * @brief Return a monotonic time stamp in microseconds.
+ */
+uint64_t nowUs(){
+    return std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+/**
+ * @brief Construct a new Event Loop object
+ */
+EventLoop::EventLoop()
+: m_Epoll( epoll_create1( EPOLL_CLOEXEC ) )
+, m_Wake( eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC ) )
+, m_NextTimer( 1 )
+, m_LoopThread( std::this_thread::get_id() )
+, m_Running( false )
+{
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = m_Wake;
+    epoll_ctl( m_Epoll, EPOLL_CTL_ADD, m_Wake, &event );
+
+    // A board that closes a connection with requests in flight (HTTP max requests, eviction) makes a write fail with EPIPE,
+    // which the transport handles, instead of ending the process
+    signal( SIGPIPE, SIG_IGN );
+}
+
+/**
+ * @brief Destroy the Event Loop object, stops the thread if it is running.
+ */
+EventLoop::~EventLoop(){
+    stop();
+    close( m_Wake );
+    close( m_Epoll );
+}
+
+/**
+ * @brief Run the loop in a new thread.
+ */
+void EventLoop::start(){
+    if( m_Running ) return;
+    m_Running = true;
+    m_Thread = std::thread( [ this ](){
+        m_LoopThread = std::this_thread::get_id();
+        while( m_Running ) runOnce( 100 );
+    });
+}
+
+/**
+ * @brief Stop the thread of the loop and wait for it.
+ */
+void EventLoop::stop(){
+    if( !m_Running ) return;
+    m_Running = false;
+    post( [](){} );
+    if( m_Thread.joinable() ) m_Thread.join();
+    m_LoopThread = std::this_thread::get_id();
+}
+
+/**
+ * @brief Wait for events and handle them once.
+ *
+ * @param timeoutMs maximum time to wait when there is no timer due earlier
+ */
+void EventLoop::runOnce( int timeoutMs ){
+    uint64_t now = nowMs();
+    for( auto &timer: m_Timers ){
+        if( timer.second.Due <= now ) timeoutMs = 0;
+        else if( timer.second.Due - now < static_cast<uint64_t>( timeoutMs ) ) timeoutMs = timer.second.Due - now;
+    }
+
+    epoll_event events[64];
+    int count = epoll_wait( m_Epoll, events, 64, timeoutMs );
+    for( int i = 0; i < count; i++ ){
+        if( events[i].data.fd == m_Wake ) {
+            uint64_t value;
+            if( read( m_Wake, &value, sizeof( value ) ) < 0 ) continue;
+            continue;
+        }
+        // The handler may unwatch itself, so it is copied before it runs
+        auto handler = m_Handlers.find( events[i].data.fd );
+        if( handler == m_Handlers.end() ) continue;
+        Handler run = handler->second;
+        run( events[i].events );
+    }
+    runPosted();
+    runTimers();
+}
+
+/**
+ * @brief Run a task on the loop thread, may be called from any thread.
+ *
+ * @param task the task to run
+ */
+void EventLoop::post( std::function<void()> task ){
+    {
+        std::lock_guard<std::mutex> lock( m_Mutex );
+        m_Posted.push_back( task );
+    }
+    uint64_t value = 1;
+    if( write( m_Wake, &value, sizeof( value ) ) < 0 ) return;
+}
+
+/**
+ * @brief Return true when called from the thread that runs the loop.
+ */
+bool EventLoop::inLoop() const {
+    return std::this_thread::get_id() == m_LoopThread;
+}
+
+/**
+ * @brief Watch a file descriptor, only call on the loop thread.
+ *
+ * @param fd the file descriptor
+ * @param events the epoll events to wait for
+ * @param handler the handler for the events
+ * @return true if the descriptor is watched
+ */
+bool EventLoop::watch( int fd, uint32_t events, Handler handler ){
+    epoll_event event = {};
+    event.events = events;
+    event.data.fd = fd;
+    if( epoll_ctl( m_Epoll, EPOLL_CTL_ADD, fd, &event ) < 0 ) return false;
+    m_Handlers[fd] = handler;
+    return true;
+}
+
+/**
+ * @brief Change the events of a watched file descriptor, only call on the loop thread.
+ */
+bool EventLoop::modify( int fd, uint32_t events ){
+    epoll_event event = {};
+    event.events = events;
+    event.data.fd = fd;
+    return epoll_ctl( m_Epoll, EPOLL_CTL_MOD, fd, &event ) == 0;
+}
+
+/**
+ * @brief Stop watching a file descriptor, only call on the loop thread.
+ */
+void EventLoop::unwatch( int fd ){
+    epoll_ctl( m_Epoll, EPOLL_CTL_DEL, fd, nullptr );
+    m_Handlers.erase( fd );
+}
+
+/**
+ * @brief Run a task after a delay and repeat it when an interval is given, only call on the loop thread.
+ *
+ * @param delayMs the time until the first run
+ * @param intervalMs the repeat interval, 0 runs the task once
+ * @param task the task to run
+ * @return uint32_t the ID of the timer
+ */
+uint32_t EventLoop::addTimer( uint32_t delayMs, uint32_t intervalMs, std::function<void()> task ){
+    uint32_t id = m_NextTimer++;
+    m_Timers[id] = { nowMs() + delayMs, intervalMs, task };
+    return id;
+}
+
+/**
+ * @brief Cancel a timer, only call on the loop thread.
+ */
+void EventLoop::cancelTimer( uint32_t id ){
+    m_Timers.erase( id );
+}
+
+/**
+ * @brief Run the posted tasks.
+ */
+void EventLoop::runPosted(){
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> lock( m_Mutex );
+        tasks.swap( m_Posted );
+    }
+    for( auto &task: tasks ) task();
+}
+
+/**
+ * @brief Run the timers that are due.
+ */
+void EventLoop::runTimers(){
+    uint64_t now = nowMs();
+    std::vector<uint32_t> due;
+    for( auto &timer: m_Timers ){
+        if( timer.second.Due <= now ) due.push_back( timer.first );
+    }
+
+    // A task may add or cancel timers, so every timer is looked up again before it runs
+    for( uint32_t id: due ){
+        auto timer = m_Timers.find( id );
+        if( timer == m_Timers.end() ) continue;
+        std::function<void()> task = timer->second.Task;
+        if( timer->second.Interval ) timer->second.Due = now + timer->second.Interval;
+        else m_Timers.erase( timer );
+        task();
+    }
+}
+
+}
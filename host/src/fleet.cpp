@@ -0,0 +1,246 @@
+/**
+ * @file fleet.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "fleet.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace nodemcu {
+
+/**
+ * @brief Return true if every command succeeded.
+ */
+bool BoardResult::ok() const {
+    for( const Reply &reply: Replies ) if( !reply.ok() ) return false;
+    return Attempts > 0;
+}
+
+/**
+ * @brief The state of one run, only used on the loop thread.
+ */
+struct Fleet::Run {
+    /**
+     * @brief The progress of one board.
+     */
+    struct Board {
+        uint64_t Start = 0;
+        uint32_t Outstanding = 0;
+        std::vector<bool> Retry;
+    };
+
+    std::vector<std::string> Lines;
+    std::vector<BoardResult> Results;
+    std::vector<Board> Boards;
+    size_t Next = 0;
+    size_t Active = 0;
+    size_t Finished = 0;
+    std::promise<std::vector<BoardResult>> Done;
+};
+
+/**
+ * @brief Construct a new Fleet object
+ *
+ * @param options the settings of the fleet
+ */
+Fleet::Fleet( const FleetOptions &options )
+: m_Options( options )
+, m_Closing( false )
+{
+    m_Loop.start();
+}
+
+/**
+ * @brief Destroy the Fleet object, closes all connections.
+ */
+Fleet::~Fleet(){
+    // The commands in flight fail while the clients are destroyed, their runs must not continue
+    m_Closing = true;
+    m_Boards.clear();
+    m_Loop.stop();
+}
+
+/**
+ * @brief Add a board, its connection is opened right away and kept open.
+ *
+ * @param host the host name or IP address of the board
+ * @param port the TCP port of the board, ConfigControl::PortTCP
+ */
+void Fleet::add( const std::string &host, uint16_t port ){
+    m_Boards.push_back( Client::tcp( host, port, m_Options.Connection, &m_Loop ) );
+    m_Boards.back()->connect();
+}
+
+/**
+ * @brief Return the amount of boards.
+ */
+size_t Fleet::size() const {
+    return m_Boards.size();
+}
+
+/**
+ * @brief Return the amount of boards with an open connection.
+ */
+size_t Fleet::connected(){
+    size_t count = 0;
+    for( auto &board: m_Boards ) if( board->connected() ) count++;
+    return count;
+}
+
+/**
+ * @brief Send command lines to every board. The lines of one board are pipelined,
+ * the future has one result per board in the order the boards were added.
+ */
+std::future<std::vector<BoardResult>> Fleet::run( const std::vector<std::string> &lines ){
+    std::shared_ptr<Run> run( new Run() );
+    run->Lines = lines;
+    run->Results.resize( m_Boards.size() );
+    run->Boards.resize( m_Boards.size() );
+    for( size_t i = 0; i < m_Boards.size(); i++ ){
+        run->Results[i].Board = m_Boards[i]->address();
+        run->Results[i].Replies.resize( lines.size() );
+        run->Boards[i].Retry.assign( lines.size(), true );
+    }
+    std::future<std::vector<BoardResult>> result = run->Done.get_future();
+    if( m_Boards.empty() || lines.empty() ) {
+        for( BoardResult &board: run->Results ) board.Attempts = m_Boards.empty() ? 0 : 1;
+        run->Done.set_value( run->Results );
+        return result;
+    }
+    m_Loop.post( [ this, run ](){ startBoards( run ); } );
+    return result;
+}
+
+/**
+ * @brief Read pins on every board, a snapshot of the fleet.
+ *
+ * @param pins the pin names, the replies are in the same order
+ */
+std::future<std::vector<BoardResult>> Fleet::read( const std::vector<std::string> &pins ){
+    std::vector<std::string> lines;
+    for( const std::string &pin: pins ) lines.push_back( "read " + pin );
+    return run( lines );
+}
+
+/**
+ * @brief Start boards as far as the concurrency allows.
+ */
+void Fleet::startBoards( const std::shared_ptr<Run> &run ){
+    while( run->Next < m_Boards.size() && ( !m_Options.Concurrency || run->Active < m_Options.Concurrency ) ){
+        size_t board = run->Next++;
+        run->Active++;
+        run->Boards[board].Start = nowUs();
+        send( run, board );
+    }
+}
+
+/**
+ * @brief Send the commands of a board that have no reply yet.
+ */
+void Fleet::send( const std::shared_ptr<Run> &run, size_t board ){
+    Run::Board &progress = run->Boards[board];
+    run->Results[board].Attempts++;
+    // Count all commands first, a command may fail right away while the others are sent
+    std::vector<size_t> lines;
+    for( size_t line = 0; line < run->Lines.size(); line++ ){
+        if( progress.Retry[line] ) lines.push_back( line );
+        progress.Retry[line] = false;
+    }
+    progress.Outstanding = lines.size();
+    for( size_t line: lines ){
+        m_Boards[board]->command( run->Lines[line], [ this, run, board, line ]( const Reply &reply ){
+            if( m_Closing ) return;
+            Run::Board &progress = run->Boards[board];
+            BoardResult &result = run->Results[board];
+            result.Replies[line] = reply;
+            // Only failures of the connection are retried, an error code of the board would come back again
+            bool lost = reply.Result == RESULT_TIMEOUT || reply.Result == RESULT_DISCONNECTED || reply.Result == RESULT_BUSY || reply.Result == RESULT_EVICTED;
+            if( lost && result.Attempts <= m_Options.Retries ) progress.Retry[line] = true;
+            if( --progress.Outstanding ) return;
+
+            if( std::find( progress.Retry.begin(), progress.Retry.end(), true ) != progress.Retry.end() ) {
+                m_Loop.addTimer( m_Options.RetryDelayMs, 0, [ this, run, board ](){ if( !m_Closing ) send( run, board ); } );
+                return;
+            }
+            result.LatencyUs = nowUs() - progress.Start;
+            run->Active--;
+            run->Finished++;
+            if( run->Finished == m_Boards.size() ) run->Done.set_value( run->Results );
+            else startBoards( run );
+        });
+    }
+}
+
+/**
+ * @brief Return the text of a reply for a table cell.
+ */
+static std::string cellText( const Reply &reply ){
+    if( !reply.ok() ) return resultName( reply.Result );
+    std::string text = reply.Text.substr( 0, reply.Text.find( '\n' ) );
+    if( text.empty() ) return "ok";
+    return text.size() > 24 ? text.substr( 0, 21 ) + "..." : text;
+}
+
+/**
+ * @brief Format fleet results as a text table: one row per board with the latency,
+ * the attempts and the reply of every command (the value, or the result name on failure).
+ *
+ * @param lines the command lines, used as column titles
+ * @param results the results of Fleet::run
+ */
+std::string formatTable( const std::vector<std::string> &lines, const std::vector<BoardResult> &results ){
+    std::vector<std::string> titles = { "board", "ms", "try" };
+    titles.insert( titles.end(), lines.begin(), lines.end() );
+    std::vector<std::vector<std::string>> rows;
+    for( const BoardResult &result: results ){
+        char latency[32];
+        snprintf( latency, sizeof( latency ), "%.3f", result.LatencyUs / 1000.0 );
+        std::vector<std::string> row = { result.Board, latency, std::to_string( result.Attempts ) };
+        for( const Reply &reply: result.Replies ) row.push_back( cellText( reply ) );
+        rows.push_back( row );
+    }
+
+    std::vector<size_t> widths;
+    for( const std::string &title: titles ) widths.push_back( title.size() );
+    for( const auto &row: rows ){
+        for( size_t i = 0; i < row.size() && i < widths.size(); i++ ) widths[i] = std::max( widths[i], row[i].size() );
+    }
+    auto format = [ & ]( const std::vector<std::string> &row ){
+        std::string text;
+        for( size_t i = 0; i < row.size() && i < widths.size(); i++ ){
+            if( i ) text += "  ";
+            text += row[i];
+            if( i + 1 < row.size() ) text.append( widths[i] - row[i].size(), ' ' );
+        }
+        return text + "\n";
+    };
+    std::string table = format( titles );
+    for( const auto &row: rows ) table += format( row );
+    return table;
+}
+
+}
@@ -0,0 +1,288 @@
+/**
+ * @file httptransport.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "httptransport.h"
+#include "tcptransport.h"
+#include <algorithm>
+#include <strings.h>
+
+namespace nodemcu {
+
+/**
+ * @brief Encode a form value, reserved characters are sent as %XX.
+ */
+static std::string formEncode( const std::string &value ){
+    static const char *hex = "0123456789ABCDEF";
+    std::string encoded;
+    for( unsigned char c: value ){
+        if( isalnum( c ) || c == '-' || c == '_' || c == '.' || c == '~' ) {
+            encoded += c;
+        } else {
+            encoded += '%';
+            encoded += hex[c >> 4];
+            encoded += hex[c & 0x0F];
+        }
+    }
+    return encoded;
+}
+
+/**
+ * @brief Construct a new Http Transport object
+ *
+ * @param loop the event loop that handles the connection
+ * @param host the host name or IP address of the board
+ * @param port the HTTP port of the board (ConfigControl::PortHTTP)
+ * @param options the connection settings
+ */
+HttpTransport::HttpTransport( EventLoop *loop, const std::string &host, uint16_t port, const Options &options )
+: Transport( loop, options )
+, m_Host( host )
+, m_Port( port )
+, m_Status( 0 )
+, m_ContentLength( -1 )
+, m_Chunked( false )
+, m_Close( false )
+, m_KeepAlive( false )
+, m_Remaining( UINT32_MAX )
+{}
+
+/**
+ * @brief Destroy the Http Transport object
+ */
+HttpTransport::~HttpTransport(){
+    close();
+}
+
+/**
+ * @brief Return the board address as http://host:port.
+ */
+std::string HttpTransport::address() const {
+    return "http://" + m_Host + ":" + std::to_string( m_Port );
+}
+
+int HttpTransport::open(){
+    return openTcpSocket( m_Host, m_Port );
+}
+
+bool HttpTransport::encode( Request &request, std::string &out ){
+    const std::vector<std::string> &command = request.Command;
+    if( command.empty() ) return false;
+    std::string name = command[0];
+    std::transform( name.begin(), name.end(), name.begin(), ::tolower );
+
+    std::string method = "GET";
+    std::string path;
+    std::string body;
+    request.Kind = KIND_TEXT;
+
+    if( name == "read" && command.size() == 2 ) {
+        path = "/read?pin=" + formEncode( command[1] );
+    } else if( name == "write" && command.size() == 3 ) {
+        method = "POST";
+        path = "/write";
+        body = "pin=" + formEncode( command[1] ) + "&value=" + formEncode( command[2] );
+    } else if( name == "write" && command.size() >= 2 && command[1].find( '=' ) != std::string::npos ) {
+        // The pins are the form fields, the board writes all of them at once
+        method = "POST";
+        path = "/write";
+        for( size_t i = 1; i < command.size(); i++ ){
+            size_t separator = command[i].find( '=' );
+            if( separator == std::string::npos ) return false;
+            if( body.size() ) body += '&';
+            body += formEncode( command[i].substr( 0, separator ) ) + "=" + formEncode( command[i].substr( separator + 1 ) );
+        }
+    } else if( name == "config" && command.size() == 2 && strcasecmp( command[1].c_str(), "show" ) == 0 ) {
+        path = "/configure/show";
+    } else if( name == "config" && command.size() >= 2 && command.size() <= 4 ) {
+        // The board replies with the result code of the command as decimal number
+        method = "POST";
+        path = "/configure";
+        for( size_t i = 1; i < command.size(); i++ ){
+            if( body.size() ) body += '&';
+            body += "arg" + std::to_string( i ) + "=" + formEncode( command[i] );
+        }
+        request.Kind = KIND_RESULT;
+    } else if( name == "stats" && command.size() <= 2 ) {
+        path = command.size() == 2 ? "/stats?reset=1" : "/stats";
+    } else if( name == "metrics" && command.size() == 1 ) {
+        path = "/metrics";
+    } else if( name == "clients" && command.size() == 1 ) {
+        path = "/clients";
+    } else {
+        return false;
+    }
+
+    out += method + " " + path + " HTTP/1.1\r\nHost: " + m_Host + "\r\n";
+    if( method == "POST" ) {
+        out += "Content-Type: application/x-www-form-urlencoded\r\nContent-Length: " + std::to_string( body.size() ) + "\r\n";
+    }
+    out += "\r\n";
+    out += body;
+    return true;
+}
+
+void HttpTransport::receive( const char *data, size_t length ){
+    m_Buffer.append( data, length );
+    for( ;; ){
+        if( !m_Status && !parseHeaders() ) return;
+        if( !parseBody() ) return;
+
+        bool close = m_Close;
+        finish();
+        if( close ) {
+            // The next request needs a new connection
+            restart( false );
+            return;
+        }
+    }
+}
+
+void HttpTransport::closedEvent(){
+    // A response without length ends with the connection
+    if( m_Status && m_ContentLength < 0 && !m_Chunked ) {
+        m_Body += m_Buffer;
+        finish();
+    }
+    m_Buffer.clear();
+    m_Body.clear();
+    m_Status = 0;
+    m_Close = false;
+    m_Remaining = UINT32_MAX;
+}
+
+uint32_t HttpTransport::depth() const {
+    // Nothing more is sent on a connection the board is about to close
+    if( m_Close ) return 0;
+    // The requests in flight count against the amount the board still serves on this connection
+    return m_KeepAlive ? std::min( Transport::depth(), m_Remaining ) : 1;
+}
+
+/**
+ * @brief Parse the status line and the headers of the response.
+ *
+ * @return false if they are not complete yet
+ */
+bool HttpTransport::parseHeaders(){
+    size_t end = m_Buffer.find( "\r\n\r\n" );
+    if( end == std::string::npos ) return false;
+
+    std::string headers = m_Buffer.substr( 0, end );
+    m_Buffer.erase( 0, end + 4 );
+
+    // HTTP/1.1 200 OK
+    size_t space = headers.find( ' ' );
+    m_Status = space == std::string::npos ? 500 : std::atoi( headers.c_str() + space + 1 );
+    bool http10 = headers.compare( 0, 8, "HTTP/1.0" ) == 0;
+    m_ContentLength = -1;
+    m_Chunked = false;
+    m_Close = http10;
+    m_Body.clear();
+
+    size_t start = headers.find( "\r\n" );
+    while( start != std::string::npos ){
+        start += 2;
+        size_t next = headers.find( "\r\n", start );
+        std::string line = headers.substr( start, next == std::string::npos ? std::string::npos : next - start );
+        size_t colon = line.find( ':' );
+        if( colon != std::string::npos ) {
+            std::string name = line.substr( 0, colon );
+            std::string value = line.substr( colon + 1 );
+            value.erase( 0, value.find_first_not_of( ' ' ) );
+            if( strcasecmp( name.c_str(), "Content-Length" ) == 0 ) m_ContentLength = std::atol( value.c_str() );
+            else if( strcasecmp( name.c_str(), "Transfer-Encoding" ) == 0 ) m_Chunked = strcasecmp( value.c_str(), "chunked" ) == 0;
+            else if( strcasecmp( name.c_str(), "Connection" ) == 0 ) m_Close = strcasecmp( value.c_str(), "close" ) == 0;
+            else if( strcasecmp( name.c_str(), "Keep-Alive" ) == 0 && value.find( "max=" ) != std::string::npos ) {
+                m_Remaining = std::strtoul( value.c_str() + value.find( "max=" ) + 4, nullptr, 10 );
+            }
+        }
+        start = next;
+    }
+    if( !m_Close ) m_KeepAlive = true;
+    return true;
+}
+
+/**
+ * @brief Parse the body of the response.
+ *
+ * @return false if it is not complete yet
+ */
+bool HttpTransport::parseBody(){
+    if( m_Chunked ) {
+        // Every chunk is its hexadecimal size, CRLF, the data and CRLF, a chunk of size 0 ends the body
+        for( ;; ){
+            size_t end = m_Buffer.find( "\r\n" );
+            if( end == std::string::npos ) return false;
+            size_t size = std::strtoul( m_Buffer.c_str(), nullptr, 16 );
+            if( size == 0 ) {
+                size_t trailer = m_Buffer.find( "\r\n\r\n" );
+                if( trailer == std::string::npos ) return false;
+                m_Buffer.erase( 0, trailer + 4 );
+                return true;
+            }
+            if( m_Buffer.size() < end + 2 + size + 2 ) return false;
+            m_Body.append( m_Buffer, end + 2, size );
+            m_Buffer.erase( 0, end + 2 + size + 2 );
+        }
+    }
+
+    if( m_ContentLength < 0 ) {
+        // The body ends when the board closes the connection
+        m_Body += m_Buffer;
+        m_Buffer.clear();
+        return false;
+    }
+    if( m_Buffer.size() < static_cast<size_t>( m_ContentLength ) ) return false;
+    m_Body = m_Buffer.substr( 0, m_ContentLength );
+    m_Buffer.erase( 0, m_ContentLength );
+    return true;
+}
+
+/**
+ * @brief Complete the oldest request with the parsed response.
+ */
+void HttpTransport::finish(){
+    int status = m_Status;
+    std::string body;
+    body.swap( m_Body );
+    m_Status = 0;
+    if( m_InFlight.empty() ) return;
+
+    uint16_t result = RESULT_SUCCESS;
+    if( status == 200 && m_InFlight.front().Kind == KIND_RESULT ) {
+        result = std::atoi( body.c_str() );
+        body.clear();
+    } else if( status == 400 && body.size() ) {
+        // A failed command is answered with its result code
+        result = std::atoi( body.c_str() );
+    } else if( status != 200 ) {
+        result = RESULT_HTTP;
+    }
+    complete( 0, result, body );
+}
+
+}
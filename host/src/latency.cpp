@@ -0,0 +1,158 @@
+/**
+ * @file latency.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "latency.h"
+#include <cstdio>
+
+namespace nodemcu {
+
+/**
+ * @brief Amount of buckets per power of two.
+ */
+#define LATENCY_SUB_BUCKETS 32
+
+/**
+ * @brief Amount of powers of two, enough for 2^40 us.
+ */
+#define LATENCY_RANGES 36
+
+/**
+ * @brief Construct a new Latency Histogram object
+ */
+LatencyHistogram::LatencyHistogram()
+: m_Buckets( LATENCY_SUB_BUCKETS * ( LATENCY_RANGES + 1 ), 0 )
+, m_Count( 0 )
+, m_Sum( 0 )
+, m_Max( 0 )
+{}
+
+/**
+ * @brief Add a latency.
+ *
+ * @param us the latency in microseconds
+ */
+void LatencyHistogram::record( uint64_t us ){
+    size_t index = bucket( us );
+    if( index >= m_Buckets.size() ) index = m_Buckets.size() - 1;
+    m_Buckets[index]++;
+    m_Count++;
+    m_Sum += us;
+    if( us > m_Max ) m_Max = us;
+}
+
+/**
+ * @brief Add the samples of another histogram.
+ */
+void LatencyHistogram::merge( const LatencyHistogram &other ){
+    for( size_t i = 0; i < m_Buckets.size(); i++ ) m_Buckets[i] += other.m_Buckets[i];
+    m_Count += other.m_Count;
+    m_Sum += other.m_Sum;
+    if( other.m_Max > m_Max ) m_Max = other.m_Max;
+}
+
+/**
+ * @brief Remove all samples.
+ */
+void LatencyHistogram::reset(){
+    m_Buckets.assign( m_Buckets.size(), 0 );
+    m_Count = 0;
+    m_Sum = 0;
+    m_Max = 0;
+}
+
+/**
+ * @brief Return the latency (in us) below which the given fraction of the samples is.
+ *
+ * @param fraction the fraction, for example 0.99 for p99
+ */
+uint64_t LatencyHistogram::percentile( double fraction ) const {
+    if( !m_Count ) return 0;
+    uint64_t rank = static_cast<uint64_t>( fraction * m_Count );
+    if( rank >= m_Count ) rank = m_Count - 1;
+
+    uint64_t seen = 0;
+    for( size_t i = 0; i < m_Buckets.size(); i++ ){
+        seen += m_Buckets[i];
+        if( seen > rank ) return upperBound( i ) < m_Max ? upperBound( i ) : m_Max;
+    }
+    return m_Max;
+}
+
+/**
+ * @brief Return the amount of samples.
+ */
+uint64_t LatencyHistogram::count() const {
+    return m_Count;
+}
+
+/**
+ * @brief Return the average latency in microseconds.
+ */
+uint64_t LatencyHistogram::mean() const {
+    return m_Count ? m_Sum / m_Count : 0;
+}
+
+/**
+ * @brief Return the largest latency in microseconds.
+ */
+uint64_t LatencyHistogram::max() const {
+    return m_Max;
+}
+
+/**
+ * @brief Return a one line summary: count, mean, p50, p99, p999 and max in milliseconds.
+ */
+std::string LatencyHistogram::summary() const {
+    char line[160];
+    snprintf( line, sizeof( line ), "n=%llu mean=%.3fms p50=%.3fms p99=%.3fms p999=%.3fms max=%.3fms",
+        static_cast<unsigned long long>( m_Count ), mean() / 1000.0, percentile( 0.5 ) / 1000.0,
+        percentile( 0.99 ) / 1000.0, percentile( 0.999 ) / 1000.0, m_Max / 1000.0 );
+    return line;
+}
+
+/**
+ * @brief Return the bucket of a latency.
+ */
+size_t LatencyHistogram::bucket( uint64_t us ){
+    // Latencies below 32 us have their own bucket, above that 32 buckets per power of two
+    if( us < LATENCY_SUB_BUCKETS ) return us;
+    int range = 63 - __builtin_clzll( us ) - 4;
+    return range * LATENCY_SUB_BUCKETS + ( us >> ( range - 1 ) ) - LATENCY_SUB_BUCKETS;
+}
+
+/**
+ * @brief Return the highest latency of a bucket.
+ */
+uint64_t LatencyHistogram::upperBound( size_t bucket ){
+    if( bucket < LATENCY_SUB_BUCKETS ) return bucket;
+    size_t range = bucket / LATENCY_SUB_BUCKETS;
+    uint64_t mantissa = bucket % LATENCY_SUB_BUCKETS + LATENCY_SUB_BUCKETS;
+    return ( ( mantissa + 1 ) << ( range - 1 ) ) - 1;
+}
+
+}
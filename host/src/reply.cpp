@@ -0,0 +1,79 @@
+/**
+ * @file reply.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "reply.h"
+#include <cstdio>
+
+namespace nodemcu {
+
+/**
+ * @brief Join a command and its arguments to a command line without newline.
+ */
+std::string joinCommand( const std::vector<std::string> &command ){
+    std::string line;
+    for( const std::string &arg: command ){
+        if( line.size() ) line += ' ';
+        line += arg;
+    }
+    return line;
+}
+
+/**
+ * @brief Split a command line into the command and its arguments.
+ */
+std::vector<std::string> splitCommand( const std::string &line ){
+    std::vector<std::string> command;
+    size_t start = 0;
+    while( start < line.size() ){
+        size_t end = line.find_first_of( " \r\n", start );
+        if( end == std::string::npos ) end = line.size();
+        if( end > start ) command.push_back( line.substr( start, end - start ) );
+        start = end + 1;
+    }
+    return command;
+}
+
+/**
+ * @brief Return a short name for a result code, for example "timeout" or "0xF100".
+ */
+std::string resultName( uint16_t result ){
+    switch( result ){
+    case RESULT_SUCCESS: return "ok";
+    case RESULT_BUSY: return "busy";
+    case RESULT_EVICTED: return "evicted";
+    case RESULT_DISCONNECTED: return "disconnected";
+    case RESULT_TIMEOUT: return "timeout";
+    case RESULT_UNSUPPORTED: return "unsupported";
+    default: break;
+    }
+    char name[8];
+    snprintf( name, sizeof( name ), "0x%04X", result );
+    return name;
+}
+
+}
@@ -0,0 +1,307 @@
+/**
+ * @file serialtransport.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "serialtransport.h"
+#include <algorithm>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace nodemcu {
+
+/**
+ * @brief The frame channels of the binary mode (SerialChannel in seriallink.h).
+ */
+enum Channel {
+    CHANNEL_COMMAND = 1,
+    CHANNEL_REPLY = 2,
+    CHANNEL_REPLY_DATA = 3,
+    CHANNEL_LOG = 4
+};
+
+/**
+ * @brief Calculate the CRC-16/CCITT-FALSE checksum (polynomial 0x1021, initial value 0xFFFF).
+ */
+static uint16_t crc16( const uint8_t *data, size_t length ){
+    uint16_t crc = 0xFFFF;
+    while( length-- ){
+        crc ^= static_cast<uint16_t>( *data++ ) << 8;
+        for( int i = 0; i < 8; i++ ) crc = crc & 0x8000 ? ( crc << 1 ) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+/**
+ * @brief COBS encode a packet and append it with the 0x00 delimiter.
+ */
+static void cobsEncode( const std::string &in, std::string &out ){
+    size_t codeIndex = out.size();
+    uint8_t code = 1;
+    out += '\0';
+    for( unsigned char c: in ){
+        if( c == 0 ) {
+            out[codeIndex] = code;
+            code = 1;
+            codeIndex = out.size();
+            out += '\0';
+        } else {
+            out += c;
+            if( ++code == 0xFF ) {
+                out[codeIndex] = code;
+                code = 1;
+                codeIndex = out.size();
+                out += '\0';
+            }
+        }
+    }
+    out[codeIndex] = code;
+    out += '\0';
+}
+
+/**
+ * @brief Decode a COBS encoded packet without delimiter.
+ *
+ * @return false if the encoding is invalid
+ */
+static bool cobsDecode( const std::string &in, std::string &out ){
+    size_t read = 0;
+    out.clear();
+    while( read < in.size() ){
+        uint8_t code = in[read++];
+        if( code == 0 || read + code - 1 > in.size() ) return false;
+        out.append( in, read, code - 1 );
+        read += code - 1;
+        if( code != 0xFF && read < in.size() ) out += '\0';
+    }
+    return true;
+}
+
+/**
+ * @brief Return the termios speed of a baud rate, B0 if it is not supported.
+ */
+static speed_t toSpeed( uint32_t baudRate ){
+    switch( baudRate ){
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+    case 460800: return B460800;
+    case 500000: return B500000;
+    case 921600: return B921600;
+    case 1000000: return B1000000;
+    case 1500000: return B1500000;
+    case 2000000: return B2000000;
+    case 3000000: return B3000000;
+    case 4000000: return B4000000;
+    default: return B0;
+    }
+}
+
+/**
+ * @brief Construct a new Serial Transport object
+ *
+ * @param loop the event loop that handles the connection
+ * @param device the serial device, for example /dev/ttyUSB0
+ * @param baudRate the baud rate of the text mode of the board
+ * @param binaryBaud the baud rate of the binary mode, 0 stays in text mode
+ * @param options the connection settings
+ */
+SerialTransport::SerialTransport( EventLoop *loop, const std::string &device, uint32_t baudRate, uint32_t binaryBaud, const Options &options )
+: Transport( loop, options )
+, m_Device( device )
+, m_BaudRate( baudRate )
+, m_BinaryBaud( binaryBaud )
+, m_Fd( -1 )
+, m_Binary( false )
+, m_Sequence( 0 )
+{}
+
+/**
+ * @brief Destroy the Serial Transport object
+ */
+SerialTransport::~SerialTransport(){
+    close();
+}
+
+/**
+ * @brief Return the serial device.
+ */
+std::string SerialTransport::address() const {
+    return m_Device;
+}
+
+int SerialTransport::open(){
+    m_Fd = ::open( m_Device.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC );
+    if( m_Fd < 0 ) return -1;
+
+    // Raw 8N1 without flow control
+    termios settings = {};
+    if( tcgetattr( m_Fd, &settings ) == 0 ) {
+        cfmakeraw( &settings );
+        settings.c_cflag |= CLOCAL | CREAD;
+        settings.c_cflag &= ~CRTSCTS;
+        tcsetattr( m_Fd, TCSANOW, &settings );
+    }
+    if( !setBaudRate( m_BaudRate ) ) {
+        ::close( m_Fd );
+        m_Fd = -1;
+        return m_Fd;
+    }
+
+    // Drop what the board sent while the port was closed, a late reply would be taken for the reply of the next command
+    tcflush( m_Fd, TCIFLUSH );
+    return m_Fd;
+}
+
+bool SerialTransport::encode( Request &request, std::string &out ){
+    if( !m_Binary ) {
+        out += joinCommand( request.Command );
+        out += '\n';
+        return true;
+    }
+
+    request.Sequence = m_Sequence++;
+    std::string packet;
+    packet += static_cast<char>( CHANNEL_COMMAND );
+    packet += static_cast<char>( request.Sequence );
+    packet += joinCommand( request.Command );
+    uint16_t crc = crc16( reinterpret_cast<const uint8_t*>( packet.data() ), packet.size() );
+    packet += static_cast<char>( crc >> 8 );
+    packet += static_cast<char>( crc & 0xFF );
+    m_ReplyData[request.Sequence].clear();
+    cobsEncode( packet, out );
+    return true;
+}
+
+void SerialTransport::receive( const char *data, size_t length ){
+    if( !m_Binary ) {
+        receiveLines( data, length );
+        return;
+    }
+    for( size_t i = 0; i < length; i++ ){
+        if( data[i] ) {
+            m_Frame += data[i];
+            continue;
+        }
+        if( m_Frame.size() ) handleFrame();
+        m_Frame.clear();
+    }
+}
+
+void SerialTransport::connectedEvent(){
+    m_Binary = false;
+    if( !m_BinaryBaud ) return;
+
+    // The switch is the first command, the board replies at the old baud rate and then changes it
+    Request request;
+    request.Command = { "serial", "binary", std::to_string( m_BinaryBaud ) };
+    request.Deadline = nowMs() + m_Options.TimeoutMs;
+    request.Done = [ this ]( const Reply &reply ){
+        if( reply.ok() && setBaudRate( m_BinaryBaud ) ) m_Binary = true;
+    };
+    m_Queue.push_front( std::move( request ) );
+}
+
+void SerialTransport::closedEvent(){
+    m_Fd = -1;
+    m_Binary = false;
+    m_Frame.clear();
+    m_LogLine.clear();
+}
+
+uint32_t SerialTransport::depth() const {
+    // Nothing else is sent while the mode changes, and frames have an 8 bit sequence number
+    if( m_BinaryBaud && !m_Binary ) return 1;
+    return std::min<uint32_t>( Transport::depth(), 255 );
+}
+
+bool SerialTransport::ordered() const {
+    return !m_Binary;
+}
+
+/**
+ * @brief Set the baud rate of the open port.
+ */
+bool SerialTransport::setBaudRate( uint32_t baudRate ){
+    speed_t speed = toSpeed( baudRate );
+    termios settings = {};
+    if( speed == B0 || tcgetattr( m_Fd, &settings ) != 0 ) return false;
+    cfsetispeed( &settings, speed );
+    cfsetospeed( &settings, speed );
+    return tcsetattr( m_Fd, TCSADRAIN, &settings ) == 0;
+}
+
+/**
+ * @brief Decode, check and handle a received frame.
+ */
+void SerialTransport::handleFrame(){
+    std::string packet;
+    if( !cobsDecode( m_Frame, packet ) || packet.size() < 4 ) return;
+    const uint8_t *bytes = reinterpret_cast<const uint8_t*>( packet.data() );
+    uint16_t crc = ( bytes[packet.size() - 2] << 8 ) | bytes[packet.size() - 1];
+    if( crc16( bytes, packet.size() - 2 ) != crc ) return;
+
+    uint8_t channel = bytes[0];
+    uint8_t sequence = bytes[1];
+    std::string payload = packet.substr( 2, packet.size() - 4 );
+
+    switch( channel ){
+    case CHANNEL_REPLY_DATA:
+        m_ReplyData[sequence] += payload;
+        break;
+    case CHANNEL_REPLY: {
+        if( payload.size() < 2 ) return;
+        uint16_t result = ( static_cast<uint8_t>( payload[0] ) << 8 ) | static_cast<uint8_t>( payload[1] );
+        std::string text = m_ReplyData[sequence] + payload.substr( 2 );
+        m_ReplyData[sequence].clear();
+        for( size_t i = 0; i < m_InFlight.size(); i++ ){
+            if( m_InFlight[i].Sequence != sequence ) continue;
+            complete( i, result, text );
+            break;
+        }
+        break;
+    }
+    case CHANNEL_LOG:
+        // Log frames are cut at any byte, lines are passed on when they are complete
+        for( char c: payload ){
+            if( c != '\n' ) {
+                m_LogLine += c;
+                continue;
+            }
+            if( OnLog ) OnLog( m_LogLine );
+            m_LogLine.clear();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+}
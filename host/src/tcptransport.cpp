@@ -0,0 +1,110 @@
+/**
+ * @file tcptransport.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "tcptransport.h"
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace nodemcu {
+
+/**
+ * @brief Open a non-blocking TCP connection.
+ *
+ * @param host the host name or IP address
+ * @param port the TCP port
+ * @return int the socket or -1 on failure
+ */
+int openTcpSocket( const std::string &host, uint16_t port ){
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *addresses = nullptr;
+    if( getaddrinfo( host.c_str(), std::to_string( port ).c_str(), &hints, &addresses ) != 0 ) return -1;
+
+    int fd = socket( addresses->ai_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 );
+    if( fd >= 0 ) {
+        // Commands are small, they should not wait for more data to fill a packet
+        int flag = 1;
+        setsockopt( fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof( flag ) );
+        if( connect( fd, addresses->ai_addr, addresses->ai_addrlen ) < 0 && errno != EINPROGRESS ) {
+            close( fd );
+            fd = -1;
+        }
+    }
+    freeaddrinfo( addresses );
+    return fd;
+}
+
+/**
+ * @brief Construct a new Tcp Transport object
+ *
+ * @param loop the event loop that handles the connection
+ * @param host the host name or IP address of the board
+ * @param port the TCP port of the board (ConfigControl::PortTCP)
+ * @param options the connection settings
+ */
+TcpTransport::TcpTransport( EventLoop *loop, const std::string &host, uint16_t port, const Options &options )
+: Transport( loop, options )
+, m_Host( host )
+, m_Port( port )
+{}
+
+/**
+ * @brief Destroy the Tcp Transport object
+ */
+TcpTransport::~TcpTransport(){
+    close();
+}
+
+/**
+ * @brief Return the board address as host:port.
+ */
+std::string TcpTransport::address() const {
+    return m_Host + ":" + std::to_string( m_Port );
+}
+
+int TcpTransport::open(){
+    return openTcpSocket( m_Host, m_Port );
+}
+
+bool TcpTransport::encode( Request &request, std::string &out ){
+    out += joinCommand( request.Command );
+    out += '\n';
+    return true;
+}
+
+void TcpTransport::receive( const char *data, size_t length ){
+    receiveLines( data, length );
+}
+
+}
@@ -0,0 +1,398 @@
+/**
+ * @file transport.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "transport.h"
+#include <algorithm>
+#include <cerrno>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace nodemcu {
+
+/**
+ * @brief Interval (in ms) of the timeout check.
+ */
+#define TRANSPORT_TICK 10
+
+/**
+ * @brief Construct a new Transport object
+ *
+ * @param loop the event loop that handles the connection
+ * @param options the connection settings
+ */
+Transport::Transport( EventLoop *loop, const Options &options )
+: m_Loop( loop )
+, m_Options( options )
+, m_Fd( -1 )
+, m_State( STATE_CLOSED )
+, m_Backoff( options.ReconnectMinMs )
+, m_ReconnectTimer( 0 )
+{
+    m_TickTimer = m_Loop->addTimer( TRANSPORT_TICK, TRANSPORT_TICK, [ this ](){ checkTimeouts(); } );
+}
+
+/**
+ * @brief Destroy the Transport object, fails the remaining commands.
+ */
+Transport::~Transport(){
+    m_Loop->cancelTimer( m_TickTimer );
+    close();
+}
+
+/**
+ * @brief Queue a command and connect if needed.
+ *
+ * @param request the command, Done is called with the reply
+ */
+void Transport::submit( Request request ){
+    if( !request.Deadline ) request.Deadline = nowMs() + m_Options.TimeoutMs;
+    m_Queue.push_back( std::move( request ) );
+    if( m_State == STATE_CLOSED ) connect();
+    else pump();
+}
+
+/**
+ * @brief Open the connection without waiting for the first command.
+ */
+void Transport::begin(){
+    if( m_State == STATE_CLOSED ) connect();
+}
+
+/**
+ * @brief Close the connection and fail all commands with RESULT_DISCONNECTED.
+ */
+void Transport::close(){
+    disconnect();
+    while( m_Queue.size() ){
+        Request request = std::move( m_Queue.front() );
+        m_Queue.pop_front();
+        fail( request, RESULT_DISCONNECTED );
+    }
+    if( m_ReconnectTimer ) m_Loop->cancelTimer( m_ReconnectTimer );
+    m_ReconnectTimer = 0;
+    m_State = STATE_CLOSED;
+}
+
+/**
+ * @brief Return true if the connection is up.
+ */
+bool Transport::connected() const {
+    return m_State == STATE_CONNECTED;
+}
+
+/**
+ * @brief Return the amount of commands that are queued or waiting for a reply.
+ */
+size_t Transport::pending() const {
+    return m_Queue.size() + m_InFlight.size();
+}
+
+/**
+ * @brief Return the counters of the transport.
+ */
+const TransportStats &Transport::stats() const {
+    return m_Stats;
+}
+
+/**
+ * @brief Called when the connection is up, before queued commands are sent.
+ */
+void Transport::connectedEvent(){}
+
+/**
+ * @brief Called when the connection has been closed.
+ */
+void Transport::closedEvent(){}
+
+/**
+ * @brief Return the amount of commands that may wait for a reply.
+ */
+uint32_t Transport::depth() const {
+    return m_Options.PipelineDepth ? m_Options.PipelineDepth : 1;
+}
+
+/**
+ * @brief Return true if replies arrive in the order the commands were sent.
+ * After a timeout an ordered stream can not be trusted anymore and is reconnected.
+ */
+bool Transport::ordered() const {
+    return true;
+}
+
+/**
+ * @brief Complete a command that has been sent.
+ *
+ * @param index the position of the command in the in flight list, 0 is the oldest
+ * @param result the result code
+ * @param text the reply text
+ */
+void Transport::complete( size_t index, uint16_t result, const std::string &text ){
+    if( index >= m_InFlight.size() ) return;
+    Request request = std::move( m_InFlight[index] );
+    m_InFlight.erase( m_InFlight.begin() + index );
+
+    Reply reply;
+    reply.Result = result;
+    reply.Text = text;
+    reply.LatencyUs = nowUs() - request.Sent;
+    m_Stats.Completed++;
+    if( request.Done ) request.Done( reply );
+    pump();
+}
+
+/**
+ * @brief Parse text lines, lines are collected until the result line "=XXXX" ends the reply.
+ * Lines starting with a log level prefix ("[I] ") are passed to OnLog.
+ */
+void Transport::receiveLines( const char *data, size_t length ){
+    for( size_t i = 0; i < length; i++ ){
+        char c = data[i];
+        if( c == '\r' ) continue;
+        if( c != '\n' ) {
+            m_Line += c;
+            continue;
+        }
+
+        if( m_Line.size() == 5 && m_Line[0] == '=' && m_Line.find_first_not_of( "0123456789ABCDEFabcdef", 1 ) == std::string::npos ) {
+            uint16_t result = std::strtoul( m_Line.c_str() + 1, nullptr, 16 );
+            std::string text;
+            text.swap( m_Text );
+            complete( 0, result, text );
+        } else if( m_Line.size() > 4 && m_Line[0] == '[' && m_Line[2] == ']' && m_Line[3] == ' ' ) {
+            if( OnLog ) OnLog( m_Line );
+        } else {
+            m_Text += m_Line;
+            m_Text += '\n';
+        }
+        m_Line.clear();
+    }
+}
+
+/**
+ * @brief Send bytes that are not part of a command.
+ */
+void Transport::send( const std::string &data ){
+    m_Out += data;
+    if( m_State == STATE_CONNECTED ) flush();
+}
+
+/**
+ * @brief Close the connection and reconnect.
+ *
+ * @param failure true to wait before reconnecting, false to reconnect right away
+ */
+void Transport::restart( bool failure ){
+    disconnect();
+    if( !m_Options.Reconnect ) {
+        close();
+        return;
+    }
+    if( !failure ) {
+        m_Backoff = m_Options.ReconnectMinMs;
+        if( m_Queue.size() ) connect();
+        return;
+    }
+
+    // Wait before the next attempt, the delay grows while the board can not be reached
+    m_State = STATE_WAITING;
+    if( m_ReconnectTimer ) m_Loop->cancelTimer( m_ReconnectTimer );
+    m_ReconnectTimer = m_Loop->addTimer( m_Backoff, 0, [ this ](){
+        m_ReconnectTimer = 0;
+        m_State = STATE_CLOSED;
+        if( m_Queue.size() ) connect();
+    });
+    m_Backoff = std::min( m_Backoff * 2, m_Options.ReconnectMaxMs );
+}
+
+/**
+ * @brief Send queued commands as far as the pipeline depth allows.
+ */
+void Transport::pump(){
+    if( m_State != STATE_CONNECTED ) return;
+
+    bool sent = false;
+    while( m_Queue.size() && m_InFlight.size() < depth() ){
+        Request request = std::move( m_Queue.front() );
+        m_Queue.pop_front();
+        if( !encode( request, m_Out ) ) {
+            fail( request, RESULT_UNSUPPORTED );
+            continue;
+        }
+        request.Sent = nowUs();
+        m_InFlight.push_back( std::move( request ) );
+        m_Stats.Sent++;
+        sent = true;
+    }
+    if( sent ) flush();
+}
+
+/**
+ * @brief Open the connection.
+ */
+void Transport::connect(){
+    m_Fd = open();
+    if( m_Fd < 0 ) {
+        restart( true );
+        return;
+    }
+    m_State = STATE_CONNECTING;
+    m_Loop->watch( m_Fd, EPOLLIN | EPOLLOUT | EPOLLRDHUP, [ this ]( uint32_t events ){ handleEvents( events ); } );
+}
+
+/**
+ * @brief Handle the events of the file descriptor.
+ */
+void Transport::handleEvents( uint32_t events ){
+    if( m_State == STATE_CONNECTING ) {
+        // A failed non-blocking connect reports its error when the socket becomes writable
+        int error = 0;
+        socklen_t size = sizeof( error );
+        if( getsockopt( m_Fd, SOL_SOCKET, SO_ERROR, &error, &size ) < 0 && errno != ENOTSOCK ) error = errno;
+        if( error || ( events & EPOLLERR ) ) {
+            restart( true );
+            return;
+        }
+        m_State = STATE_CONNECTED;
+        m_Backoff = m_Options.ReconnectMinMs;
+        m_Stats.Connects++;
+        m_Loop->modify( m_Fd, EPOLLIN | EPOLLRDHUP );
+        connectedEvent();
+        pump();
+        if( m_State != STATE_CONNECTED ) return;
+    }
+
+    if( events & ( EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR ) ) {
+        char buffer[4096];
+        for( ;; ){
+            ssize_t length = ::read( m_Fd, buffer, sizeof( buffer ) );
+            if( length > 0 ) {
+                m_Stats.BytesIn += length;
+                receive( buffer, length );
+                if( m_State != STATE_CONNECTED ) return;
+                continue;
+            }
+            if( length < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) ) break;
+            if( length < 0 && errno == EINTR ) continue;
+
+            // The board closed the connection or it failed
+            restart( m_InFlight.size() > 0 || length < 0 );
+            return;
+        }
+    }
+    if( events & EPOLLOUT ) flush();
+}
+
+/**
+ * @brief Write the output buffer as far as the socket accepts it.
+ */
+void Transport::flush(){
+    while( m_Out.size() ){
+        ssize_t length = ::write( m_Fd, m_Out.data(), m_Out.size() );
+        if( length < 0 ) {
+            if( errno == EINTR ) continue;
+            if( errno == EAGAIN || errno == EWOULDBLOCK ) break;
+            restart( true );
+            return;
+        }
+        m_Stats.BytesOut += length;
+        m_Out.erase( 0, length );
+    }
+    // Only wait for the socket to become writable while there is something to write
+    m_Loop->modify( m_Fd, m_Out.size() ? EPOLLIN | EPOLLOUT | EPOLLRDHUP : EPOLLIN | EPOLLRDHUP );
+}
+
+/**
+ * @brief Fail the commands whose deadline has passed.
+ */
+void Transport::checkTimeouts(){
+    uint64_t now = nowMs();
+    bool expired = false;
+    for( size_t i = 0; i < m_InFlight.size(); ){
+        if( m_InFlight[i].Deadline > now ) {
+            i++;
+            continue;
+        }
+        Request request = std::move( m_InFlight[i] );
+        m_InFlight.erase( m_InFlight.begin() + i );
+        m_Stats.Timeouts++;
+        fail( request, RESULT_TIMEOUT );
+        expired = true;
+    }
+    for( size_t i = 0; i < m_Queue.size(); ){
+        if( m_Queue[i].Deadline > now ) {
+            i++;
+            continue;
+        }
+        Request request = std::move( m_Queue[i] );
+        m_Queue.erase( m_Queue.begin() + i );
+        m_Stats.Timeouts++;
+        fail( request, RESULT_TIMEOUT );
+    }
+
+    // A late reply would be matched to the wrong command, so the stream is started over
+    if( expired && ordered() ) restart( true );
+    else if( expired ) pump();
+}
+
+/**
+ * @brief Close the file descriptor and fail the commands that have been sent.
+ */
+void Transport::disconnect(){
+    if( m_Fd >= 0 ) {
+        m_Loop->unwatch( m_Fd );
+        ::close( m_Fd );
+        m_Fd = -1;
+        m_Stats.Disconnects++;
+        closedEvent();
+    }
+    m_State = STATE_CLOSED;
+    m_Out.clear();
+    m_Text.clear();
+    m_Line.clear();
+
+    // The board may or may not have executed them, so they are not sent again
+    while( m_InFlight.size() ){
+        Request request = std::move( m_InFlight.front() );
+        m_InFlight.pop_front();
+        fail( request, RESULT_DISCONNECTED );
+    }
+}
+
+/**
+ * @brief Fail a command.
+ */
+void Transport::fail( Request &request, uint16_t result ){
+    Reply reply;
+    reply.Result = result;
+    if( request.Sent ) reply.LatencyUs = nowUs() - request.Sent;
+    m_Stats.Failed++;
+    if( request.Done ) request.Done( reply );
+}
+
+}
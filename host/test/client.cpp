@@ -0,0 +1,387 @@
+/**
+ * @file client.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "client.h"
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace nodemcu;
+
+/**
+ * @brief The ports of the simulated board, away from the defaults so a running simulator is not in the way.
+ */
+static const uint16_t TCP_PORT = 23000;
+static const uint16_t HTTP_PORT = 33000;
+static const uint16_t UDP_PORT = 43000;
+
+/**
+ * @brief Board result codes (include/command.h): unknown command, invalid pin,
+ * write to the analog input and no LED strip.
+ */
+static const uint16_t BOARD_ERROR = 0xFFFF;
+static const uint16_t BOARD_PIN_ERROR = 0xFA00;
+static const uint16_t BOARD_PIN_A0_ERROR = 0xFA0A;
+static const uint16_t BOARD_PIXELS_NOT_SET = 0xEE00;
+static const uint16_t BOARD_UDP_ERROR = 0xFCC7;
+
+/**
+ * @brief Time (in ms) a command may take, short enough for the timeout tests.
+ */
+static const uint32_t TIMEOUT_MS = 1000;
+
+/**
+ * @brief The counters of the checks.
+ */
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+/**
+ * @brief A running simulator process with one board.
+ */
+struct SimulatorProcess {
+    pid_t Pid = -1;
+    FILE *Output = nullptr;
+    std::string SerialDevice;
+};
+
+static void usage(){
+    printf( "usage: test-client SIMULATOR\n"
+            "  starts the simulator (pio run -e simulator, or make -C host test) with one board and tests the\n"
+            "  client library against it over TCP (port 23000), HTTP (port 33000) and its serial pseudo terminal\n" );
+}
+
+/**
+ * @brief Count a check and print it when it failed.
+ */
+static void check( bool condition, const std::string &transport, const std::string &name, const std::string &detail = "" ){
+    checks++;
+    if( condition ) return;
+    failures++;
+    printf( "FAIL %-7s %s %s\n", transport.c_str(), name.c_str(), detail.c_str() );
+}
+
+/**
+ * @brief Check the result code of a reply.
+ */
+static void expect( const Reply &reply, uint16_t result, const std::string &transport, const std::string &name ){
+    check( reply.Result == result, transport, name, "got " + resultName( reply.Result ) + ", expected " + resultName( result ) );
+}
+
+/**
+ * @brief Check the result code and the value of a read.
+ */
+static void expectValue( const Reply &reply, int value, const std::string &transport, const std::string &name ){
+    expect( reply, RESULT_SUCCESS, transport, name );
+    check( reply.ok() && reply.value() == value, transport, name, "read " + reply.Text + ", expected " + std::to_string( value ) );
+}
+
+/**
+ * @brief Start the simulator and wait until it printed the pseudo terminal of the board.
+ * D5 is a square wave of 100 ms for the subscriptions.
+ */
+static bool startSimulator( const char *path, SimulatorProcess &simulator ){
+    int output[2];
+    if( pipe( output ) < 0 ) return false;
+    std::string tcp = std::to_string( TCP_PORT ), http = std::to_string( HTTP_PORT ), udp = std::to_string( UDP_PORT );
+    simulator.Pid = fork();
+    if( simulator.Pid == 0 ) {
+        dup2( output[1], STDOUT_FILENO );
+        close( output[0] );
+        close( output[1] );
+        execl( path, path, "--tcp-port", tcp.c_str(), "--http-port", http.c_str(), "--udp-port", udp.c_str(),
+            "--serial-pty", "--pin", "D5=square:100", static_cast<char*>( nullptr ) );
+        _exit( 127 );
+    }
+    close( output[1] );
+    simulator.Output = fdopen( output[0], "r" );
+    char line[256];
+    while( simulator.Pid > 0 && fgets( line, sizeof( line ), simulator.Output ) ){
+        char device[200];
+        if( sscanf( line, "board 0 serial %199s", device ) == 1 ) {
+            simulator.SerialDevice = device;
+            return true;
+        }
+    }
+    fprintf( stderr, "simulator %s did not start\n", path );
+    return false;
+}
+
+/**
+ * @brief Stop the simulator, the connections of the clients are reset.
+ */
+static void stopSimulator( SimulatorProcess &simulator ){
+    if( simulator.Pid > 0 ) {
+        kill( simulator.Pid, SIGKILL );
+        waitpid( simulator.Pid, nullptr, 0 );
+    }
+    if( simulator.Output ) fclose( simulator.Output );
+    simulator = SimulatorProcess();
+}
+
+/**
+ * @brief Return true while the simulator runs, a board that crashed fails every later check.
+ */
+static bool running( SimulatorProcess &simulator ){
+    if( simulator.Pid <= 0 ) return false;
+    if( waitpid( simulator.Pid, nullptr, WNOHANG ) == 0 ) return true;
+    check( false, "", "the simulator ended" );
+    simulator.Pid = -1;
+    return false;
+}
+
+/**
+ * @brief Configure the pins and check the result codes, D2 is the output and D5 the input of the other tests.
+ */
+static void testConfigure( Client &board, const std::string &transport ){
+    expect( board.configurePin( "D2", "output" ).get(), RESULT_SUCCESS, transport, "config pin D2 output" );
+    expect( board.configurePin( "D5", "input" ).get(), RESULT_SUCCESS, transport, "config pin D5 input" );
+    expect( board.configurePin( "D9", "output" ).get(), BOARD_PIN_ERROR, transport, "config pin D9 output" );
+}
+
+/**
+ * @brief Write and read back an output, and check the errors of invalid pins and commands.
+ */
+static void testReadWrite( Client &board, const std::string &transport, bool http ){
+    expect( board.write( "D2", 1 ).get(), RESULT_SUCCESS, transport, "write D2 1" );
+    expectValue( board.read( "D2" ).get(), 1, transport, "read D2 after write 1" );
+    expect( board.write( { { "D2", 0 } } ).get(), RESULT_SUCCESS, transport, "write D2=0" );
+    expectValue( board.read( "D2" ).get(), 0, transport, "read D2 after write 0" );
+    expect( board.write( "A0", 1 ).get(), BOARD_PIN_A0_ERROR, transport, "write A0 1" );
+    expect( board.read( "D9" ).get(), BOARD_PIN_ERROR, transport, "read D9" );
+
+    // HTTP has no route for the other commands, the client does not send them
+    expect( board.command( "pixels" ).get(), http ? static_cast<uint16_t>( RESULT_UNSUPPORTED ) : BOARD_PIXELS_NOT_SET, transport, "pixels" );
+    if( !http ) expect( board.command( "bogus" ).get(), BOARD_ERROR, transport, "bogus" );
+}
+
+/**
+ * @brief Send a batch with a failing command in the middle, the replies are in the order of the commands.
+ */
+static void testBatch( Client &board, const std::string &transport ){
+    std::vector<Reply> replies = board.batch( { "write D2 1", "read D2", "read D9", "write D2 0", "read D2" } ).get();
+    check( replies.size() == 5, transport, "batch size" );
+    if( replies.size() != 5 ) return;
+    expect( replies[0], RESULT_SUCCESS, transport, "batch write D2 1" );
+    expectValue( replies[1], 1, transport, "batch read D2" );
+    expect( replies[2], BOARD_PIN_ERROR, transport, "batch read D9" );
+    expect( replies[3], RESULT_SUCCESS, transport, "batch write D2 0" );
+    expectValue( replies[4], 0, transport, "batch read D2" );
+}
+
+/**
+ * @brief Send writes and reads of D2 without waiting, every read has to see the write before it
+ * and the callbacks have to run in the order of the commands.
+ */
+static void testPipeline( Client &board, const std::string &transport ){
+    const size_t count = 64;
+    std::mutex lock;
+    std::vector<size_t> order;
+    std::vector<Reply> replies( count );
+    std::promise<void> done;
+    for( size_t i = 0; i < count; i++ ){
+        std::string line = i % 2 ? "read D2" : "write D2 " + std::to_string( i / 2 % 2 );
+        board.command( line, [ &, i ]( const Reply &reply ){
+            std::lock_guard<std::mutex> guard( lock );
+            replies[i] = reply;
+            order.push_back( i );
+            if( order.size() == count ) done.set_value();
+        } );
+    }
+    done.get_future().wait();
+
+    bool ordered = true;
+    for( size_t i = 0; i < count; i++ ) ordered = ordered && order[i] == i;
+    check( ordered, transport, "pipelined replies in order" );
+    for( size_t i = 1; i < count; i += 2 ){
+        expect( replies[i - 1], RESULT_SUCCESS, transport, "pipelined write " + std::to_string( i - 1 ) );
+        expectValue( replies[i], i / 2 % 2, transport, "pipelined read " + std::to_string( i ) );
+    }
+}
+
+/**
+ * @brief Subscribe to the square wave on D5, every callback has to report a change.
+ */
+static void testSubscribe( Client &board, const std::string &transport ){
+    std::mutex lock;
+    std::vector<int> values;
+    uint32_t id = board.subscribe( "D5", 10, [ & ]( const std::string &pin, int value ){
+        std::lock_guard<std::mutex> guard( lock );
+        if( pin == "D5" ) values.push_back( value );
+    } );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 600 ) );
+    board.unsubscribe( id );
+    while( board.pending() ) std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+
+    std::lock_guard<std::mutex> guard( lock );
+    bool changes = true;
+    for( size_t i = 1; i < values.size(); i++ ) changes = changes && values[i] != values[i - 1];
+    check( values.size() >= 5, transport, "subscribe D5", std::to_string( values.size() ) + " value(s) in 600 ms" );
+    check( changes, transport, "subscribe D5 reports changes only" );
+}
+
+/**
+ * @brief Stop the simulator while a command is sent, it has to time out. An ordered stream is
+ * reopened then and the next command succeeds.
+ */
+static void testTimeout( Client &board, const std::string &transport, SimulatorProcess &simulator, bool reopens ){
+    TransportStats before = board.stats();
+    kill( simulator.Pid, SIGSTOP );
+    std::future<Reply> reply = board.read( "D2" );
+    uint64_t start = nowMs();
+    expect( reply.get(), RESULT_TIMEOUT, transport, "timeout while the board is stopped" );
+    uint64_t elapsed = nowMs() - start;
+    check( elapsed >= TIMEOUT_MS - 100 && elapsed < TIMEOUT_MS + 500, transport, "timeout after Options::TimeoutMs", std::to_string( elapsed ) + " ms" );
+    kill( simulator.Pid, SIGCONT );
+
+    expect( board.read( "D2" ).get(), RESULT_SUCCESS, transport, "read after a timeout" );
+    TransportStats after = board.stats();
+    check( after.Timeouts == before.Timeouts + 1, transport, "timeout counted" );
+    if( reopens ) check( after.Connects > before.Connects, transport, "reconnect after a timeout" );
+}
+
+/**
+ * @brief Send a UDP read datagram of pin id 1 (D1) repeated, and return the reply.
+ *
+ * @param pins the amount of pins
+ * @param sequence the sequence number, the first datagram starts the sequence
+ */
+static std::string udpRead( int fd, size_t pins, uint16_t sequence ){
+    std::string packet = { 0x4E, sequence == 1 ? '\x02' : '\x00', static_cast<char>( sequence >> 8 ), static_cast<char>( sequence ), 0x02 };
+    packet.append( pins, 0x01 );
+    sockaddr_in board = {};
+    board.sin_family = AF_INET;
+    board.sin_port = htons( UDP_PORT );
+    board.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    sendto( fd, packet.data(), packet.size(), 0, reinterpret_cast<sockaddr*>( &board ), sizeof( board ) );
+
+    char reply[256];
+    pollfd poll = { fd, POLLIN, 0 };
+    if( ::poll( &poll, 1, TIMEOUT_MS ) <= 0 ) return std::string();
+    ssize_t length = recv( fd, reply, sizeof( reply ), 0 );
+    return length > 0 ? std::string( reply, length ) : std::string();
+}
+
+/**
+ * @brief Read the most pins a UDP datagram can carry, and more: the board has to answer the
+ * oversized read with the invalid datagram result instead of writing past its reply buffer.
+ */
+static void testUdp( Client &board ){
+    uint32_t failed = failures;
+    expect( board.configure( "udp-port", "334" ).get(), RESULT_SUCCESS, "udp", "config udp-port 334" );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+    int fd = socket( AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0 );
+    auto result = []( const std::string &reply ){ return reply.size() < 7 ? -1 : static_cast<uint8_t>( reply[5] ) << 8 | static_cast<uint8_t>( reply[6] ); };
+
+    std::string reply = udpRead( fd, 10, 1 );
+    check( reply.size() == 7 + 10 * 3 && result( reply ) == RESULT_SUCCESS, "udp", "read 10 pins", std::to_string( reply.size() ) + " bytes" );
+    reply = udpRead( fd, 32, 2 );
+    check( reply.size() == 7 && result( reply ) == BOARD_UDP_ERROR, "udp", "read 32 pins is invalid", std::to_string( reply.size() ) + " bytes" );
+    reply = udpRead( fd, 1, 3 );
+    check( reply.size() == 7 + 3 && result( reply ) == RESULT_SUCCESS, "udp", "read after the oversized read" );
+    close( fd );
+    printf( "%-4s udp\n", failed == failures ? "ok" : "FAIL" );
+}
+
+/**
+ * @brief Run the tests of one transport.
+ */
+static void testTransport( std::unique_ptr<Client> board, const std::string &transport, SimulatorProcess &simulator, bool http, bool reopens ){
+    uint32_t failed = failures;
+    testConfigure( *board, transport );
+    testReadWrite( *board, transport, http );
+    testBatch( *board, transport );
+    testPipeline( *board, transport );
+    testSubscribe( *board, transport );
+    testTimeout( *board, transport, simulator, reopens );
+    printf( "%-4s %s\n", failed == failures ? "ok" : "FAIL", transport.c_str() );
+}
+
+/**
+ * @brief Restart the simulator under connected clients: the command in flight fails with
+ * RESULT_DISCONNECTED and the clients reconnect to the new board on their own.
+ * The timeout has to cover the reconnect delay, which grows while the board is away.
+ */
+static void testReconnect( const char *path, SimulatorProcess &simulator, const Options &options ){
+    uint32_t failed = failures;
+    std::unique_ptr<Client> boards[] = { Client::tcp( "127.0.0.1", TCP_PORT, options ), Client::http( "127.0.0.1", HTTP_PORT, options ) };
+    const char *names[] = { "tcp", "http" };
+    for( size_t i = 0; i < 2; i++ ) expect( boards[i]->read( "A0" ).get(), RESULT_SUCCESS, names[i], "read before the restart" );
+
+    kill( simulator.Pid, SIGSTOP );
+    std::future<Reply> inFlight[] = { boards[0]->read( "A0" ), boards[1]->read( "A0" ) };
+    std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+    stopSimulator( simulator );
+    for( size_t i = 0; i < 2; i++ ) expect( inFlight[i].get(), RESULT_DISCONNECTED, names[i], "read while the board goes away" );
+
+    if( !startSimulator( path, simulator ) ) {
+        check( false, "tcp", "restart the simulator" );
+        return;
+    }
+    for( size_t i = 0; i < 2; i++ ){
+        expect( boards[i]->read( "A0" ).get(), RESULT_SUCCESS, names[i], "read after the restart" );
+        TransportStats stats = boards[i]->stats();
+        check( stats.Connects >= 2 && stats.Disconnects >= 1, names[i], "reconnect after the restart",
+            std::to_string( stats.Connects ) + " connect(s), " + std::to_string( stats.Disconnects ) + " disconnect(s)" );
+    }
+    printf( "%-4s reconnect\n", failed == failures ? "ok" : "FAIL" );
+}
+
+int main( int argc, char **argv ){
+    if( argc != 2 ) {
+        usage();
+        return 1;
+    }
+    signal( SIGPIPE, SIG_IGN );
+    SimulatorProcess simulator;
+    if( !startSimulator( argv[1], simulator ) ) return 1;
+
+    Options options;
+    options.TimeoutMs = TIMEOUT_MS;
+    Options reconnect;
+    reconnect.TimeoutMs = 5000;
+
+    // The board keeps its pins between the transports, binary serial comes last since the board stays in binary mode
+    testUdp( *Client::tcp( "127.0.0.1", TCP_PORT, options ) );
+    if( running( simulator ) ) testTransport( Client::tcp( "127.0.0.1", TCP_PORT, options ), "tcp", simulator, false, true );
+    if( running( simulator ) ) testTransport( Client::http( "127.0.0.1", HTTP_PORT, options ), "http", simulator, true, true );
+    if( running( simulator ) ) testTransport( Client::serial( simulator.SerialDevice, 115200, 0, options ), "serial", simulator, false, true );
+    if( running( simulator ) ) testTransport( Client::serial( simulator.SerialDevice, 115200, 460800, options ), "binary", simulator, false, false );
+    if( running( simulator ) ) testReconnect( argv[1], simulator, reconnect );
+
+    stopSimulator( simulator );
+    printf( "%u check(s), %u failed\n", checks, failures );
+    return failures ? 2 : 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file bench.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "client.h"
+#include "latency.h"
+#include <cstdio>
+#include <cstring>
+
+using namespace nodemcu;
+
+/**
+ * @brief The benchmark settings.
+ */
+struct BenchConfig {
+    std::string Transport = "tcp";
+    std::string Address;
+    uint32_t BinaryBaud = 0;
+    uint64_t Requests = 10000;
+    uint32_t Depth = 16;
+    uint32_t Connections = 1;
+    std::string Command = "read D1";
+    Options Connection;
+};
+
+/**
+ * @brief The state of one benchmark connection.
+ */
+struct BenchClient {
+    std::unique_ptr<Client> Board;
+    LatencyHistogram Latency;
+    uint64_t Errors = 0;
+};
+
+static void usage(){
+    printf( "usage: nodemcu-bench (--tcp HOST[:PORT] | --http HOST[:PORT] | --serial DEVICE[:BAUD]) [options]\n"
+            "  --binary BAUD     use the binary serial mode\n"
+            "  -n REQUESTS       total amount of commands (10000)\n"
+            "  -d DEPTH          commands in flight per connection (16)\n"
+            "  -c CONNECTIONS    parallel connections (1)\n"
+            "  -C COMMAND        command line to send (\"read D1\")\n"
+            "  -t TIMEOUT        command timeout in ms (2000)\n" );
+}
+
+/**
+ * @brief Split HOST:PORT or DEVICE:BAUD, the number is left unchanged if there is none.
+ */
+static std::string splitAddress( const std::string &address, uint32_t &number ){
+    size_t colon = address.rfind( ':' );
+    if( colon == std::string::npos ) return address;
+    number = std::strtoul( address.c_str() + colon + 1, nullptr, 10 );
+    return address.substr( 0, colon );
+}
+
+static std::unique_ptr<Client> connectBoard( const BenchConfig &config, EventLoop *loop ){
+    uint32_t number = 0;
+    if( config.Transport == "http" ) {
+        number = 80;
+        std::string host = splitAddress( config.Address, number );
+        return Client::http( host, number, config.Connection, loop );
+    }
+    if( config.Transport == "serial" ) {
+        number = 115200;
+        std::string device = splitAddress( config.Address, number );
+        return Client::serial( device, number, config.BinaryBaud, config.Connection, loop );
+    }
+    number = 333;
+    std::string host = splitAddress( config.Address, number );
+    return Client::tcp( host, number, config.Connection, loop );
+}
+
+int main( int argc, char **argv ){
+    BenchConfig config;
+    for( int i = 1; i < argc; i++ ){
+        std::string arg = argv[i];
+        bool value = i + 1 < argc;
+        if( ( arg == "--tcp" || arg == "--http" || arg == "--serial" ) && value ) {
+            config.Transport = arg.substr( 2 );
+            config.Address = argv[++i];
+        }
+        else if( arg == "--binary" && value ) config.BinaryBaud = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "-n" && value ) config.Requests = std::strtoull( argv[++i], nullptr, 10 );
+        else if( arg == "-d" && value ) config.Depth = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "-c" && value ) config.Connections = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "-C" && value ) config.Command = argv[++i];
+        else if( arg == "-t" && value ) config.Connection.TimeoutMs = std::strtoul( argv[++i], nullptr, 10 );
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if( config.Address.empty() || !config.Depth || !config.Connections ) {
+        usage();
+        return 1;
+    }
+    config.Connection.PipelineDepth = config.Depth;
+
+    // All connections share one loop thread, the commands are sent from the reply callbacks
+    EventLoop loop;
+    loop.start();
+    std::vector<BenchClient> clients( config.Connections );
+    for( BenchClient &client: clients ) client.Board = connectBoard( config, &loop );
+
+    // Warm up, so the connect time is not part of the measurement
+    for( BenchClient &client: clients ) client.Board->command( config.Command ).wait();
+
+    std::promise<void> finished;
+    uint64_t started = 0;
+    uint64_t completed = 0;
+    uint64_t begin = nowUs();
+    std::function<void( BenchClient* )> next = [ & ]( BenchClient *client ){
+        if( started >= config.Requests ) return;
+        started++;
+        client->Board->command( config.Command, [ &, client ]( const Reply &reply ){
+            if( reply.ok() ) client->Latency.record( reply.LatencyUs );
+            else client->Errors++;
+            if( ++completed == config.Requests ) finished.set_value();
+            next( client );
+        });
+    };
+    loop.post( [ & ](){
+        for( BenchClient &client: clients ){
+            for( uint32_t i = 0; i < config.Depth; i++ ) next( &client );
+        }
+    });
+    finished.get_future().wait();
+    double seconds = ( nowUs() - begin ) / 1e6;
+
+    LatencyHistogram total;
+    uint64_t errors = 0;
+    for( BenchClient &client: clients ){
+        total.merge( client.Latency );
+        errors += client.Errors;
+    }
+    printf( "%s %s, %u connection(s), depth %u, command \"%s\"\n", config.Transport.c_str(), config.Address.c_str(),
+        config.Connections, config.Depth, config.Command.c_str() );
+    printf( "%llu commands in %.3fs: %.0f commands/s, %llu errors\n", static_cast<unsigned long long>( config.Requests ),
+        seconds, config.Requests / seconds, static_cast<unsigned long long>( errors ) );
+    printf( "latency %s\n", total.summary().c_str() );
+
+    clients.clear();
+    loop.stop();
+    return errors ? 2 : 0;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file fleet.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "fleet.h"
+#include "latency.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+using namespace nodemcu;
+
+/**
+ * @brief The fleet settings.
+ */
+struct FleetConfig {
+    std::vector<std::string> Boards;
+    std::vector<std::string> Lines;
+    uint32_t Runs = 1;
+    bool Quiet = false;
+    FleetOptions Fleet;
+};
+
+static void usage(){
+    printf( "usage: nodemcu-fleet [options] BOARD...\n"
+            "  BOARD                HOST[:PORT] or HOST:FIRST-LAST for a range of ports (port 333)\n"
+            "  -f FILE              read the boards from a file, one per line\n"
+            "  -e COMMAND           command line to send to every board, may be repeated\n"
+            "  --read PINS          read pins on every board, comma separated\n"
+            "  --concurrency N      boards that run commands at the same time, 0 for all (0)\n"
+            "  --retries N          retries of commands that timed out or lost the connection (2)\n"
+            "  --timeout MS         command timeout (2000)\n"
+            "  -n RUNS              send the commands RUNS times over the same connections (1)\n"
+            "  -q                   only print the summary, not the table\n" );
+}
+
+/**
+ * @brief Add a board or a range of boards, HOST[:PORT] or HOST:FIRST-LAST.
+ *
+ * @return false if the address is not valid
+ */
+static bool addBoards( const std::string &address, std::vector<std::string> &boards ){
+    size_t colon = address.rfind( ':' );
+    size_t dash = address.find( '-', colon == std::string::npos ? 0 : colon );
+    if( colon == std::string::npos || dash == std::string::npos ) {
+        boards.push_back( address );
+        return !address.empty();
+    }
+    uint32_t first = std::strtoul( address.c_str() + colon + 1, nullptr, 10 );
+    uint32_t last = std::strtoul( address.c_str() + dash + 1, nullptr, 10 );
+    if( !first || last < first || last > 65535 ) return false;
+    for( uint32_t port = first; port <= last; port++ ) boards.push_back( address.substr( 0, colon + 1 ) + std::to_string( port ) );
+    return true;
+}
+
+/**
+ * @brief Split a comma separated list.
+ */
+static std::vector<std::string> splitList( const std::string &list ){
+    std::vector<std::string> items;
+    size_t start = 0;
+    while( start <= list.size() ){
+        size_t end = list.find( ',', start );
+        if( end == std::string::npos ) end = list.size();
+        if( end > start ) items.push_back( list.substr( start, end - start ) );
+        start = end + 1;
+    }
+    return items;
+}
+
+int main( int argc, char **argv ){
+    FleetConfig config;
+    for( int i = 1; i < argc; i++ ){
+        std::string arg = argv[i];
+        bool value = i + 1 < argc;
+        if( arg == "-e" && value ) config.Lines.push_back( argv[++i] );
+        else if( arg == "--read" && value ) {
+            for( const std::string &pin: splitList( argv[++i] ) ) config.Lines.push_back( "read " + pin );
+        }
+        else if( arg == "--concurrency" && value ) config.Fleet.Concurrency = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--retries" && value ) config.Fleet.Retries = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--timeout" && value ) config.Fleet.Connection.TimeoutMs = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "-n" && value ) config.Runs = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "-q" ) config.Quiet = true;
+        else if( arg == "-f" && value ) {
+            std::ifstream file( argv[++i] );
+            std::string line;
+            if( !file ) {
+                fprintf( stderr, "can not open %s\n", argv[i] );
+                return 1;
+            }
+            while( std::getline( file, line ) ){
+                line = line.substr( 0, line.find( '#' ) );
+                line.erase( 0, line.find_first_not_of( " \t\r" ) );
+                line.erase( line.find_last_not_of( " \t\r" ) + 1 );
+                if( line.size() && !addBoards( line, config.Boards ) ) {
+                    fprintf( stderr, "invalid board: %s\n", line.c_str() );
+                    return 1;
+                }
+            }
+        }
+        else if( arg[0] != '-' && addBoards( arg, config.Boards ) ) continue;
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if( config.Boards.empty() || config.Lines.empty() || !config.Runs ) {
+        usage();
+        return 1;
+    }
+
+    Fleet fleet( config.Fleet );
+    uint64_t start = nowUs();
+    for( const std::string &board: config.Boards ){
+        size_t colon = board.rfind( ':' );
+        uint16_t port = colon == std::string::npos ? 333 : std::strtoul( board.c_str() + colon + 1, nullptr, 10 );
+        fleet.add( board.substr( 0, colon ), port );
+    }
+
+    // The connections open in parallel, wait for them so the runs only measure the commands
+    while( fleet.connected() < fleet.size() && nowUs() - start < config.Fleet.Connection.TimeoutMs * 1000ull ){
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+    printf( "connected %zu of %zu board(s) in %.3f ms\n", fleet.connected(), fleet.size(), ( nowUs() - start ) / 1000.0 );
+
+    std::vector<BoardResult> results;
+    for( uint32_t run = 0; run < config.Runs; run++ ){
+        start = nowUs();
+        results = fleet.run( config.Lines ).get();
+        uint64_t elapsed = nowUs() - start;
+
+        LatencyHistogram latency;
+        size_t failed = 0;
+        uint32_t retries = 0;
+        for( const BoardResult &result: results ){
+            latency.record( result.LatencyUs );
+            if( !result.ok() ) failed++;
+            retries += result.Attempts - 1;
+        }
+        printf( "run %u: %.3f ms, %zu ok, %zu failed, %u retries, board latency p50 %.3f p99 %.3f max %.3f ms\n",
+            run + 1, elapsed / 1000.0, results.size() - failed, failed, retries,
+            latency.percentile( 0.5 ) / 1000.0, latency.percentile( 0.99 ) / 1000.0, latency.max() / 1000.0 );
+    }
+    if( !config.Quiet ) printf( "\n%s", formatTable( config.Lines, results ).c_str() );
+
+    for( const BoardResult &result: results ) if( !result.ok() ) return 2;
+    return 0;
+}
@@ -0,0 +1,331 @@
+/**
+ * @file load.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "client.h"
+#include "latency.h"
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+using namespace nodemcu;
+
+/**
+ * @brief The kinds of generated commands.
+ */
+enum LoadKind {
+    LOAD_READ = 0,
+    LOAD_WRITE,
+    LOAD_CONFIG,
+    LOAD_KIND_COUNT
+};
+
+static const char *kindNames[LOAD_KIND_COUNT] = { "read", "write", "config" };
+
+/**
+ * @brief The load settings.
+ */
+struct LoadConfig {
+    std::string Transport = "tcp";
+    std::string Address;
+    uint32_t Connections = 12;
+    uint32_t Depth = 4;
+    double Rate = 0;
+    double Seconds = 10;
+    double Interval = 1;
+    uint32_t Mix[LOAD_KIND_COUNT] = { 100, 0, 0 };
+    std::vector<std::string> ReadPins = { "A0" };
+    std::vector<std::string> WritePins;
+    bool Setup = false;
+    Options Connection;
+};
+
+/**
+ * @brief The counters of a measuring interval, or of the whole run.
+ */
+struct LoadCounters {
+    LatencyHistogram Latency;
+    uint64_t Sent = 0;
+    uint64_t Ok = 0;
+    uint64_t Timeouts = 0;
+    uint64_t Disconnected = 0;
+    uint64_t Rejected = 0;
+    uint64_t Failed = 0;
+    uint64_t Late = 0;
+    uint64_t Kinds[LOAD_KIND_COUNT] = {};
+    std::map<uint16_t, uint64_t> Results;
+
+    void merge( const LoadCounters &other ){
+        Latency.merge( other.Latency );
+        Sent += other.Sent;
+        Ok += other.Ok;
+        Timeouts += other.Timeouts;
+        Disconnected += other.Disconnected;
+        Rejected += other.Rejected;
+        Failed += other.Failed;
+        Late += other.Late;
+        for( int i = 0; i < LOAD_KIND_COUNT; i++ ) Kinds[i] += other.Kinds[i];
+        for( const auto &result: other.Results ) Results[result.first] += result.second;
+    }
+};
+
+/**
+ * @brief One load connection.
+ */
+struct LoadClient {
+    std::unique_ptr<Client> Board;
+    uint32_t InFlight = 0;
+};
+
+static void usage(){
+    printf( "usage: nodemcu-load (--tcp HOST[:PORT] | --http HOST[:PORT]) [options]\n"
+            "  -c CONNECTIONS       parallel connections (12)\n"
+            "  -d DEPTH             commands in flight per connection (4)\n"
+            "  -r RATE              target commands/s over all connections, 0 sends as fast as possible (0)\n"
+            "  -t SECONDS           duration of the run (10)\n"
+            "  -i SECONDS           report interval, 0 only reports the total (1)\n"
+            "  --mix R,W,C          percentage of read, write and config show commands (100,0,0)\n"
+            "  --read-pins PINS     pins to read, comma separated (A0)\n"
+            "  --write-pins PINS    pins to write, comma separated\n"
+            "  --setup              configure the write pins as output first\n"
+            "  --timeout MS         command timeout (2000)\n" );
+}
+
+/**
+ * @brief Split a comma separated list.
+ */
+static std::vector<std::string> splitList( const std::string &list ){
+    std::vector<std::string> items;
+    size_t start = 0;
+    while( start <= list.size() ){
+        size_t end = list.find( ',', start );
+        if( end == std::string::npos ) end = list.size();
+        if( end > start ) items.push_back( list.substr( start, end - start ) );
+        start = end + 1;
+    }
+    return items;
+}
+
+/**
+ * @brief Split HOST:PORT, the port is left unchanged if there is none.
+ */
+static std::string splitAddress( const std::string &address, uint32_t &port ){
+    size_t colon = address.rfind( ':' );
+    if( colon == std::string::npos ) return address;
+    port = std::strtoul( address.c_str() + colon + 1, nullptr, 10 );
+    return address.substr( 0, colon );
+}
+
+/**
+ * @brief Print the counters of an interval or of the whole run on one line.
+ */
+static void printCounters( const char *label, const LoadCounters &counters, double seconds ){
+    printf( "%-8s %8.0f cmd/s  ok %-8llu err %-6llu timeout %-6llu disc %-6llu busy %-6llu late %-6llu  p50 %.3f p99 %.3f p999 %.3f max %.3f ms\n",
+        label, counters.Ok / seconds, static_cast<unsigned long long>( counters.Ok ),
+        static_cast<unsigned long long>( counters.Failed ), static_cast<unsigned long long>( counters.Timeouts ),
+        static_cast<unsigned long long>( counters.Disconnected ), static_cast<unsigned long long>( counters.Rejected ),
+        static_cast<unsigned long long>( counters.Late ),
+        counters.Latency.percentile( 0.5 ) / 1000.0, counters.Latency.percentile( 0.99 ) / 1000.0,
+        counters.Latency.percentile( 0.999 ) / 1000.0, counters.Latency.max() / 1000.0 );
+    fflush( stdout );
+}
+
+int main( int argc, char **argv ){
+    LoadConfig config;
+    for( int i = 1; i < argc; i++ ){
+        std::string arg = argv[i];
+        bool value = i + 1 < argc;
+        if( ( arg == "--tcp" || arg == "--http" ) && value ) {
+            config.Transport = arg.substr( 2 );
+            config.Address = argv[++i];
+        }
+        else if( arg == "-c" && value ) config.Connections = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "-d" && value ) config.Depth = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "-r" && value ) config.Rate = std::atof( argv[++i] );
+        else if( arg == "-t" && value ) config.Seconds = std::atof( argv[++i] );
+        else if( arg == "-i" && value ) config.Interval = std::atof( argv[++i] );
+        else if( arg == "--read-pins" && value ) config.ReadPins = splitList( argv[++i] );
+        else if( arg == "--write-pins" && value ) config.WritePins = splitList( argv[++i] );
+        else if( arg == "--setup" ) config.Setup = true;
+        else if( arg == "--timeout" && value ) config.Connection.TimeoutMs = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--mix" && value ) {
+            std::vector<std::string> mix = splitList( argv[++i] );
+            for( int kind = 0; kind < LOAD_KIND_COUNT; kind++ ) config.Mix[kind] = kind < (int) mix.size() ? std::strtoul( mix[kind].c_str(), nullptr, 10 ) : 0;
+        }
+        else {
+            usage();
+            return 1;
+        }
+    }
+    uint32_t mixTotal = config.Mix[LOAD_READ] + config.Mix[LOAD_WRITE] + config.Mix[LOAD_CONFIG];
+    if( config.Address.empty() || !config.Connections || !config.Depth || !mixTotal || config.Seconds <= 0
+        || ( config.Mix[LOAD_READ] && config.ReadPins.empty() ) || ( config.Mix[LOAD_WRITE] && config.WritePins.empty() ) ) {
+        usage();
+        return 1;
+    }
+    // The transport may pipeline deeper than the tool, it never has more than Depth commands
+    config.Connection.PipelineDepth = config.Depth;
+
+    EventLoop loop;
+    loop.start();
+    uint32_t port = config.Transport == "http" ? 80 : 333;
+    std::string host = splitAddress( config.Address, port );
+    std::vector<LoadClient> clients( config.Connections );
+    for( LoadClient &client: clients ){
+        client.Board = config.Transport == "http" ? Client::http( host, port, config.Connection, &loop )
+                                                  : Client::tcp( host, port, config.Connection, &loop );
+    }
+    if( config.Setup ) {
+        for( const std::string &pin: config.WritePins ){
+            Reply reply = clients[0].Board->configurePin( pin, "output" ).get();
+            if( !reply.ok() ) printf( "setup of %s failed: %s\n", pin.c_str(), resultName( reply.Result ).c_str() );
+        }
+    }
+
+    // Everything below runs on the loop thread, the main thread only waits for the end
+    std::mt19937 random( 1 );
+    LoadCounters interval;
+    LoadCounters total;
+    uint64_t issued = 0;
+    uint64_t writes = 0;
+    size_t nextClient = 0;
+    uint64_t begin = 0;
+    uint64_t intervalStart = 0;
+    bool stopping = false;
+    bool done = false;
+    std::promise<void> finished;
+
+    // Pick a command by the mix, writes toggle their pin so the output really changes
+    auto nextCommand = [ & ]( LoadKind &kind ){
+        uint32_t pick = random() % mixTotal;
+        kind = pick < config.Mix[LOAD_READ] ? LOAD_READ : pick < config.Mix[LOAD_READ] + config.Mix[LOAD_WRITE] ? LOAD_WRITE : LOAD_CONFIG;
+        if( kind == LOAD_READ ) return "read " + config.ReadPins[ random() % config.ReadPins.size() ];
+        if( kind == LOAD_WRITE ) {
+            writes++;
+            return "write " + config.WritePins[ writes % config.WritePins.size() ] + " " + std::to_string( writes / config.WritePins.size() % 2 );
+        }
+        return std::string( "config show" );
+    };
+
+    std::function<bool( uint64_t )> issue;
+    issue = [ & ]( uint64_t intended ){
+        // Round robin over the connections that have room
+        LoadClient *client = nullptr;
+        for( uint32_t i = 0; i < clients.size() && !client; i++ ){
+            LoadClient &candidate = clients[ ( nextClient + i ) % clients.size() ];
+            if( candidate.InFlight < config.Depth ) client = &candidate;
+        }
+        if( !client ) return false;
+        nextClient = ( client - clients.data() + 1 ) % clients.size();
+
+        LoadKind kind;
+        std::string line = nextCommand( kind );
+        client->InFlight++;
+        interval.Sent++;
+        interval.Kinds[kind]++;
+        client->Board->command( line, [ &, client, intended ]( const Reply &reply ){
+            client->InFlight--;
+            interval.Results[ reply.Result ]++;
+            if( reply.Result == RESULT_TIMEOUT ) interval.Timeouts++;
+            else if( reply.Result == RESULT_DISCONNECTED ) interval.Disconnected++;
+            else if( reply.Result == RESULT_BUSY || reply.Result == RESULT_EVICTED ) interval.Rejected++;
+            else if( reply.Result != RESULT_SUCCESS ) interval.Failed++;
+            else {
+                interval.Ok++;
+                // Measured from the intended send time, so a board that falls behind shows in the latency
+                interval.Latency.record( nowUs() - intended );
+            }
+            if( !config.Rate && !stopping ) issue( nowUs() );
+        });
+        return true;
+    };
+
+    loop.post( [ & ](){
+        begin = intervalStart = nowUs();
+        if( !config.Rate ) {
+            for( uint32_t i = 0; i < config.Connections * config.Depth; i++ ) issue( begin );
+        }
+
+        loop.addTimer( 1, 1, [ & ](){
+            if( done ) return;
+            uint64_t now = nowUs();
+            if( config.Rate && !stopping ) {
+                // Commands that can not be sent because every connection is full are counted as late and skipped
+                uint64_t due = static_cast<uint64_t>( ( now - begin ) * config.Rate / 1e6 );
+                for( ; issued < due; issued++ ){
+                    if( !issue( begin + static_cast<uint64_t>( issued * 1e6 / config.Rate ) ) ) interval.Late++;
+                }
+            }
+
+            bool ended = now - begin >= config.Seconds * 1e6;
+            if( ( config.Interval > 0 && now - intervalStart >= config.Interval * 1e6 ) || ( ended && !stopping ) ) {
+                char label[16];
+                snprintf( label, sizeof( label ), "%.0fs", ( now - begin ) / 1e6 );
+                if( config.Interval > 0 ) printCounters( label, interval, ( now - intervalStart ) / 1e6 );
+                total.merge( interval );
+                interval = LoadCounters();
+                intervalStart = now;
+            }
+
+            // After the duration the commands in flight are completed, they are not part of the result
+            if( ended ) stopping = true;
+            bool idle = true;
+            for( LoadClient &client: clients ) idle = idle && !client.InFlight;
+            if( stopping && idle ) {
+                done = true;
+                finished.set_value();
+            }
+        });
+    });
+    finished.get_future().wait();
+
+    printf( "%s %s, %u connection(s), depth %u, rate %s, mix read %u%% write %u%% config %u%%\n",
+        config.Transport.c_str(), config.Address.c_str(), config.Connections, config.Depth,
+        config.Rate ? std::to_string( static_cast<uint64_t>( config.Rate ) ).c_str() : "max",
+        config.Mix[LOAD_READ], config.Mix[LOAD_WRITE], config.Mix[LOAD_CONFIG] );
+    printCounters( "total", total, config.Seconds );
+    printf( "sent %llu (", static_cast<unsigned long long>( total.Sent ) );
+    for( int kind = 0; kind < LOAD_KIND_COUNT; kind++ ){
+        printf( "%s%s %llu", kind ? ", " : "", kindNames[kind], static_cast<unsigned long long>( total.Kinds[kind] ) );
+    }
+    printf( "), results:" );
+    for( const auto &result: total.Results ){
+        printf( " %s=%llu", resultName( result.first ).c_str(), static_cast<unsigned long long>( result.second ) );
+    }
+    TransportStats stats;
+    for( LoadClient &client: clients ){
+        TransportStats connection = client.Board->stats();
+        stats.Connects += connection.Connects;
+        stats.Disconnects += connection.Disconnects;
+    }
+    printf( "\nconnects %llu, disconnects %llu\n", static_cast<unsigned long long>( stats.Connects ),
+        static_cast<unsigned long long>( stats.Disconnects ) );
+
+    clients.clear();
+    loop.stop();
+    return total.Failed || total.Timeouts || total.Disconnected || total.Rejected ? 2 : 0;
+}
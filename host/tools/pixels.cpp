@@ -0,0 +1,234 @@
+/**
+ * @file pixels.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "eventloop.h"
+#include <arpa/inet.h>
+#include <cstdio>
+#include <cstring>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace nodemcu;
+
+/**
+ * @brief The datagram layout of the firmware, see include/udpserver.h.
+ */
+enum : uint8_t {
+    UDP_MAGIC = 0x4E,
+    UDP_FLAG_ACK = 0x01,
+    UDP_FLAG_SYNC = 0x02,
+    UDP_FLAG_SHOW = 0x04,
+    UDP_FLAG_REPLY = 0x80,
+    UDP_PIXELS = 0x03,
+    UDP_HEADER_SIZE = 5
+};
+
+/**
+ * @brief Size of the largest datagram the firmware takes, see UDP_MAX_PACKET_SIZE.
+ */
+static const size_t MAX_PACKET_SIZE = 1472;
+
+/**
+ * @brief Largest amount of pixels in one run, the count is a byte.
+ */
+static const size_t MAX_RUN = 255;
+
+/**
+ * @brief The streaming settings.
+ */
+struct PixelConfig {
+    std::string Host;
+    uint16_t Port = 334;
+    uint32_t Count = 0;
+    std::string Pattern = "chase";
+    uint32_t Fps = 30;
+    uint32_t Seconds = 5;
+    uint32_t Full = 30;
+    bool Ack = false;
+};
+
+static void usage(){
+    printf( "usage: nodemcu-pixels [options] HOST[:PORT] COUNT\n"
+            "  streams a test pattern to a strip of COUNT pixels (config pixels PIN COUNT) over UDP (port 334)\n"
+            "  --pattern NAME     chase (few pixels change per frame) or rainbow (all change) (chase)\n"
+            "  --fps N            frames per second (30)\n"
+            "  --seconds N        streaming time (5)\n"
+            "  --full N           send every pixel every N frames, the others only carry the changes (30)\n"
+            "  --ack              ask the board to acknowledge every datagram and count the errors\n" );
+}
+
+/**
+ * @brief Convert a position on the color wheel to RGB.
+ */
+static void wheel( uint8_t position, uint8_t *rgb ){
+    uint8_t rising = ( position % 85 ) * 3;
+    uint8_t falling = 255 - rising;
+    if( position < 85 ) rgb[0] = falling, rgb[1] = rising, rgb[2] = 0;
+    else if( position < 170 ) rgb[0] = 0, rgb[1] = falling, rgb[2] = rising;
+    else rgb[0] = rising, rgb[1] = 0, rgb[2] = falling;
+}
+
+/**
+ * @brief Draw a frame of the test pattern as RGB.
+ */
+static void draw( const PixelConfig &config, uint32_t frame, std::vector<uint8_t> &pixels ){
+    for( uint32_t pixel = 0; pixel < config.Count; pixel++ ){
+        uint8_t *rgb = &pixels[pixel * 3];
+        if( config.Pattern == "rainbow" ) {
+            wheel( static_cast<uint8_t>( pixel * 256 / config.Count + frame * 4 ), rgb );
+            continue;
+        }
+
+        // A dot with a short fading tail
+        uint32_t distance = ( frame + config.Count - pixel ) % config.Count;
+        uint8_t level = distance < 4 ? 255 >> ( distance * 2 ) : 0;
+        rgb[0] = level;
+        rgb[1] = level / 2;
+        rgb[2] = 0;
+    }
+}
+
+int main( int argc, char **argv ){
+    PixelConfig config;
+    int i = 1;
+    for( ; i < argc; i++ ){
+        std::string arg = argv[i];
+        bool value = i + 1 < argc;
+        if( arg == "--ack" ) config.Ack = true;
+        else if( arg == "--pattern" && value ) config.Pattern = argv[++i];
+        else if( arg == "--fps" && value ) config.Fps = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--seconds" && value ) config.Seconds = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--full" && value ) config.Full = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg[0] != '-' ) break;
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if( i + 2 != argc || !config.Fps || !config.Full || ( config.Pattern != "chase" && config.Pattern != "rainbow" ) ) {
+        usage();
+        return 1;
+    }
+    std::string address = argv[i++];
+    size_t colon = address.rfind( ':' );
+    config.Host = address.substr( 0, colon );
+    if( colon != std::string::npos ) config.Port = std::strtoul( address.c_str() + colon + 1, nullptr, 10 );
+    config.Count = std::strtoul( argv[i], nullptr, 10 );
+    if( !config.Count || config.Count > 65535 ) {
+        usage();
+        return 1;
+    }
+
+    sockaddr_in board = {};
+    board.sin_family = AF_INET;
+    board.sin_port = htons( config.Port );
+    if( inet_pton( AF_INET, config.Host.c_str(), &board.sin_addr ) != 1 ) {
+        fprintf( stderr, "invalid address: %s\n", config.Host.c_str() );
+        return 1;
+    }
+    int fd = socket( AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0 );
+
+    std::vector<uint8_t> shown( config.Count * 3 ), pixels( config.Count * 3 );
+    uint16_t sequence = 0;
+    uint64_t datagrams = 0, bytes = 0, replies = 0, errors = 0;
+    std::vector<uint8_t> packet;
+
+    // Start a datagram, the first one of the stream restarts the sequence on the board
+    auto begin = [ & ](){
+        sequence++;
+        uint8_t flags = ( config.Ack ? UDP_FLAG_ACK : 0 ) | ( datagrams == 0 ? UDP_FLAG_SYNC : 0 );
+        packet = { UDP_MAGIC, flags, static_cast<uint8_t>( sequence >> 8 ), static_cast<uint8_t>( sequence ), UDP_PIXELS };
+    };
+    auto send = [ & ](){
+        if( sendto( fd, packet.data(), packet.size(), 0, reinterpret_cast<sockaddr*>( &board ), sizeof( board ) ) < 0 ) perror( "sendto" );
+        datagrams++;
+        bytes += packet.size();
+    };
+    auto receive = [ & ]( int timeoutMs ){
+        pollfd poll = { fd, POLLIN, 0 };
+        while( ::poll( &poll, 1, timeoutMs ) > 0 ){
+            uint8_t reply[64];
+            ssize_t length = recv( fd, reply, sizeof( reply ), 0 );
+            if( length < UDP_HEADER_SIZE + 2 || reply[0] != UDP_MAGIC || !( reply[1] & UDP_FLAG_REPLY ) ) continue;
+            replies++;
+            if( reply[UDP_HEADER_SIZE] || reply[UDP_HEADER_SIZE + 1] ) errors++;
+        }
+    };
+
+    uint32_t frames = config.Fps * config.Seconds;
+    uint64_t period = 1000000 / config.Fps;
+    uint64_t start = nowUs();
+    for( uint32_t frame = 0; frame < frames; frame++ ){
+        draw( config, frame, pixels );
+        bool full = frame % config.Full == 0;
+
+        // Every run of changed pixels goes into the current datagram, or into a new one when it is full
+        begin();
+        for( uint32_t pixel = 0; pixel < config.Count; ){
+            if( !full && !memcmp( &pixels[pixel * 3], &shown[pixel * 3], 3 ) ) {
+                pixel++;
+                continue;
+            }
+            uint32_t end = pixel + 1;
+            while( end < config.Count && end - pixel < MAX_RUN && ( full || memcmp( &pixels[end * 3], &shown[end * 3], 3 ) ) ) end++;
+            if( packet.size() + 3 + 3 > MAX_PACKET_SIZE ) {
+                send();
+                begin();
+            }
+            end = std::min<uint32_t>( end, pixel + ( MAX_PACKET_SIZE - packet.size() - 3 ) / 3 );
+            packet.push_back( pixel >> 8 );
+            packet.push_back( pixel & 0xFF );
+            packet.push_back( end - pixel );
+            packet.insert( packet.end(), pixels.begin() + pixel * 3, pixels.begin() + end * 3 );
+            pixel = end;
+        }
+
+        // The last datagram of the frame shows it, it may carry no runs at all
+        packet[1] |= UDP_FLAG_SHOW;
+        send();
+        shown = pixels;
+
+        if( config.Ack ) receive( 0 );
+        uint64_t next = start + ( frame + 1 ) * period;
+        uint64_t now = nowUs();
+        if( next > now ) usleep( next - now );
+    }
+    double seconds = ( nowUs() - start ) / 1000000.0;
+    if( config.Ack ) receive( 500 );
+    close( fd );
+
+    printf( "%u frame(s) in %.2f s (%.1f fps), %lu datagram(s), %lu bytes (%.1f per frame)", frames, seconds, frames / seconds,
+        datagrams, bytes, static_cast<double>( bytes ) / frames );
+    if( config.Ack ) printf( ", %lu replies, %lu errors", replies, errors );
+    printf( "\n" );
+    return config.Ack && ( replies < datagrams || errors ) ? 2 : 0;
+}
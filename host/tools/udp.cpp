@@ -0,0 +1,212 @@
+/**
+ * @file udp.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "eventloop.h"
+#include "latency.h"
+#include <arpa/inet.h>
+#include <cstdio>
+#include <cstring>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace nodemcu;
+
+/**
+ * @brief The datagram layout of the firmware, see include/udpserver.h.
+ */
+enum : uint8_t {
+    UDP_MAGIC = 0x4E,
+    UDP_FLAG_ACK = 0x01,
+    UDP_FLAG_SYNC = 0x02,
+    UDP_FLAG_REPLY = 0x80,
+    UDP_WRITE = 0x01,
+    UDP_READ = 0x02,
+    UDP_HEADER_SIZE = 5
+};
+
+/**
+ * @brief The UDP settings.
+ */
+struct UdpConfig {
+    std::string Host;
+    uint16_t Port = 334;
+    std::string Interface;
+    uint8_t Operation = 0;
+    std::vector<uint8_t> Items;
+    bool Ack = false;
+    uint32_t Count = 1;
+    uint32_t Copies = 1;
+    uint32_t TimeoutMs = 500;
+};
+
+static void usage(){
+    printf( "usage: nodemcu-udp [options] HOST[:PORT] (write PIN=VALUE... | read PIN...)\n"
+            "  HOST may be a multicast group, every board of the group answers (port 334)\n"
+            "  --ack              ask the boards to acknowledge writes\n"
+            "  --interface IP     interface address to send multicast datagrams from\n"
+            "  -n COUNT           send COUNT datagrams with increasing sequence numbers (1)\n"
+            "  --copies N         send every datagram N times, the boards drop the copies (1)\n"
+            "  --timeout MS       time to wait for replies (500)\n" );
+}
+
+/**
+ * @brief Convert a pin name (A0, D0 .. D8) to the pin id of the firmware.
+ *
+ * @return int the pin id or -1 if the name is not valid
+ */
+static int pinId( const std::string &name ){
+    if( name == "A0" || name == "a0" ) return 0x0A;
+    if( name.size() == 2 && ( name[0] == 'D' || name[0] == 'd' ) && name[1] >= '0' && name[1] <= '8' ) return name[1] - '0';
+    return -1;
+}
+
+/**
+ * @brief Print a reply datagram.
+ */
+static void printReply( const uint8_t *reply, size_t length, const sockaddr_in &from, uint64_t latencyUs ){
+    char address[INET_ADDRSTRLEN];
+    inet_ntop( AF_INET, &from.sin_addr, address, sizeof( address ) );
+    uint16_t result = reply[UDP_HEADER_SIZE] << 8 | reply[UDP_HEADER_SIZE + 1];
+    printf( "%s:%u seq %u result 0x%04X %.3f ms", address, ntohs( from.sin_port ), reply[2] << 8 | reply[3], result, latencyUs / 1000.0 );
+    for( size_t i = UDP_HEADER_SIZE + 2; i + 3 <= length; i += 3 ){
+        uint16_t value = reply[i + 1] << 8 | reply[i + 2];
+        if( reply[i] == 0x0A ) printf( " A0=%u", value );
+        else printf( " D%u=%u", reply[i], value );
+    }
+    printf( "\n" );
+}
+
+int main( int argc, char **argv ){
+    UdpConfig config;
+    int i = 1;
+    for( ; i < argc; i++ ){
+        std::string arg = argv[i];
+        bool value = i + 1 < argc;
+        if( arg == "--ack" ) config.Ack = true;
+        else if( arg == "--interface" && value ) config.Interface = argv[++i];
+        else if( arg == "-n" && value ) config.Count = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--copies" && value ) config.Copies = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--timeout" && value ) config.TimeoutMs = std::strtoul( argv[++i], nullptr, 10 );
+        else if( arg[0] != '-' ) break;
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if( i + 2 > argc || !config.Count || !config.Copies ) {
+        usage();
+        return 1;
+    }
+    std::string address = argv[i++];
+    size_t colon = address.rfind( ':' );
+    config.Host = address.substr( 0, colon );
+    if( colon != std::string::npos ) config.Port = std::strtoul( address.c_str() + colon + 1, nullptr, 10 );
+
+    std::string operation = argv[i++];
+    config.Operation = operation == "write" ? UDP_WRITE : operation == "read" ? UDP_READ : 0;
+    for( ; i < argc && config.Operation; i++ ){
+        std::string item = argv[i];
+        size_t equals = item.find( '=' );
+        int pin = pinId( item.substr( 0, equals ) );
+        if( pin < 0 || ( config.Operation == UDP_WRITE ) == ( equals == std::string::npos ) ) {
+            fprintf( stderr, "invalid pin: %s\n", item.c_str() );
+            return 1;
+        }
+        config.Items.push_back( pin );
+        if( config.Operation == UDP_WRITE ) {
+            uint16_t pinValue = std::strtoul( item.c_str() + equals + 1, nullptr, 10 );
+            config.Items.push_back( pinValue >> 8 );
+            config.Items.push_back( pinValue & 0xFF );
+        }
+    }
+    if( !config.Operation || config.Items.empty() ) {
+        usage();
+        return 1;
+    }
+
+    sockaddr_in board = {};
+    board.sin_family = AF_INET;
+    board.sin_port = htons( config.Port );
+    if( inet_pton( AF_INET, config.Host.c_str(), &board.sin_addr ) != 1 ) {
+        fprintf( stderr, "invalid address: %s\n", config.Host.c_str() );
+        return 1;
+    }
+    bool multicast = IN_MULTICAST( ntohl( board.sin_addr.s_addr ) );
+    int fd = socket( AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0 );
+    if( !config.Interface.empty() ) {
+        in_addr interfaceAddress;
+        inet_pton( AF_INET, config.Interface.c_str(), &interfaceAddress );
+        setsockopt( fd, IPPROTO_IP, IP_MULTICAST_IF, &interfaceAddress, sizeof( interfaceAddress ) );
+    }
+
+    // Only reads and acknowledged writes are answered
+    bool answered = config.Operation == UDP_READ || config.Ack;
+    LatencyHistogram latency;
+    uint64_t replies = 0;
+    for( uint32_t sequence = 1; sequence <= config.Count; sequence++ ){
+        uint8_t flags = ( config.Ack ? UDP_FLAG_ACK : 0 ) | ( sequence == 1 ? UDP_FLAG_SYNC : 0 );
+        std::vector<uint8_t> packet = { UDP_MAGIC, flags, static_cast<uint8_t>( sequence >> 8 ), static_cast<uint8_t>( sequence ), config.Operation };
+        packet.insert( packet.end(), config.Items.begin(), config.Items.end() );
+
+        uint64_t sent = nowUs();
+        for( uint32_t copy = 0; copy < config.Copies; copy++ ){
+            if( sendto( fd, packet.data(), packet.size(), 0, reinterpret_cast<sockaddr*>( &board ), sizeof( board ) ) < 0 ) {
+                perror( "sendto" );
+                return 1;
+            }
+        }
+
+        // A multicast group can answer with many boards, so collect replies until the timeout
+        pollfd poll = { fd, POLLIN, 0 };
+        uint64_t deadline = sent + config.TimeoutMs * 1000ull;
+        while( answered && nowUs() < deadline && ::poll( &poll, 1, ( deadline - nowUs() ) / 1000 + 1 ) > 0 ){
+            uint8_t reply[512];
+            sockaddr_in from = {};
+            socklen_t fromLength = sizeof( from );
+            ssize_t length = recvfrom( fd, reply, sizeof( reply ), 0, reinterpret_cast<sockaddr*>( &from ), &fromLength );
+            if( length < UDP_HEADER_SIZE + 2 || reply[0] != UDP_MAGIC || !( reply[1] & UDP_FLAG_REPLY ) ) continue;
+            if( static_cast<uint32_t>( reply[2] << 8 | reply[3] ) != ( sequence & 0xFFFF ) ) continue;
+            uint64_t elapsed = nowUs() - sent;
+            latency.record( elapsed );
+            replies++;
+            if( config.Count == 1 ) printReply( reply, length, from, elapsed );
+            if( !multicast ) break;
+        }
+    }
+    close( fd );
+
+    if( answered && config.Count > 1 ) {
+        printf( "%u datagram(s), %lu replies, latency p50 %.3f p99 %.3f max %.3f ms\n", config.Count, replies,
+            latency.percentile( 0.5 ) / 1000.0, latency.percentile( 0.99 ) / 1000.0, latency.max() / 1000.0 );
+    }
+    return answered && !replies ? 2 : 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file bootstats.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef BOOTSTATS_H
+#define BOOTSTATS_H
+
+#include <Arduino.h>
+
+/**
+ * @brief The boot phases that are timed.
+ */
+enum BootPhase{
+    BOOT_FS_MOUNT = 0,
+    BOOT_LIST_FILES,
+    BOOT_LOAD_CONFIG,
+    BOOT_LOAD_PINS,
+    BOOT_SERIAL_READY,
+    BOOT_WIFI_CONNECT,
+    BOOT_TCP_START,
+    BOOT_HTTP_START,
+    BOOT_PHASE_COUNT
+};
+
+/**
+ * @brief The BootStats class records when each boot phase started and how long it took.
+ * Only the first begin and end of a phase are recorded, so it can be called from the main loop.
+ */
+class BootStats{
+public:
+    /**
+     * @brief Construct a new Boot Stats object
+     */
+    BootStats();
+
+    /**
+     * @brief Record the start time of a phase.
+     * 
+     * @param phase the phase that started
+     */
+    void begin( const BootPhase &phase );
+
+    /**
+     * @brief Record the end time of a phase.
+     * 
+     * @param phase the phase that ended
+     */
+    void end( const BootPhase &phase );
+
+    /**
+     * @brief Print the start time and duration of every phase.
+     * 
+     * @param out the output to print to
+     */
+    void print( Print &out );
+
+private:
+    /**
+     * @brief Start time (in us since reset) of each phase.
+     */
+    unsigned long m_Start[BOOT_PHASE_COUNT];
+
+    /**
+     * @brief End time (in us since reset) of each phase.
+     */
+    unsigned long m_End[BOOT_PHASE_COUNT];
+
+    /**
+     * @brief Bit flags of the phases that have started.
+     */
+    uint16 m_Started;
+
+    /**
+     * @brief Bit flags of the phases that have ended.
+     */
+    uint16 m_Ended;
+};
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ * @file bridgecontrol.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef BRIDGECONTROL_H
+#define BRIDGECONTROL_H
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include "configcontrol.h"
+#include "iocontrol.h"
+#include "metrics.h"
+#include "ringbuffer.h"
+#include "seriallink.h"
+
+/**
+ * @brief Amount of UART bytes that is sent to the client at once without waiting for the flush time.
+ */
+#define BRIDGE_CHUNK_SIZE 512
+
+/**
+ * @brief Size of the receive buffer of the UART driver while the bridge is on, it holds the bytes
+ * that arrive while the loop is busy with other stages.
+ */
+#define BRIDGE_UART_BUFFER 1024
+
+/**
+ * @brief The BridgeControl class connects the UART to a TCP port, a transparent serial bridge.
+ * Bytes are moved between the UART driver and the client socket through two RingBuffers without
+ * being copied again: the UART and the socket read straight into a ring and write straight from it.
+ * UART bytes are collected for ConfigControl::BridgeFlush ms or until BRIDGE_CHUNK_SIZE bytes
+ * are waiting, so a byte stream is not sent as a packet per byte. A client that does not take
+ * data for ConfigControl::BridgeStall ms loses the buffered UART bytes instead of holding up the UART.
+ * Client bytes are only read while the ring has room, so a slow UART slows the client down through TCP.
+ * The serial console is off while the bridge is on. With swap the UART uses D7 (RX) and D8 (TX)
+ * and the log goes to Serial1 on D4, otherwise the log is dropped.
+ */
+class BridgeControl{
+public:
+    /**
+     * @brief Construct a new Bridge Control object
+     *
+     * @param configControl instance pointer to the cofiguration control of the flash memory
+     * @param ioControl instance pointer to the pin control that reserves the swapped UART pins
+     * @param serialLink instance pointer to the serial console that gives up the UART
+     * @param metrics instance pointer to the metrics counters
+     */
+    BridgeControl( ConfigControl *configControl, IOControl *ioControl, SerialLink *serialLink, Metrics *metrics );
+
+    /**
+     * @brief Start the bridge of the flash memory configuration.
+     */
+    void load();
+
+    /**
+     * @brief Execute the configuration command of the bridge: config bridge PORT|off [BAUD] [FRAMING] [swap].
+     * The UART changes in the next update(), after the reply to the command has been sent.
+     *
+     * @param port the TCP port, 0 or off to stop the bridge
+     * @param baud the baud rate, empty for CONFIG_BRIDGE_BAUD_DEFAULT
+     * @param format the framing like 8N1, empty for 8N1
+     * @param swap swap to use D7 and D8 as UART pins
+     * @return uint16 result code
+     */
+    uint16 configure( const String &port, const String &baud, const String &format, const String &swap );
+
+    /**
+     * @brief Apply a pending configuration change and move the data in both directions.
+     *
+     * @param connected true when wifi is connected and clients can be accepted
+     * @return uint16 result code
+     */
+    uint16 update( bool connected );
+
+    /**
+     * @brief Return true while the bridge has the UART.
+     */
+    bool active() const { return m_Active; }
+
+private:
+    /**
+     * @brief Take the UART from the serial console and listen on the port.
+     */
+    void start();
+
+    /**
+     * @brief Close the client and the port and give the UART back to the serial console.
+     */
+    void stop();
+
+    /**
+     * @brief Reserve the pins of the swapped UART and the log, or release them.
+     *
+     * @param reserve true to reserve D4, D7 and D8
+     * @return uint16 result code
+     */
+    uint16 reservePins( bool reserve );
+
+    /**
+     * @brief Accept a waiting connection, it replaces the current client.
+     */
+    void accept();
+
+    /**
+     * @brief Read the bytes the UART has received into the ring, without a client they are dropped.
+     */
+    void receiveUart( unsigned long now );
+
+    /**
+     * @brief Send the collected UART bytes to the client once enough are waiting or the oldest is old enough.
+     */
+    void sendClient( unsigned long now );
+
+    /**
+     * @brief Read the bytes of the client as far as the ring has room.
+     */
+    void receiveClient();
+
+    /**
+     * @brief Write the bytes of the client to the UART as far as its transmit buffer has room.
+     */
+    void sendUart();
+
+    /**
+     * @brief Instance poiner of the configuration data in the flash memory of the NodeMCU.
+     */
+    ConfigControl *m_ConfigControl;
+
+    /**
+     * @brief Instance pointer of the pin control.
+     */
+    IOControl *m_IOControl;
+
+    /**
+     * @brief Instance pointer of the serial console.
+     */
+    SerialLink *m_SerialLink;
+
+    /**
+     * @brief Instance pointer of the metrics counters.
+     */
+    Metrics *m_Metrics;
+
+    /**
+     * @brief The listening socket while the bridge is on.
+     */
+    WiFiServer *m_Server;
+
+    /**
+     * @brief The connected client.
+     */
+    WiFiClient m_Client;
+
+    /**
+     * @brief Bytes from the UART to the client and from the client to the UART.
+     */
+    RingBuffer m_UartToClient;
+    RingBuffer m_ClientToUart;
+
+    /**
+     * @brief Flag which is set to true while the bridge has the UART.
+     */
+    bool m_Active;
+
+    /**
+     * @brief Flag which is set to true when the configuration changed and the bridge has to restart.
+     */
+    bool m_Pending;
+
+    /**
+     * @brief Flag which is set to true while the UART is swapped to D7 and D8.
+     */
+    bool m_Swapped;
+
+    /**
+     * @brief Flag which is set to true while D4, D7 and D8 are reserved.
+     */
+    bool m_Reserved;
+
+    /**
+     * @brief Flag which is set to true while a client is connected.
+     */
+    bool m_Connected;
+
+    /**
+     * @brief Time (in ms) the oldest byte in the UART ring arrived.
+     */
+    unsigned long m_FirstByte;
+
+    /**
+     * @brief Time (in ms) the client last took bytes or the UART ring was last not full.
+     */
+    unsigned long m_LastProgress;
+};
+
+#endif
@@ -0,0 +1,189 @@
+/**
+ * @file buscontrol.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef BUSCONTROL_H
+#define BUSCONTROL_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Wire.h>
+#include <vector>
+#include "configcontrol.h"
+#include "iocontrol.h"
+
+/**
+ * @brief Maximum amount of bytes of one transfer, the size of the I2C buffer of the ESP8266 core.
+ */
+#define BUS_MAX_TRANSFER 128
+
+/**
+ * @brief Default clock (in Hz) of the I2C bus.
+ */
+#define BUS_I2C_CLOCK 100000
+
+/**
+ * @brief Default clock (in Hz) of the SPI bus.
+ */
+#define BUS_SPI_CLOCK 1000000
+
+/**
+ * @brief The BusControl class runs I2C and SPI transactions, so a sensor can be used without custom firmware.
+ * A transaction is one command: the bytes to write are a hex argument and the bytes that have been read
+ * are the hex reply, a block of a sensor takes a single round trip.
+ * While a bus is active its pins (I2C: D1 SCL, D2 SDA, SPI: D5 SCK, D6 MISO, D7 MOSI) are reserved in IOControl.
+ */
+class BusControl{
+public:
+    /**
+     * @brief Construct a new Bus Control object, both buses are inactive until they are started.
+     * 
+     * @param configControl instance pointer to the cofiguration control of the flash memory
+     * @param ioControl instance pointer to the pin control that reserves the bus pins
+     */
+    BusControl( ConfigControl *configControl, IOControl *ioControl );
+
+    /**
+     * @brief Execute an i2c command: begin [CLOCK], end, scan, write ADDR HEX, read ADDR COUNT or write-read ADDR HEX COUNT.
+     * 
+     * @param command the i2c command and its arguments
+     * @param out the output the reply is printed to
+     * @return uint16 result code
+     */
+    uint16 i2c( const std::vector<String> &command, Print &out );
+
+    /**
+     * @brief Execute a spi command: begin [CLOCK] [MODE], end, transfer CS HEX, write CS HEX, read CS COUNT or write-read CS HEX COUNT.
+     * 
+     * @param command the spi command and its arguments
+     * @param out the output the reply is printed to
+     * @return uint16 result code
+     */
+    uint16 spi( const std::vector<String> &command, Print &out );
+
+    /**
+     * @brief Start the I2C bus for a driver, like a port expander. It stays started until every driver closed it.
+     * 
+     * @return uint16 result code
+     */
+    uint16 openI2c();
+
+    /**
+     * @brief Close the I2C bus of a driver.
+     */
+    void closeI2c();
+
+    /**
+     * @brief Start the SPI bus for a driver. It stays started until every driver closed it.
+     * 
+     * @return uint16 result code
+     */
+    uint16 openSpi();
+
+    /**
+     * @brief Close the SPI bus of a driver.
+     */
+    void closeSpi();
+
+private:
+    /**
+     * @brief Start the I2C bus if it is not started yet and set its clock.
+     * 
+     * @return uint16 result code
+     */
+    uint16 beginI2c( long clock );
+
+    /**
+     * @brief Start the SPI bus if it is not started yet.
+     * 
+     * @return uint16 result code
+     */
+    uint16 beginSpi();
+
+    /**
+     * @brief Reserve the pins of a bus, none of them when one is reserved by another driver or configured as output or pulse input.
+     * 
+     * @param pins the pins of the bus
+     * @param count the amount of pins
+     * @param error the result code of the bus for a pin that is in use
+     * @return uint16 result code, an error contains the PinId
+     */
+    uint16 reservePins( const PinId *pins, uint count, uint16 error );
+
+    /**
+     * @brief Release the pins of a bus that the bus reserved.
+     */
+    void releasePins( const PinId *pins, uint count );
+
+    /**
+     * @brief Select the chip select pin of a SPI transaction, it has to be configured as output.
+     * 
+     * @param pin the argument with the pin
+     * @param gpio output buffer for the GPIO of the pin
+     * @return uint16 result code
+     */
+    uint16 selectPin( const String &pin, uint8 &gpio );
+
+    /**
+     * @brief Print bytes in hex notation on a single line.
+     */
+    static void printHex( Print &out, const uint8 *data, uint length );
+
+    /**
+     * @brief Instance poiner of the configuration data in the flash memory of the NodeMCU.
+     */
+    ConfigControl *m_ConfigControl;
+
+    /**
+     * @brief Instance pointer of the pin control.
+     */
+    IOControl *m_IOControl;
+
+    /**
+     * @brief Flags which are set to true while a bus is started.
+     */
+    bool m_I2cActive;
+    bool m_SpiActive;
+
+    /**
+     * @brief Amount of drivers that use a bus, it can not be ended while they do.
+     */
+    uint m_I2cUsers;
+    uint m_SpiUsers;
+
+    /**
+     * @brief Bit mask of the pins the buses reserved, by PinId. The pins of other drivers are never released.
+     */
+    uint16 m_Owned;
+
+    /**
+     * @brief The clock, bit order and mode of the SPI transactions.
+     */
+    SPISettings m_SpiSettings;
+};
+
+#endif
@@ -31,6 +31,7 @@
 #define COMMAND_H
 
 #include <WString.h>
+#include <vector>
 
 /**
  * @brief The main commands with numeric values.
@@ -41,6 +42,16 @@ enum Command{
     COMMAND_CONFIG = 0x1000,
     COMMAND_READ = 0x2000,
     COMMAND_WRITE = 0x3000,
+    COMMAND_BOOT_STATS = 0x4000,
+    COMMAND_STATS = 0x5000,
+    COMMAND_METRICS = 0x6000,
+    COMMAND_LOG = 0x7000,
+    COMMAND_SERIAL = 0x8000,
+    COMMAND_CLIENTS = 0x9000,
+    COMMAND_I2C = 0xB000,
+    COMMAND_SPI = 0xC000,
+    COMMAND_SENSOR = 0xD000,
+    COMMAND_PIXELS = 0xE000,
     COMMAND_SUCCESS = 0x0000
 };
 
@@ -61,7 +72,23 @@ enum ConfigCommand{
     CONFIG_PORT_TCP = 0x0900,
     CONFIG_PORT_HTTP = 0x0A00,
     CONFIG_MAX_CLIENTS = 0x0B00,
-    CONFIG_INACTIVE_TIMEOUT = 0x0C00
+    CONFIG_INACTIVE_TIMEOUT = 0x0C00,
+    CONFIG_SAVE_DELAY = 0x0D00,
+    CONFIG_FAST_BOOT = 0x0E00,
+    CONFIG_PORT_UDP = 0x0F00,
+    CONFIG_MULTICAST = 0x0F10,
+    CONFIG_CLIENT_RATE = 0x0F20,
+    CONFIG_CLIENT_BANDWIDTH = 0x0F30,
+    CONFIG_ADMISSION = 0x0F40,
+    CONFIG_HTTP_KEEP_ALIVE = 0x0F50,
+    CONFIG_HTTP_MAX_REQUESTS = 0x0F60,
+    CONFIG_EXPANDER = 0x0F70,
+    CONFIG_EXPANDER_POLL = 0x0F80,
+    CONFIG_SENSOR = 0x0F90,
+    CONFIG_BRIDGE = 0x0FA0,
+    CONFIG_BRIDGE_FLUSH = 0x0FB0,
+    CONFIG_BRIDGE_STALL = 0x0FC0,
+    CONFIG_PIXELS = 0x0FD0
 };
 
 /**
@@ -70,7 +97,10 @@ enum ConfigCommand{
 enum PinConfig{
     PIN_NOT_SET = 0x0000,
     PIN_INPUT = 0x0010,
-    PIN_OUTPUT = 0x0020
+    PIN_OUTPUT = 0x0020,
+    PIN_COUNTER = 0x0030,
+    PIN_FREQUENCY = 0x0040,
+    PIN_PULSE_WIDTH = 0x0050
 };
 
 /**
@@ -87,7 +117,31 @@ enum PinId{
     PIN_DIG5 = 0x0005,
     PIN_DIG6 = 0x0006,
     PIN_DIG7 = 0x0007,
-    PIN_DIG8 = 0x0008
+    PIN_DIG8 = 0x0008,
+    PIN_EXP0 = 0x0010,
+    PIN_EXP_LAST = 0x006F
+};
+
+/**
+ * @brief The port expander chips with numeric values.
+ */
+enum ExpanderType{
+    EXPANDER_NONE = 0x0000,
+    EXPANDER_MCP23017 = 0x0001,
+    EXPANDER_PCF8574 = 0x0002,
+    EXPANDER_74HC595 = 0x0003,
+    EXPANDER_ERROR = 0x00FF
+};
+
+/**
+ * @brief The sensor chips with numeric values.
+ */
+enum SensorType{
+    SENSOR_NONE = 0x0000,
+    SENSOR_DS18B20 = 0x0001,
+    SENSOR_DHT11 = 0x0002,
+    SENSOR_DHT22 = 0x0003,
+    SENSOR_ERROR = 0x00FF
 };
 
 /**
@@ -97,7 +151,8 @@ enum Protocol{
     PROTOCOL_ERROR = 0xFC00,
     PROTOCOL_HTTP = 0x00C1,
     PROTOCOL_TCP = 0x00C2,
-    PROTOCOL_SERIAL = 0x00C3
+    PROTOCOL_SERIAL = 0x00C3,
+    PROTOCOL_UDP = 0x00C7
 };
 
 /**
@@ -117,14 +172,53 @@ enum ErrorCodes{
     ERROR_CONFIG_DNS2 = CONFIG_ERROR | CONFIG_DNS2,
     ERROR_CONFIG_PORT_TCP = CONFIG_ERROR | CONFIG_PORT_TCP,
     ERROR_CONFIG_PORT_HTTP = CONFIG_ERROR | CONFIG_PORT_HTTP,
+    ERROR_CONFIG_SAVE_DELAY = CONFIG_ERROR | CONFIG_SAVE_DELAY,
+    ERROR_CONFIG_FAST_BOOT = CONFIG_ERROR | CONFIG_FAST_BOOT,
+    ERROR_CONFIG_PORT_UDP = CONFIG_ERROR | CONFIG_PORT_UDP,
+    ERROR_CONFIG_MULTICAST = CONFIG_ERROR | CONFIG_MULTICAST,
+    ERROR_CONFIG_CLIENT_RATE = CONFIG_ERROR | CONFIG_CLIENT_RATE,
+    ERROR_CONFIG_CLIENT_BANDWIDTH = CONFIG_ERROR | CONFIG_CLIENT_BANDWIDTH,
+    ERROR_CONFIG_ADMISSION = CONFIG_ERROR | CONFIG_ADMISSION,
+    ERROR_CONFIG_HTTP_KEEP_ALIVE = CONFIG_ERROR | CONFIG_HTTP_KEEP_ALIVE,
+    ERROR_CONFIG_HTTP_MAX_REQUESTS = CONFIG_ERROR | CONFIG_HTTP_MAX_REQUESTS,
+    ERROR_CONFIG_EXPANDER = CONFIG_ERROR | CONFIG_EXPANDER,
+    ERROR_CONFIG_EXPANDER_POLL = CONFIG_ERROR | CONFIG_EXPANDER_POLL,
+    ERROR_CONFIG_SENSOR = CONFIG_ERROR | CONFIG_SENSOR,
+    ERROR_CONFIG_BRIDGE = CONFIG_ERROR | CONFIG_BRIDGE,
+    ERROR_CONFIG_BRIDGE_FLUSH = CONFIG_ERROR | CONFIG_BRIDGE_FLUSH,
+    ERROR_CONFIG_BRIDGE_STALL = CONFIG_ERROR | CONFIG_BRIDGE_STALL,
+    ERROR_CONFIG_PIXELS = CONFIG_ERROR | CONFIG_PIXELS,
     ERROR_HTTP = PROTOCOL_ERROR | PROTOCOL_HTTP,
     ERROR_TCP = PROTOCOL_ERROR | PROTOCOL_TCP,
     ERROR_SERIAL = PROTOCOL_ERROR | PROTOCOL_SERIAL,
+    ERROR_UDP = PROTOCOL_ERROR | PROTOCOL_UDP,
     ERROR_WIFI_CONFIG = PROTOCOL_ERROR | 0x00C4,
     ERROR_WIFI_CONNECTION = PROTOCOL_ERROR | 0x00C5,
+    ERROR_WIFI_CONNECTING = PROTOCOL_ERROR | 0x00C6,
     ERROR_CLIENT_DISCONNECTED = PROTOCOL_ERROR | 0x00CD,
+    ERROR_CLIENT_BUSY = PROTOCOL_ERROR | 0x00CB,
+    ERROR_CLIENT_EVICTED = PROTOCOL_ERROR | 0x00CC,
     ERROR_READ = COMMAND_READ | 0x0F00,
-    ERROR_WRITE = COMMAND_WRITE | 0x0F00
+    ERROR_WRITE = COMMAND_WRITE | 0x0F00,
+    ERROR_WRITE_MODE = COMMAND_WRITE | 0x0E00,
+    ERROR_WRITE_VALUE = COMMAND_WRITE | 0x0D00,
+    ERROR_LOG = COMMAND_LOG | 0x0F00,
+    ERROR_I2C = COMMAND_I2C | 0x0F00,
+    ERROR_I2C_PINS = COMMAND_I2C | 0x0E00,
+    ERROR_I2C_INACTIVE = COMMAND_I2C | 0x0D00,
+    ERROR_I2C_NACK = COMMAND_I2C | 0x0C00,
+    ERROR_I2C_BUSY = COMMAND_I2C | 0x0B00,
+    ERROR_SPI = COMMAND_SPI | 0x0F00,
+    ERROR_SPI_PINS = COMMAND_SPI | 0x0E00,
+    ERROR_SPI_INACTIVE = COMMAND_SPI | 0x0D00,
+    ERROR_SPI_CS = COMMAND_SPI | 0x0C00,
+    ERROR_SPI_BUSY = COMMAND_SPI | 0x0B00,
+    ERROR_SENSOR = COMMAND_SENSOR | 0x0F00,
+    ERROR_SENSOR_NOT_SET = COMMAND_SENSOR | 0x0E00,
+    ERROR_SENSOR_NO_VALUE = COMMAND_SENSOR | 0x0D00,
+    ERROR_PIXELS = COMMAND_PIXELS | 0x0F00,
+    ERROR_PIXELS_NOT_SET = COMMAND_PIXELS | 0x0E00,
+    ERROR_PIXELS_RANGE = COMMAND_PIXELS | 0x0D00
 };
 
 /**
@@ -159,6 +253,37 @@ PinConfig parsePinConfigCommand( const String &command );
  */
 PinId parsePinCommand( const String &command );
 
+/**
+ * @brief This functon is called to convert a digital pin value (0, 1, low or high) into a number.
+ * 
+ * @param value the provided value string
+ * @return the value or -1 if it is not a digital value
+ */
+int parsePinValue( const String &value );
+
+/**
+ * @brief This functon is called to convert a number in decimal, hex (0x) or octal (0) notation within a range.
+ * 
+ * @param text the provided number string
+ * @param min the smallest valid value
+ * @param max the largest valid value
+ * @param value output buffer for the number
+ * @return false if the text is no number or it is out of range
+ */
+bool parseNumber( const String &text, long min, long max, long &value );
+
+/**
+ * @brief This functon is called to convert bytes in hex notation, with an optional 0x prefix and two digits per byte.
+ * All digits are checked before the first byte is written, so on an error the buffer is unchanged.
+ * 
+ * @param text the provided hex string
+ * @param data output buffer for the bytes
+ * @param size the size of the output buffer
+ * @param length output buffer for the amount of bytes
+ * @return false if the text is no hex or longer than the buffer
+ */
+bool parseHex( const String &text, uint8 *data, uint size, uint &length );
+
 /**
  * @brief This functon is called to convert a string commands into an enumerator value.
  * 
@@ -167,4 +292,64 @@ PinId parsePinCommand( const String &command );
  */
 Protocol parseProtocolCommand( const String &command );
 
+ExpanderType parseExpanderType( const String &type );
+
+/**
+ * @brief This functon is called to convert a sensor chip name into an enumerator value
+ * 
+ * @param type the provided chip name
+ * @return an enum value of SensorType or SENSOR_ERROR
+ */
+SensorType parseSensorType( const String &type );
+
+/**
+ * @brief This functon is called to split a received command line into the command and its arguments.
+ * 
+ * @param input the received command line
+ * @param command output buffer for the command and arguments
+ */
+void splitCommand( String input, std::vector<String> &command );
+
+/**
+ * @brief This functon is called to convert a command enumerator value into its name.
+ * 
+ * @param command the command value
+ * @return the name of the command or "error"
+ */
+const char *commandName( const Command &command );
+
+/**
+ * @brief This functon is called to convert a protocol enumerator value into its name.
+ * 
+ * @param protocol the protocol value
+ * @return the name of the protocol or "error"
+ */
+const char *protocolName( const Protocol &protocol );
+
+const char *expanderName( const ExpanderType &type );
+
+/**
+ * @brief This functon is called to convert a sensor enumerator value into its chip name.
+ * 
+ * @param type the sensor type
+ * @return the name of the chip or "none"
+ */
+const char *sensorName( const SensorType &type );
+
+/**
+ * @brief This functon is called to convert a UART framing like 8N1 or 7E2 into its SerialConfig value.
+ * 
+ * @param format the data bits (5-8), parity (N, E or O) and stop bits (1 or 2)
+ * @return the SerialConfig value or -1 if the framing is not valid
+ */
+int parseSerialFormat( const String &format );
+
+/**
+ * @brief This functon is called to convert a SerialConfig value into its framing like 8N1.
+ * 
+ * @param format the SerialConfig value
+ * @return the framing
+ */
+String serialFormatName( uint8 format );
+
 #endif
\ No newline at end of file
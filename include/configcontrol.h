@@ -36,6 +36,82 @@
 
 #define CONFIG_FILE "/config.txt"
 
+/**
+ * @brief Temporary file the configuration is written to before it atomically replaces CONFIG_FILE.
+ */
+#define CONFIG_TEMP_FILE "/config.tmp"
+
+/**
+ * @brief Default quiet period (in ms) after the last change before the configuration is saved.
+ */
+#define CONFIG_SAVE_DELAY_DEFAULT 1000
+
+/**
+ * @brief Default time (in ms) an HTTP connection stays open for the next request.
+ */
+#define CONFIG_HTTP_KEEP_ALIVE_DEFAULT 5000
+
+/**
+ * @brief Default maximum amount of requests served on one HTTP connection.
+ */
+#define CONFIG_HTTP_MAX_REQUESTS_DEFAULT 100
+
+/**
+ * @brief Default time (in ms) between two reads of the inputs of a port expander without interrupt line.
+ */
+#define CONFIG_EXPANDER_POLL_DEFAULT 20
+
+/**
+ * @brief Amount of port expanders, expander N has the pins E(N*16) to E(N*16+15).
+ */
+#define EXPANDER_COUNT 6
+
+/**
+ * @brief Amount of pins reserved for each port expander, the 8 bit chips use the first 8.
+ */
+#define EXPANDER_PINS 16
+
+/**
+ * @brief Pin value of a port expander without interrupt line.
+ */
+#define EXPANDER_NO_PIN 0xFF
+
+/**
+ * @brief Amount of sensors.
+ */
+#define SENSOR_COUNT 4
+
+/**
+ * @brief Default settings of the serial bridge: baud rate, time (in ms) UART bytes are collected
+ * before they are sent to the client and time (in ms) a client that takes no data is waited for.
+ */
+#define CONFIG_BRIDGE_BAUD_DEFAULT 115200
+#define CONFIG_BRIDGE_FLUSH_DEFAULT 2
+#define CONFIG_BRIDGE_STALL_DEFAULT 1000
+
+/**
+ * @brief Maximum amount of pixels of the LED strip, the interrupts are off for 30 us per pixel while a frame is sent.
+ */
+#define PIXEL_MAX_COUNT 300
+
+/**
+ * @brief A pending change is never deferred longer than this many quiet periods.
+ */
+#define CONFIG_SAVE_MAX_DEFER 10
+
+/**
+ * @brief Size of the buffer the configuration file is serialized into.
+ */
+#define CONFIG_BUFFER_SIZE 768
+
+/**
+ * @brief What happens to a new TCP connection when MaxClients clients are connected.
+ */
+enum AdmissionPolicy{
+    ADMISSION_REJECT = 0,
+    ADMISSION_EVICT = 1
+};
+
 
 /**
  * @brief GPIO and status data of a pin.
@@ -45,6 +121,27 @@ struct IO_PIN{
     uint8_t gpio;
     PinConfig mode;
     int value;
+    uint32 filter;
+};
+
+/**
+ * @brief The chip, bus address and pin directions of a port expander.
+ */
+struct EXPANDER_CONFIG{
+    ExpanderType type;
+    uint8 address;
+    uint8 interrupt;
+    uint16 inputs;
+    uint16 outputs;
+};
+
+/**
+ * @brief The chip, data pin and measurement interval (in ms) of a sensor.
+ */
+struct SENSOR_CONFIG{
+    SensorType type;
+    uint8 pin;
+    uint32 interval;
 };
 
 /**
@@ -69,19 +166,40 @@ public:
     void loadConfig();
 
     /**
-     * @brief Save the configuration values into the NodeMCU flash memory
+     * @brief Save the configuration values into the NodeMCU flash memory.
+     * Changes are coalesced until no change has been made for SaveDelay ms,
+     * the file is only rewritten when its content differs and it is replaced atomically.
      */
     void saveConfig();
 
     /**
-     * @brief Show the contents of the config file in the serial monitor
+     * @brief Flag the configuration as changed and restart the save quiet period.
+     */
+    void markUpdated();
+
+    /**
+     * @brief Configure the flash memory settings.
+     * 
+     * @param command indicates which setting will be configured
+     * @param value the new value of the setting
+     * @return uint16 result code
      */
-    void printConfig();
+    uint16 configure( const ConfigCommand &command, const String &value );
 
     /**
-     * @brief Read the contents of the config file as a string
+     * @brief Show the contents of the config file
+     * 
+     * @param out the output to print to
      */
-    String readConfig();
+    void printConfig( Print &out );
+
+    /**
+     * @brief Copy the contents of the config file to an output, a few bytes at a time.
+     * 
+     * @param out the output to print to
+     * @return true if the file has been copied, false if it could not be read
+     */
+    bool readConfig( Print &out );
 
     /**
      * @brief Flag that indicates if config values have been loaded
@@ -153,6 +271,134 @@ public:
      * @brief timeout (in ms) for connected clients that dont do anything.
      */
     uint32 InActiveTimeout;
+
+    /**
+     * @brief Quiet period (in ms) after the last change before the configuration is written to flash.
+     */
+    uint32 SaveDelay;
+
+    /**
+     * @brief Amount of times the configuration file has been written to flash memory.
+     */
+    uint32 WriteCount;
+
+    /**
+     * @brief Flag to skip the boot diagnostics and connect to wifi without blocking the main loop.
+     */
+    bool FastBoot;
+
+    /**
+     * @brief The port of the UDP listener, 0 when UDP is off.
+     */
+    uint16 PortUDP;
+
+    /**
+     * @brief The multicast group the UDP listener joins, 0.0.0.0 for none.
+     */
+    IPAddress MulticastGroup;
+
+    /**
+     * @brief Commands per second a TCP client may send, 0 for no limit.
+     */
+    uint32 ClientRate;
+
+    /**
+     * @brief Bytes per second a TCP client may send and receive, 0 for no limit.
+     */
+    uint32 ClientBandwidth;
+
+    /**
+     * @brief Reject new TCP connections when the server is full, or evict the longest idle client for them.
+     */
+    AdmissionPolicy Admission;
+
+    /**
+     * @brief Time (in ms) an HTTP connection stays open for the next request, 0 to close it after every response.
+     */
+    uint32 HttpKeepAlive;
+
+    /**
+     * @brief Maximum amount of requests served on one HTTP connection, 0 for no limit.
+     */
+    uint32 HttpMaxRequests;
+
+    /**
+     * @brief Time (in ms) between two reads of the inputs of a port expander without interrupt line.
+     */
+    uint32 ExpanderPoll;
+
+    /**
+     * @brief The port expanders. The address is the I2C address, or the PinId of the latch pin of a 74HC595.
+     * The interrupt is the PinId of the interrupt line or EXPANDER_NO_PIN, inputs and outputs are pin bit masks.
+     */
+    EXPANDER_CONFIG Expanders[EXPANDER_COUNT];
+
+    /**
+     * @brief The sensors. The pin is the PinId of the data line.
+     */
+    SENSOR_CONFIG Sensors[SENSOR_COUNT];
+
+    /**
+     * @brief TCP port of the serial bridge, 0 when the bridge is off.
+     */
+    uint16 BridgePort;
+
+    /**
+     * @brief Baud rate and framing (SerialConfig value) of the UART while the serial bridge is on.
+     */
+    uint32 BridgeBaud;
+    uint8 BridgeFormat;
+
+    /**
+     * @brief Flag which is set to true when the bridge moves the UART to D7 (RX) and D8 (TX), the log goes to D4 then.
+     */
+    bool BridgeSwap;
+
+    /**
+     * @brief Time (in ms) UART bytes are collected before they are sent to the bridge client.
+     */
+    uint32 BridgeFlush;
+
+    /**
+     * @brief Time (in ms) after which UART bytes the bridge client does not take are dropped, 0 to never drop them.
+     */
+    uint32 BridgeStall;
+
+    /**
+     * @brief The PinId of the data line of the LED strip and its amount of pixels, 0 when there is no strip.
+     */
+    uint8 PixelPin;
+    uint16 PixelCount;
+
+private:
+    /**
+     * @brief Write the configuration file content into a buffer.
+     * 
+     * @param buffer output buffer for the file content
+     * @param size the size of the buffer
+     * @param writeCount the write counter value to store
+     * @return size_t length of the content, 0 if it didnt fit
+     */
+    size_t serializeConfig( char *buffer, size_t size, uint32 writeCount );
+
+    /**
+     * @brief Compare content with the configuration file on the flash memory.
+     * 
+     * @param content the file content to compare
+     * @param length the length of the content
+     * @return true if the stored file is byte identical
+     */
+    bool isStored( const char *content, size_t length );
+
+    /**
+     * @brief Time (in ms) of the first change that has not been saved yet.
+     */
+    unsigned long m_FirstUpdate;
+
+    /**
+     * @brief Time (in ms) of the last change that has not been saved yet.
+     */
+    unsigned long m_LastUpdate;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,209 @@
+/**
+ * @file expandercontrol.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef EXPANDERCONTROL_H
+#define EXPANDERCONTROL_H
+
+#include <Arduino.h>
+#include "buscontrol.h"
+#include "configcontrol.h"
+#include "iocontrol.h"
+#include "metrics.h"
+
+/**
+ * @brief Time (in ms) between two attempts to start a port expander that did not answer.
+ */
+#define EXPANDER_RETRY_INTERVAL 1000
+
+/**
+ * @brief Clock (in Hz) of the SPI transactions to a 74HC595.
+ */
+#define EXPANDER_SPI_CLOCK 4000000
+
+/**
+ * @brief The ExpanderControl class adds the pins of port expander chips as virtual pins E0 to E95,
+ * they work with the read, write and config pin commands like the pins of the board.
+ * Reads and writes only use a cache: the inputs of a chip are refreshed with one bus transaction
+ * per ConfigControl::ExpanderPoll period, or when its interrupt line is low, and all writes to a chip
+ * in a loop iteration are sent with one bus transaction by update().
+ * MCP23017 (16 pins) and PCF8574 (8 pins) are on the I2C bus, a 74HC595 (8 outputs) is on the SPI bus with its own latch pin.
+ */
+class ExpanderControl{
+public:
+    /**
+     * @brief Construct a new Expander Control object
+     * 
+     * @param configControl instance pointer to the cofiguration control of the flash memory
+     * @param ioControl instance pointer to the pin control that reserves the latch and interrupt pins
+     * @param busControl instance pointer to the bus control that starts the buses
+     * @param metrics instance pointer to the metrics counters
+     */
+    ExpanderControl( ConfigControl *configControl, IOControl *ioControl, BusControl *busControl, Metrics *metrics );
+
+    /**
+     * @brief Start the port expanders of the flash memory configuration.
+     */
+    void load();
+
+    /**
+     * @brief Execute a configuration command for a port expander: config expander SLOT TYPE [ADDRESS] [INTERRUPT_PIN].
+     * 
+     * @param slot the number of the expander, 0 to EXPANDER_COUNT - 1
+     * @param type the chip, or none to remove the expander
+     * @param address the I2C address, or the latch pin of a 74HC595
+     * @param interrupt the pin of the interrupt line, empty for none
+     * @return uint16 result code
+     */
+    uint16 configure( const String &slot, const String &type, const String &address, const String &interrupt );
+
+    /**
+     * @brief Configure a pin of a port expander as input or output.
+     * 
+     * @param pin the pin to configure
+     * @param mode PIN_INPUT or PIN_OUTPUT
+     * @return uint16 result code
+     */
+    uint16 configurePin( const PinId &pin, const uint16 &mode );
+
+    /**
+     * @brief Read a pin of a port expander from the cache.
+     * 
+     * @param pin the pin to read
+     * @param value output buffer for the value of the pin
+     * @return uint16 result code
+     */
+    uint16 read( const PinId &pin, int &value );
+
+    /**
+     * @brief Check if a pin of a port expander is an output that can be written.
+     * 
+     * @return uint16 result code
+     */
+    uint16 writable( const PinId &pin );
+
+    /**
+     * @brief Write an output pin of a port expander into the cache, update() sends it.
+     * 
+     * @param pin the pin to write, it has to be writable()
+     * @param value the digital value
+     */
+    void write( const PinId &pin, int value );
+
+    /**
+     * @brief Send the written outputs and refresh the inputs that are due, one bus transaction per chip each.
+     * 
+     * @return uint16 result code
+     */
+    uint16 update();
+
+private:
+    /**
+     * @brief The state of a port expander: attached while its pins exist, active while the chip answers,
+     * dirty while written outputs have not been sent. The cache holds the outputs (latch) and the inputs.
+     */
+    struct Expander{
+        bool attached;
+        bool active;
+        bool dirty;
+        uint16 latch;
+        uint16 input;
+        unsigned long lastPoll;
+    };
+
+    /**
+     * @brief Open the bus of an expander, reserve its pins and add its virtual pins.
+     * 
+     * @return uint16 result code
+     */
+    uint16 attach( uint slot );
+
+    /**
+     * @brief Remove the virtual pins of an expander, release its pins and close its bus.
+     */
+    void detach( uint slot );
+
+    /**
+     * @brief Configure the directions of the pins of a chip, write its outputs and read its inputs.
+     * 
+     * @return uint16 result code
+     */
+    uint16 begin( uint slot );
+
+    /**
+     * @brief Send the outputs of a chip.
+     * 
+     * @return uint16 result code
+     */
+    uint16 flush( uint slot );
+
+    /**
+     * @brief Read the inputs of a chip.
+     * 
+     * @return uint16 result code
+     */
+    uint16 refresh( uint slot );
+
+    /**
+     * @brief Write bytes to an I2C chip in one transaction.
+     * 
+     * @return uint16 result code
+     */
+    uint16 transmit( uint8 address, const uint8 *data, size_t length );
+
+    /**
+     * @brief Return the amount of pins of a chip.
+     */
+    static uint pinCount( ExpanderType type );
+
+    /**
+     * @brief Instance poiner of the configuration data in the flash memory of the NodeMCU.
+     */
+    ConfigControl *m_ConfigControl;
+
+    /**
+     * @brief Instance pointer of the pin control.
+     */
+    IOControl *m_IOControl;
+
+    /**
+     * @brief Instance pointer of the bus control.
+     */
+    BusControl *m_BusControl;
+
+    /**
+     * @brief Instance pointer of the metrics counters.
+     */
+    Metrics *m_Metrics;
+
+    /**
+     * @brief The state of the port expanders, by slot.
+     */
+    Expander m_Expanders[EXPANDER_COUNT];
+};
+
+#endif
@@ -0,0 +1,305 @@
+/**
+ * @file httpserver.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef HTTPSERVER_H
+#define HTTPSERVER_H
+
+#include <ESP8266WiFi.h>
+#include <LittleFS.h>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "configcontrol.h"
+#include "metrics.h"
+
+/**
+ * @brief Maximum size of a request: request line, headers and body.
+ */
+#define HTTP_REQUEST_SIZE 1024
+
+/**
+ * @brief Maximum amount of open HTTP connections, a browser loading the control panel opens several.
+ */
+#define HTTP_MAX_CONNECTIONS 4
+
+/**
+ * @brief Time (in ms) a client gets to send its complete request.
+ */
+#define HTTP_REQUEST_TIMEOUT 5000
+
+/**
+ * @brief Maximum amount of requests handled per loop iteration over all connections.
+ */
+#define HTTP_REQUESTS_PER_LOOP 4
+
+/**
+ * @brief Content length of a response that is sent with chunked transfer-encoding.
+ */
+#define HTTP_CONTENT_CHUNKED ( (size_t) -1 )
+
+/**
+ * @brief Size of the buffer the headers and content of a response are collected in before they are written.
+ */
+#define HTTP_OUTPUT_SIZE 512
+
+/**
+ * @brief The request methods the routes are registered for.
+ */
+enum HttpMethod{
+    HTTP_METHOD_ANY = 0,
+    HTTP_METHOD_GET,
+    HTTP_METHOD_POST,
+    HTTP_METHOD_OTHER
+};
+
+/**
+ * @brief The HttpServer class serves HTTP/1.1 with persistent connections.
+ * Up to HTTP_MAX_CONNECTIONS connections are open at once, each with a fixed request buffer.
+ * A connection stays open after a response for ConfigControl::HttpKeepAlive ms, at most
+ * ConfigControl::HttpMaxRequests requests are served on it. Pipelined requests are answered in order.
+ * When all connections are in use the one that has been idle the longest is closed for a new one,
+ * a connection with a request in progress is never closed for another.
+ * The routes and request accessors follow the ESP8266WebServer of the ESP8266 core.
+ */
+class HttpServer{
+public:
+    typedef std::function<void( void )> Handler;
+
+    /**
+     * @brief Construct a new Http Server object
+     *
+     * @param port the TCP port to listen on
+     * @param configControl instance pointer to the cofiguration control of the flash memory
+     * @param metrics instance pointer to the metrics counters
+     */
+    HttpServer( uint16 port, ConfigControl *configControl, Metrics *metrics );
+
+    /**
+     * @brief Start listening.
+     */
+    void begin();
+
+    /**
+     * @brief Register the handler of a path.
+     *
+     * @param uri the path without query
+     * @param method the method of the requests, HTTP_METHOD_ANY for all
+     * @param handler the handler that sends the response
+     */
+    void on( const String &uri, HttpMethod method, Handler handler );
+
+    /**
+     * @brief Register the handler of the requests without route.
+     */
+    void onNotFound( Handler handler ) { m_NotFound = handler; }
+
+    /**
+     * @brief Accept new connections, read the requests and handle the complete ones.
+     */
+    void handleClient();
+
+    const String &uri() const { return m_Uri; }
+    HttpMethod method() const { return m_Method; }
+    int args() const { return m_Args.size(); }
+    String arg( int index ) const;
+    String argName( int index ) const;
+    String arg( const String &name ) const;
+    bool hasArg( const String &name ) const;
+
+    /**
+     * @brief Send the status line and the headers of the response to the current request.
+     *
+     * @param code the HTTP status code
+     * @param contentType the content type of the response
+     * @param length the length of the content or HTTP_CONTENT_CHUNKED
+     */
+    void send( int code, const char *contentType, size_t length );
+
+    /**
+     * @brief Send content of the response to the current request, as a chunk of a chunked response.
+     */
+    void sendContent( const char *content, size_t size );
+
+    /**
+     * @brief Send a file as response to the current request.
+     *
+     * @return size_t the amount of sent file bytes
+     */
+    size_t streamFile( File &file, const char *contentType );
+
+    /**
+     * @brief Print the open connections and the keep-alive settings.
+     *
+     * @param out the output to print to
+     */
+    void printConnections( Print &out );
+
+private:
+    /**
+     * @brief A handler registered with on().
+     */
+    struct Route{
+        String uri;
+        HttpMethod method;
+        Handler handler;
+    };
+
+    /**
+     * @brief An open connection and the received bytes that have not been handled yet.
+     */
+    struct Connection{
+        WiFiClient client;
+        char buffer[HTTP_REQUEST_SIZE + 1];
+        size_t length;
+        unsigned long connectTime;
+        unsigned long lastActive;
+        uint32 requests;
+        bool close;
+    };
+
+    /**
+     * @brief Accept a waiting connection, close the connection that has been idle the longest when all are in use.
+     */
+    void accept();
+
+    /**
+     * @brief Read the data that has arrived without waiting, as far as the request buffer has room.
+     *
+     * @return false if the connection is closed or timed out
+     */
+    bool receive( Connection &connection );
+
+    /**
+     * @brief Parse the request at the start of the buffer.
+     *
+     * @return size_t the size of the request, 0 if it is not complete yet
+     */
+    size_t parseRequest( Connection &connection );
+
+    /**
+     * @brief Run the handler of the parsed request and end its response.
+     */
+    void handleRequest( Connection &connection );
+
+    /**
+     * @brief Parse the arguments of a query string or form body.
+     */
+    void parseArguments( const char *text, size_t length );
+
+    /**
+     * @brief Write to the current connection through the output buffer.
+     */
+    void write( const char *data, size_t size );
+
+    /**
+     * @brief Send the content of the output buffer.
+     */
+    void flushOutput();
+
+    /**
+     * @brief The listening socket.
+     */
+    WiFiServer m_Server;
+
+    /**
+     * @brief The open connections.
+     */
+    std::vector<Connection> m_Connections;
+
+    /**
+     * @brief The registered routes.
+     */
+    std::vector<Route> m_Routes;
+
+    /**
+     * @brief The handler of the requests without route.
+     */
+    Handler m_NotFound;
+
+    /**
+     * @brief The connection of the current request.
+     */
+    Connection *m_Current;
+
+    /**
+     * @brief The path of the current request.
+     */
+    String m_Uri;
+
+    /**
+     * @brief The method of the current request.
+     */
+    HttpMethod m_Method;
+
+    /**
+     * @brief The query and form arguments of the current request.
+     */
+    std::vector<std::pair<String, String>> m_Args;
+
+    /**
+     * @brief Flag which is set when the connection of the current request stays open.
+     */
+    bool m_KeepAlive;
+
+    /**
+     * @brief Flag which is set once the headers of the current response have been sent.
+     */
+    bool m_HeadersSent;
+
+    /**
+     * @brief Flag which is set when the current response is chunked.
+     */
+    bool m_Chunked;
+
+    /**
+     * @brief The response bytes that have not been written yet.
+     */
+    char m_Output[HTTP_OUTPUT_SIZE];
+
+    /**
+     * @brief Amount of bytes in the output buffer.
+     */
+    size_t m_OutputLength;
+
+    /**
+     * @brief The connection the next loop iteration starts with.
+     */
+    uint m_Next;
+
+    /**
+     * @brief Instance poiner of the configuration data in the flash memory of the NodeMCU.
+     */
+    ConfigControl *m_ConfigControl;
+
+    /**
+     * @brief Instance pointer of the metrics counters.
+     */
+    Metrics *m_Metrics;
+};
+
+#endif
@@ -30,7 +30,11 @@
 #define IOCONTROL_H
 
 #include <Arduino.h>
+#include <vector>
 #include "configcontrol.h"
+#include "pulseinput.h"
+
+class ExpanderControl;
 
 
 /**
@@ -64,20 +68,22 @@ public:
     /**
      * @brief Execute a configuration command for a pin on the board.
      * 
-     * @param mode the direction of the pin
+     * @param mode the direction of the pin, or the measurement of a pulse input
      * @param pin the pin to configure
+     * @param filter the minimum time (in us) between two edges of a pulse input
      * @return result code 
      */
-    uint16 configurePin(const PinId &pin, const uint16 &mode);
+    uint16 configurePin(const PinId &pin, const uint16 &mode, uint32 filter = 0);
 
     /**
      * @brief Execute a read command on the board.
      * 
      * @param pin th pin to read the value of
      * @param value output buffer for the value of the pin
+     * @param reset true to clear the counter of a pulse input in the same step
      * @return uint16 result code
      */
-    uint16 read(const PinId &pin, int &value);
+    uint16 read(const PinId &pin, int &value, bool reset = false);
 
     /**
      * @brief Execute a write command on the board.
@@ -88,11 +94,56 @@ public:
      */
     uint16 write(const PinId &pin, int value);
 
+    /**
+     * @brief Execute a write command for several output pins at once, all of them or none.
+     * Every pin is checked against its configuration first, then GPIO0-15 are set with a single
+     * write of the GPIO output register and GPIO16 (D0) right after it, from its own register.
+     * The pins of port expanders are written into their cache and sent in the same loop iteration.
+     * 
+     * @param pins the pins to write the values to
+     * @param values the digital values to be written, one for every pin
+     * @return uint16 result code, errors of a pin contain its PinId
+     */
+    uint16 write(const std::vector<PinId> &pins, const std::vector<int> &values);
+
+    /**
+     * @brief Reserve a pin for a bus or release it, a reserved pin can not be configured, read or written.
+     * 
+     * @param pin the pin the bus uses
+     * @param reserved true to reserve the pin, false to release it
+     */
+    void reserve(const PinId &pin, bool reserved);
+
+    /**
+     * @brief Return true while a bus uses the pin.
+     */
+    bool reserved(const PinId &pin) const { return pin <= PIN_DIG8 && ( m_Reserved & ( 1 << pin ) ); }
+
+    /**
+     * @brief Set the port expanders that handle the pins E0 to E95.
+     */
+    void setExpanders(ExpanderControl *expanders) { m_Expanders = expanders; }
+
 private:
     /**
      * @brief Instance poiner of the configuration data in the flash memory of the NodeMCU.
      */
     ConfigControl *m_ConfigControl;
+
+    /**
+     * @brief The pulse inputs of the digital pins, by PinId.
+     */
+    PulseInput m_PulseInputs[PIN_DIG8 + 1];
+
+    /**
+     * @brief Bit mask of the reserved pins, by PinId.
+     */
+    uint16 m_Reserved;
+
+    /**
+     * @brief Instance pointer of the port expanders.
+     */
+    ExpanderControl *m_Expanders;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,210 @@
+/**
+ * @file logger.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief The log levels, a message is logged when its level is at or below the level of its module.
+ */
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+/**
+ * @brief Highest log level that is compiled in, messages above it are removed from the firmware.
+ * Can be set with a build flag, for example: build_flags = -D LOG_LEVEL=4
+ */
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+/**
+ * @brief Size of the ring buffer that holds messages until the UART has room for them.
+ */
+#define LOG_BUFFER_SIZE 2048
+
+/**
+ * @brief Maximum length of a single message, longer messages are truncated.
+ */
+#define LOG_LINE_SIZE 160
+
+/**
+ * @brief The modules that have their own log level.
+ */
+enum LogModule{
+    LOG_NODEMCU = 0,
+    LOG_CONFIG,
+    LOG_IO,
+    LOG_WIFI,
+    LOG_TCP,
+    LOG_MODULE_COUNT
+};
+
+#define LOG_MESSAGE( module, level, ... ) do { if( Log.enabled( module, level ) ) Log.write( level, __VA_ARGS__ ); } while( 0 )
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR( module, ... ) LOG_MESSAGE( module, LOG_LEVEL_ERROR, __VA_ARGS__ )
+#else
+#define LOG_ERROR( module, ... ) do {} while( 0 )
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN( module, ... ) LOG_MESSAGE( module, LOG_LEVEL_WARN, __VA_ARGS__ )
+#else
+#define LOG_WARN( module, ... ) do {} while( 0 )
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO( module, ... ) LOG_MESSAGE( module, LOG_LEVEL_INFO, __VA_ARGS__ )
+#else
+#define LOG_INFO( module, ... ) do {} while( 0 )
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG( module, ... ) LOG_MESSAGE( module, LOG_LEVEL_DEBUG, __VA_ARGS__ )
+#else
+#define LOG_DEBUG( module, ... ) do {} while( 0 )
+#endif
+
+/**
+ * @brief The Logger class formats log messages into a RAM ring buffer that is drained to the serial port
+ * when the UART has room for it, so logging never blocks the main loop.
+ * When the buffer is full the message is dropped and counted.
+ */
+class Logger{
+public:
+    /**
+     * @brief Construct a new Logger object
+     */
+    Logger();
+
+    /**
+     * @brief Check if a message of a module will be logged.
+     * 
+     * @param module the module of the message
+     * @param level the level of the message
+     * @return true if the message passes the module filter
+     */
+    bool enabled( const LogModule &module, uint8 level ) const { return level <= m_Levels[module]; }
+
+    /**
+     * @brief Format a message and add it to the ring buffer, a newline is appended.
+     * 
+     * @param level the level of the message
+     * @param format printf style format string
+     */
+    void write( uint8 level, const char *format, ... ) __attribute__( ( format( printf, 3, 4 ) ) );
+
+    /**
+     * @brief Send as much of the ring buffer to the serial port as fits without blocking.
+     */
+    void flush();
+
+    /**
+     * @brief Send the complete ring buffer to the serial port, blocking until it is empty.
+     */
+    void drain();
+
+    /**
+     * @brief Take pending bytes out of the ring buffer, for outputs that frame the log themselves.
+     * 
+     * @param buffer output buffer for the bytes
+     * @param size the size of the buffer
+     * @return size_t amount of bytes taken
+     */
+    size_t read( char *buffer, size_t size );
+
+    /**
+     * @brief Configure the log level of a module.
+     * 
+     * @param module the module name or "all"
+     * @param level the level name (none, error, warn, info, debug)
+     * @return true if the module and level are known
+     */
+    bool configure( const String &module, const String &level );
+
+    /**
+     * @brief Print the level of every module and the message counters.
+     * 
+     * @param out the output to print to
+     */
+    void print( Print &out );
+
+    /**
+     * @brief Amount of messages that have been added to the ring buffer.
+     */
+    uint32 Written;
+
+    /**
+     * @brief Amount of messages that have been dropped because the ring buffer was full.
+     */
+    uint32 Dropped;
+
+    /**
+     * @brief Flag which is set when another output frames the log, flush and drain then leave the buffer alone.
+     */
+    bool Framed;
+
+    /**
+     * @brief The UART flush and drain send the log to, nullptr to drop the messages while the UART is used otherwise.
+     */
+    HardwareSerial *Output;
+
+private:
+    /**
+     * @brief Log level of each module.
+     */
+    uint8 m_Levels[LOG_MODULE_COUNT];
+
+    /**
+     * @brief The ring buffer.
+     */
+    char m_Buffer[LOG_BUFFER_SIZE];
+
+    /**
+     * @brief Position where the next message is written.
+     */
+    size_t m_Head;
+
+    /**
+     * @brief Position of the first byte that has not been sent yet.
+     */
+    size_t m_Tail;
+};
+
+/**
+ * @brief The logger shared by all modules.
+ */
+extern Logger Log;
+
+#endif
@@ -0,0 +1,145 @@
+/**
+ * @file loopstats.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LOOPSTATS_H
+#define LOOPSTATS_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Amount of log2 histogram buckets, the last bucket also holds every longer duration.
+ * Bucket 0 holds durations below 1 us, bucket n holds durations from 2^(n-1) up to 2^n us.
+ */
+#define LOOP_STATS_BUCKETS 20
+
+/**
+ * @brief The stages of the main loop that are timed.
+ */
+enum LoopStage{
+    STAGE_SERIAL = 0,
+    STAGE_WIFI,
+    STAGE_TCP,
+    STAGE_UDP,
+    STAGE_HTTP,
+    STAGE_EXPANDER,
+    STAGE_SENSOR,
+    STAGE_BRIDGE,
+    STAGE_PIXELS,
+    STAGE_SAVE,
+    STAGE_SAMPLER,
+    STAGE_LOG,
+    STAGE_COUNT
+};
+
+/**
+ * @brief Timing data of a single loop stage.
+ */
+struct STAGE_STATS{
+    uint32 count;
+    uint64_t totalCycles;
+    uint32 maxCycles;
+    uint32 buckets[LOOP_STATS_BUCKETS];
+};
+
+/**
+ * @brief The LoopStats class measures the duration of every main loop stage with the CPU cycle counter
+ * and keeps them in fixed log2 histograms, so it is cheap enough to stay enabled.
+ */
+class LoopStats{
+public:
+    /**
+     * @brief Construct a new Loop Stats object
+     */
+    LoopStats();
+
+    /**
+     * @brief Mark the start of a loop iteration.
+     * 
+     * @return uint32 the cycle count at the start, to pass to the first record call
+     */
+    uint32 beginLoop();
+
+    /**
+     * @brief Record the duration of a stage.
+     * 
+     * @param stage the stage that just finished
+     * @param start the cycle count at the start of the stage
+     * @return uint32 the current cycle count, which is the start of the next stage
+     */
+    uint32 record( const LoopStage &stage, uint32 start );
+
+    /**
+     * @brief Mark the end of a loop iteration.
+     */
+    void endLoop();
+
+    /**
+     * @brief Clear all the collected timing data.
+     */
+    void reset();
+
+    /**
+     * @brief Print the loop frequency and the histogram of every stage.
+     * 
+     * @param out the output to print to
+     */
+    void print( Print &out );
+
+    /**
+     * @brief Return the name of a stage as shown by the stats command.
+     */
+    static const char *stageName( const LoopStage &stage );
+
+private:
+    /**
+     * @brief Timing data of each stage.
+     */
+    STAGE_STATS m_Stages[STAGE_COUNT];
+
+    /**
+     * @brief Amount of loop iterations since the last reset.
+     */
+    uint32 m_Loops;
+
+    /**
+     * @brief Cycle count at the start of the current loop iteration.
+     */
+    uint32 m_LoopStart;
+
+    /**
+     * @brief Longest loop iteration (in cycles) since the last reset.
+     */
+    uint32 m_MaxLoopCycles;
+
+    /**
+     * @brief Time (in ms) of the last reset.
+     */
+    unsigned long m_ResetTime;
+};
+
+#endif
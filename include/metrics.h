@@ -0,0 +1,297 @@
+/**
+ * @file metrics.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <map>
+#include "configcontrol.h"
+
+class SensorControl;
+
+/**
+ * @brief The transports that commands and bytes are counted for.
+ */
+enum Transport{
+    TRANSPORT_SERIAL = 0,
+    TRANSPORT_TCP,
+    TRANSPORT_HTTP,
+    TRANSPORT_UDP,
+    TRANSPORT_COUNT
+};
+
+/**
+ * @brief The Metrics class counts commands, result codes, transferred bytes and TCP connections,
+ * and samples the heap. It can be exported in Prometheus text format or as a compact single line.
+ */
+class Metrics{
+public:
+    /**
+     * @brief Construct a new Metrics object
+     * 
+     * @param configControl instance pointer to the cofiguration control of the flash memory
+     */
+    Metrics( ConfigControl *configControl );
+
+    /**
+     * @brief Count an executed command.
+     * 
+     * @param command the command that was executed
+     * @param protocol the protocol the command was received on
+     */
+    void countCommand( const Command &command, const Protocol &protocol );
+
+    /**
+     * @brief Count a result code.
+     * 
+     * @param code the result code
+     */
+    void countResult( uint16 code );
+
+    /**
+     * @brief Count bytes received on a transport.
+     * 
+     * @param protocol the protocol the bytes were received on
+     * @param bytes amount of bytes
+     */
+    void countBytesIn( const Protocol &protocol, size_t bytes );
+
+    /**
+     * @brief Count bytes sent on a transport.
+     * 
+     * @param protocol the protocol the bytes were sent on
+     * @param bytes amount of bytes
+     */
+    void countBytesOut( const Protocol &protocol, size_t bytes );
+
+    /**
+     * @brief Sample the free heap to keep track of the lowest value.
+     */
+    void sampleHeap();
+
+    /**
+     * @brief Set the sensor control whose cached values are exported with the counters.
+     */
+    void setSensors( SensorControl *sensors ) { m_Sensors = sensors; }
+
+    /**
+     * @brief Print all metrics in the Prometheus text exposition format.
+     * 
+     * @param out the output to print to
+     */
+    void printPrometheus( Print &out );
+
+    /**
+     * @brief Print all metrics as a single line of space separated key=value pairs.
+     * 
+     * @param out the output to print to
+     */
+    void printCompact( Print &out );
+
+    /**
+     * @brief Amount of accepted TCP connections.
+     */
+    uint32 TcpAccepted;
+
+    /**
+     * @brief Amount of TCP connections closed because they were inactive for too long.
+     */
+    uint32 TcpTimeouts;
+
+    /**
+     * @brief Amount of TCP connections that were refused.
+     */
+    uint32 TcpRejected;
+
+    /**
+     * @brief Amount of idle TCP clients that were disconnected to admit a new connection.
+     */
+    uint32 TcpEvicted;
+
+    /**
+     * @brief Amount of accepted HTTP connections.
+     */
+    uint32 HttpConnections;
+
+    /**
+     * @brief Amount of answered HTTP requests, more than HttpConnections when connections are reused.
+     */
+    uint32 HttpRequests;
+
+    /**
+     * @brief Amount of TCP commands that had to wait for the rate limit of their client.
+     */
+    uint32 TcpThrottled;
+
+    /**
+     * @brief Amount of loop iterations that left TCP commands waiting because the work budget was spent.
+     */
+    uint32 TcpDeferred;
+
+    /**
+     * @brief Amount of currently connected TCP clients.
+     */
+    uint32 TcpClients;
+
+    /**
+     * @brief Amount of UDP datagrams that were executed.
+     */
+    uint32 UdpPackets;
+
+    /**
+     * @brief Amount of UDP datagrams that were dropped as duplicate or older than the last one of their sender.
+     */
+    uint32 UdpDuplicates;
+
+    /**
+     * @brief Amount of UDP datagrams that were dropped because they were malformed.
+     */
+    uint32 UdpInvalid;
+
+    /**
+     * @brief Amount of bus transactions that refreshed the input cache of a port expander.
+     */
+    uint32 ExpanderReads;
+
+    /**
+     * @brief Amount of bus transactions that sent the coalesced output writes to a port expander.
+     */
+    uint32 ExpanderWrites;
+
+    /**
+     * @brief Amount of port expander bus transactions that failed.
+     */
+    uint32 ExpanderErrors;
+
+    /**
+     * @brief Amount of completed sensor measurements.
+     */
+    uint32 SensorReads;
+
+    /**
+     * @brief Amount of sensor measurements that failed: no answer, a timeout or a wrong checksum.
+     */
+    uint32 SensorErrors;
+
+    /**
+     * @brief Bytes the serial bridge received from the UART and wrote to the UART.
+     */
+    uint32 BridgeUartIn;
+    uint32 BridgeUartOut;
+
+    /**
+     * @brief UART bytes the serial bridge dropped, because no client was connected or the client did not take them.
+     */
+    uint32 BridgeDropped;
+
+    /**
+     * @brief Amount of accepted serial bridge connections.
+     */
+    uint32 BridgeConnections;
+
+    /**
+     * @brief Amount of frames sent to the LED strip, and of frames that were replaced by a newer one before they were sent.
+     */
+    uint32 PixelFrames;
+    uint32 PixelSkipped;
+
+private:
+    /**
+     * @brief Convert a protocol to its transport index.
+     * 
+     * @param protocol the protocol
+     * @return Transport the index in the per transport counters
+     */
+    Transport transport( const Protocol &protocol );
+
+    /**
+     * @brief Instance poiner of the configuration data in the flash memory of the NodeMCU.
+     */
+    ConfigControl *m_ConfigControl;
+
+    /**
+     * @brief Amount of executed commands per command, for each transport.
+     */
+    std::map<uint16, uint32> m_Commands[TRANSPORT_COUNT];
+
+    /**
+     * @brief Amount of times each result code occured.
+     */
+    std::map<uint16, uint32> m_Results;
+
+    /**
+     * @brief Bytes received per transport.
+     */
+    uint32 m_BytesIn[TRANSPORT_COUNT];
+
+    /**
+     * @brief Bytes sent per transport.
+     */
+    uint32 m_BytesOut[TRANSPORT_COUNT];
+
+    /**
+     * @brief Lowest free heap that has been sampled.
+     */
+    uint32 m_MinFreeHeap;
+
+    /**
+     * @brief Instance pointer of the sensor control, nullptr until it is set.
+     */
+    SensorControl *m_Sensors;
+};
+
+/**
+ * @brief The MeteredPrint class forwards everything to another output and counts the bytes as sent on a transport.
+ */
+class MeteredPrint : public Print{
+public:
+    /**
+     * @brief Construct a new Metered Print object
+     * 
+     * @param out the output to forward to
+     * @param metrics the metrics to count the bytes in
+     * @param protocol the protocol the output belongs to
+     */
+    MeteredPrint( Print &out, Metrics *metrics, const Protocol &protocol );
+
+    size_t write( uint8_t c ) override;
+    size_t write( const uint8_t *buffer, size_t size ) override;
+
+    /**
+     * @brief Return the amount of bytes that have been sent.
+     */
+    size_t written() const { return m_Written; }
+
+private:
+    Print &m_Out;
+    Metrics *m_Metrics;
+    Protocol m_Protocol;
+    size_t m_Written;
+};
+
+#endif
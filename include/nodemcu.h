@@ -30,7 +30,17 @@
 #define NODEMCU_H
 
 #include "iocontrol.h"
+#include "buscontrol.h"
+#include "expandercontrol.h"
+#include "sensorcontrol.h"
 #include "wificontrol.h"
+#include "bootstats.h"
+#include "loopstats.h"
+#include "metrics.h"
+#include "seriallink.h"
+#include "bridgecontrol.h"
+#include "pixelcontrol.h"
+#include "scheduler.h"
 
 
 /**
@@ -61,9 +71,22 @@ public:
      * @brief Execute the received command from one of the communication protocols.
      * 
      * @param command commands and arguments
+     * @param protocol the protocol the command was received on
+     * @param out the output for command replies, the connection the command was received on
      * @return uint16 result code
      */
-    uint16 execute_command( const std::vector<String> &command );
+    uint16 execute_command( const std::vector<String> &command, const Protocol &protocol = PROTOCOL_SERIAL, Print &out = Serial );
+
+    /**
+     * @brief Execute a binary pixel upload, it is counted as a pixels command.
+     * 
+     * @param data the pixel runs, see PixelControl::upload()
+     * @param length the length of the runs
+     * @param show true to show the frame afterwards
+     * @param protocol the protocol the upload was received on
+     * @return uint16 result code
+     */
+    uint16 execute_pixels( const uint8_t *data, size_t length, bool show, const Protocol &protocol );
 
 private:
     /**
@@ -76,32 +99,106 @@ private:
      */
     IOControl *m_IOControl;
 
+    /**
+     * @brief This will control the I2C and SPI buses.
+     */
+    BusControl *m_BusControl;
+
+    /**
+     * @brief This will control the port expanders.
+     */
+    ExpanderControl *m_ExpanderControl;
+
+    /**
+     * @brief This will control the sensors.
+     */
+    SensorControl *m_SensorControl;
+
     /**
      * @brief This will control the ESP8266 wifi connectifity.
      */
     WifiControl *m_Server;
 
     /**
-     * @brief The main error handling method
+     * @brief Counters of commands, results, traffic and connections.
+     */
+    Metrics *m_Metrics;
+
+    /**
+     * @brief This will control the binary mode of the serial port.
+     */
+    SerialLink *m_SerialLink;
+
+    /**
+     * @brief This will control the TCP to UART bridge.
+     */
+    BridgeControl *m_BridgeControl;
+
+    /**
+     * @brief This will control the LED strip.
      */
-    void handle_error(uint16 errorCode);
+    PixelControl *m_PixelControl;
+
+    /**
+     * @brief Timing of the boot phases, shown by the boot-stats command.
+     */
+    BootStats m_BootStats;
+
+    /**
+     * @brief Timing of the main loop stages, shown by the stats command.
+     */
+    LoopStats m_LoopStats;
+
+    /**
+     * @brief Runs the tasks of the main loop.
+     */
+    Scheduler *m_Scheduler;
+
+    /**
+     * @brief Flag which is set by the wifi task while the wifi is connected.
+     */
+    bool m_WifiConnected;
+
+    /**
+     * @brief Register the tasks of the main loop.
+     */
+    void setup_tasks();
 
     /**
      * @brief Read serial data if available and save the command.
-     * When this function is called it will only handle command line.
+     * When this function is called it will only handle command line, bytes are collected
+     * without waiting and a command is executed once its line is complete.
      * The NodeMCU supports multiple communication protocols but serial will always be available.
      * 
      * @return result code
      */
     uint16 handle_serial();
 
+    /**
+     * @brief Run the command that has been received.
+     * 
+     * @param command commands and arguments
+     * @param out the output for command replies
+     * @return uint16 result code
+     */
+    uint16 dispatch_command( const std::vector<String> &command, Print &out );
+
     /**
      * @brief Execute configuration command
      * 
      * @param command commands and arguments
+     * @param out the output for command replies
+     * @return uint16 result code
+     */
+    uint16 configure( const std::vector<String> &command, Print &out );
+
+    /**
+     * @brief Execute a write command with several PIN=VALUE arguments, all pins are set at once.
+     * 
+     * @param command the write command and its arguments
      * @return uint16 result code
      */
-    uint16 configure( const std::vector<String> &command );
+    uint16 write_pins( const std::vector<String> &command );
 };
 
 #endif
\ No newline at end of file
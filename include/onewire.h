@@ -0,0 +1,95 @@
+/**
+ * @file onewire.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ONEWIRE_H
+#define ONEWIRE_H
+
+#include <Arduino.h>
+
+/**
+ * @brief The OneWire class drives a 1-Wire bus on one pin in open-drain mode, the bus needs an external pull-up (4.7k).
+ * Only the time slots themselves run with the interrupts disabled, every slot is at most 70 us long
+ * and the interrupts are enabled again between two slots. The 480 us low phase of a reset keeps them enabled,
+ * its length only has a minimum.
+ */
+class OneWire{
+public:
+    /**
+     * @brief Construct a new One Wire object, it drives no pin until begin() is called.
+     */
+    OneWire();
+
+    /**
+     * @brief Release the bus on a pin.
+     *
+     * @param gpio the GPIO of the data line
+     */
+    void begin( uint8 gpio );
+
+    /**
+     * @brief Send a reset pulse.
+     *
+     * @return true if a device answered with a presence pulse
+     */
+    bool reset();
+
+    /**
+     * @brief Write a byte, least significant bit first.
+     */
+    void writeByte( uint8 value );
+
+    /**
+     * @brief Read a byte, least significant bit first.
+     */
+    uint8 readByte();
+
+    /**
+     * @brief Calculate the Dallas/Maxim CRC-8 of a block of bytes.
+     *
+     * @return uint8 the CRC, 0 over a block that ends with its own CRC
+     */
+    static uint8 crc8( const uint8 *data, size_t length );
+
+private:
+    /**
+     * @brief Write one time slot.
+     */
+    void writeBit( bool bit );
+
+    /**
+     * @brief Read one time slot.
+     */
+    bool readBit();
+
+    /**
+     * @brief The GPIO of the data line.
+     */
+    uint8 m_Gpio;
+};
+
+#endif
@@ -0,0 +1,184 @@
+/**
+ * @file pixelcontrol.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PIXELCONTROL_H
+#define PIXELCONTROL_H
+
+#include <Arduino.h>
+#include <vector>
+#include "configcontrol.h"
+#include "iocontrol.h"
+#include "metrics.h"
+
+/**
+ * @brief Baud rate of UART1 for the strip, 4 UART bits (312.5 ns each) make one WS2812 bit of 1250 ns (800 kHz).
+ */
+#define PIXEL_UART_BAUD 3200000
+
+/**
+ * @brief Amount of strip bytes encoded at once, 4 UART characters each, half of the 128 characters of the TX FIFO.
+ */
+#define PIXEL_CHUNK_SIZE 16
+
+/**
+ * @brief Time (in us) the data line has to stay low before the strip takes a new frame, newer WS2812B need 280 us.
+ */
+#define PIXEL_LATCH_US 300
+
+/**
+ * @brief The PixelControl class drives a WS2812 LED strip (ConfigControl::PixelPin and PixelCount) from a framebuffer.
+ * Uploads change the back buffer, a show copies it to the front buffer which the pixels stage sends to the strip.
+ * So a frame that arrives in several parts is never shown half, and a delta frame only has to carry the pixels
+ * that changed since the last one. When several frames are shown before the stage runs only the last one is sent.
+ * The frame is sent by UART1 on D4 (GPIO2), its inverted 6N1 characters at 3.2 Mbaud make the WS2812 bits,
+ * so the bits are timed by the hardware and the interrupts stay on. The loop waits for the frame, about 30 us per pixel.
+ * UART1 and D4 also carry the log of a swapped bridge, the pin reservation keeps the two apart.
+ * The pixels are uploaded as RGB and kept in the GRB order of the strip.
+ */
+class PixelControl{
+public:
+    /**
+     * @brief Construct a new Pixel Control object
+     *
+     * @param configControl instance pointer to the cofiguration control of the flash memory
+     * @param ioControl instance pointer to the pin control that reserves the data pin
+     * @param metrics instance pointer to the metrics counters
+     */
+    PixelControl( ConfigControl *configControl, IOControl *ioControl, Metrics *metrics );
+
+    /**
+     * @brief Destroy the Pixel Control object and its framebuffers.
+     */
+    ~PixelControl();
+
+    /**
+     * @brief Start the LED strip of the flash memory configuration.
+     */
+    void load();
+
+    /**
+     * @brief Execute the configuration command of the LED strip: config pixels PIN COUNT or config pixels off.
+     *
+     * @param pin the data pin, D4
+     * @param count the amount of pixels, 1 to PIXEL_MAX_COUNT
+     * @return uint16 result code
+     */
+    uint16 configure( const String &pin, const String &count );
+
+    /**
+     * @brief Execute a pixels command: status, OFFSET HEX, fill HEX, get or show.
+     *
+     * @param command commands and arguments
+     * @param out the output for the status and the pixels
+     * @return uint16 result code
+     */
+    uint16 command( const std::vector<String> &command, Print &out );
+
+    /**
+     * @brief Write binary pixel runs into the back buffer: [offset high][offset low][count][RGB * count] repeated.
+     *
+     * @param data the runs
+     * @param length the length of the runs
+     * @param show true to show the frame afterwards
+     * @return uint16 result code
+     */
+    uint16 upload( const uint8_t *data, size_t length, bool show );
+
+    /**
+     * @brief Send the last shown frame to the strip once the latch time of the previous one has passed.
+     *
+     * @return uint16 result code
+     */
+    uint16 update();
+
+private:
+    /**
+     * @brief Allocate the framebuffers and reserve the data pin, the strip is cleared.
+     *
+     * @return uint16 result code
+     */
+    uint16 attach();
+
+    /**
+     * @brief Free the framebuffers and release the data pin.
+     */
+    void detach();
+
+    /**
+     * @brief Copy the back buffer to the front buffer, to be sent by the next update().
+     */
+    void show();
+
+    /**
+     * @brief Send the front buffer to the strip through UART1 and wait until the last bit is out.
+     */
+    void transmit();
+
+    /**
+     * @brief Instance poiner of the configuration data in the flash memory of the NodeMCU.
+     */
+    ConfigControl *m_ConfigControl;
+
+    /**
+     * @brief Instance pointer of the pin control.
+     */
+    IOControl *m_IOControl;
+
+    /**
+     * @brief Instance pointer of the metrics counters.
+     */
+    Metrics *m_Metrics;
+
+    /**
+     * @brief The frame the uploads change and the frame that is shown, 3 bytes per pixel in GRB order.
+     */
+    uint8 *m_Back;
+    uint8 *m_Front;
+
+    /**
+     * @brief The GPIO of the data pin.
+     */
+    uint8 m_Gpio;
+
+    /**
+     * @brief Flag which is set to true when the front buffer has not been sent yet.
+     */
+    bool m_Pending;
+
+    /**
+     * @brief Time (in us) the last frame was sent.
+     */
+    unsigned long m_Sent;
+
+    /**
+     * @brief Time (in us) it took to send the last frame.
+     */
+    uint32 m_SendTime;
+};
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * @file pulseinput.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PULSEINPUT_H
+#define PULSEINPUT_H
+
+#include <Arduino.h>
+#include "command.h"
+
+/**
+ * @brief Time (in ms) without edges, from the read that saw the last one, after which the frequency and the pulse width drop to 0.
+ */
+#define PULSE_TIMEOUT 2000
+
+/**
+ * @brief The PulseInput class measures the signal of an input pin with an edge interrupt.
+ * The interrupt takes a cycle counter timestamp of every edge and adds it to 32-bit (count) and
+ * 64-bit (time) accumulators, a read copies and clears them with the interrupts disabled.
+ * Depending on the pin mode the value is the amount of rising edges (PIN_COUNTER), the average
+ * frequency in mHz (PIN_FREQUENCY) or the average high time in us (PIN_PULSE_WIDTH) since the last read.
+ * An edge closer than the filter time to the previous edge is ignored, which removes glitches and contact bounce.
+ */
+class PulseInput{
+public:
+    /**
+     * @brief Construct a new Pulse Input object, it measures nothing until begin() is called.
+     */
+    PulseInput();
+
+    /**
+     * @brief Start measuring a pin.
+     *
+     * @param gpio the GPIO of the pin, GPIO16 has no interrupt
+     * @param mode PIN_COUNTER, PIN_FREQUENCY or PIN_PULSE_WIDTH
+     * @param filter the minimum time (in us) between two edges
+     */
+    void begin( uint8 gpio, PinConfig mode, uint32 filter );
+
+    /**
+     * @brief Stop measuring, detaches the interrupt.
+     */
+    void end();
+
+    /**
+     * @brief Return true while the pin is measured.
+     */
+    bool active() const { return m_Active; }
+
+    /**
+     * @brief Return the measured value of the pin mode.
+     *
+     * @param reset true to clear the counter in the same step, so no edge is lost between the read and the reset
+     * @return int the count, the frequency in mHz or the pulse width in us
+     */
+    int read( bool reset );
+
+private:
+    /**
+     * @brief The edge interrupt.
+     */
+    static void IRAM_ATTR handleEdge( void *arg );
+
+    /**
+     * @brief The GPIO of the pin.
+     */
+    uint8 m_Gpio;
+
+    /**
+     * @brief The measurement of the pin mode.
+     */
+    PinConfig m_Mode;
+
+    /**
+     * @brief Flag which is set to true while the interrupt is attached.
+     */
+    bool m_Active;
+
+    /**
+     * @brief The minimum time between two edges in CPU cycles.
+     */
+    uint32 m_FilterCycles;
+
+    /**
+     * @brief The level after the last accepted edge.
+     */
+    volatile uint8 m_Level;
+
+    /**
+     * @brief Flag which is set to true once a rising edge has been seen, the periods and widths start there.
+     */
+    volatile bool m_Started;
+
+    /**
+     * @brief Cycle counter at the last accepted edge and at the last rising edge.
+     */
+    volatile uint32 m_LastEdge;
+    volatile uint32 m_LastRise;
+
+    /**
+     * @brief Accepted edges, the amount seen by the last read and the time (in ms) of the read that saw a new edge.
+     * The cycle counter wraps after 53 s at 80 MHz, so the timeout is measured with millis().
+     */
+    volatile uint32 m_Edges;
+    uint32 m_ReadEdges;
+    unsigned long m_EdgeTime;
+
+    /**
+     * @brief Rising edges since the last reset.
+     */
+    volatile uint32 m_Count;
+
+    /**
+     * @brief Sum of the periods (rising to rising edge) in cycles and their amount since the last read.
+     */
+    volatile uint64_t m_PeriodSum;
+    volatile uint32 m_Periods;
+
+    /**
+     * @brief Sum of the high times (rising to falling edge) in cycles and their amount since the last read.
+     */
+    volatile uint64_t m_WidthSum;
+    volatile uint32 m_Widths;
+
+    /**
+     * @brief The last measured frequency or pulse width, returned until PULSE_TIMEOUT when no new period ended.
+     */
+    int m_Value;
+};
+
+#endif
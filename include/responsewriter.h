@@ -0,0 +1,154 @@
+/**
+ * @file responsewriter.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef RESPONSEWRITER_H
+#define RESPONSEWRITER_H
+
+#include <Arduino.h>
+
+class HttpServer;
+
+/**
+ * @brief Size of the buffer a response is formatted into, a longer response is sent in several chunks.
+ */
+#define RESPONSE_CHUNK_SIZE 256
+
+/**
+ * @brief The ResponseWriter class formats a reply into a fixed buffer and sends it in chunks,
+ * so the memory a reply needs does not depend on its size.
+ * On a TCP connection (or any other output) a full buffer is written as it is.
+ * For HTTP a reply that fits in one buffer is sent with a Content-Length,
+ * a longer reply with chunked transfer-encoding once the buffer is full for the first time.
+ * Whatever is left is sent when the writer is destroyed.
+ */
+class ResponseWriter : public Print{
+public:
+    /**
+     * @brief Construct a new Response Writer object for a connection.
+     *
+     * @param out the output the chunks are written to
+     */
+    ResponseWriter( Print &out );
+
+    /**
+     * @brief Construct a new Response Writer object for the response to the current HTTP request.
+     *
+     * @param server the web server that handles the request
+     * @param contentType the content type of the response
+     */
+    ResponseWriter( HttpServer &server, const char *contentType );
+
+    /**
+     * @brief Send what is left in the buffer.
+     */
+    ~ResponseWriter();
+
+    /**
+     * @brief Set the HTTP status code, it can only change until the first chunk has been sent.
+     */
+    void setStatus( int code ) { m_Status = code; }
+
+    /**
+     * @brief Drop the content that has not been sent yet.
+     */
+    void clear() { m_Length = 0; }
+
+    size_t write( uint8_t c ) override;
+    size_t write( const uint8_t *buffer, size_t size ) override;
+    using Print::write;
+
+    /**
+     * @brief Send the content of the buffer.
+     */
+    void flush() override;
+
+    /**
+     * @brief Return the amount of content bytes that have been sent.
+     */
+    size_t written() const { return m_Written; }
+
+private:
+    /**
+     * @brief Send the HTTP status line and headers.
+     *
+     * @param length the content length or HTTP_CONTENT_CHUNKED for a chunked response
+     */
+    void sendHeaders( size_t length );
+
+    /**
+     * @brief The output of a connection, nullptr for HTTP.
+     */
+    Print *m_Out;
+
+    /**
+     * @brief The web server of an HTTP response, nullptr for a connection.
+     */
+    HttpServer *m_Server;
+
+    /**
+     * @brief The content type of an HTTP response.
+     */
+    const char *m_ContentType;
+
+    /**
+     * @brief The status code of an HTTP response.
+     */
+    int m_Status;
+
+    /**
+     * @brief Flag which is set to true once the HTTP headers have been sent.
+     */
+    bool m_HeadersSent;
+
+    /**
+     * @brief The content that has not been sent yet.
+     */
+    char m_Buffer[RESPONSE_CHUNK_SIZE];
+
+    /**
+     * @brief Amount of bytes in the buffer.
+     */
+    size_t m_Length;
+
+    /**
+     * @brief Amount of content bytes that have been sent.
+     */
+    size_t m_Written;
+};
+
+/**
+ * @brief The NullPrint class drops everything, for commands whose printed reply is not needed.
+ */
+class NullPrint : public Print{
+public:
+    size_t write( uint8_t ) override { return 1; }
+    size_t write( const uint8_t *, size_t size ) override { return size; }
+    using Print::write;
+};
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * @file ringbuffer.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Size of a ring buffer, a power of 2 so the positions can wrap with a mask.
+ */
+#define RING_BUFFER_SIZE 1024
+
+/**
+ * @brief The RingBuffer class is a fixed byte queue between a producer and a consumer that
+ * both work on contiguous spans of it, so data is read from a source straight into the
+ * buffer and written from the buffer straight to a sink without an intermediate copy.
+ * The head and tail positions run freely and are masked on access, a full buffer
+ * and an empty one are told apart by their difference.
+ */
+class RingBuffer{
+public:
+    /**
+     * @brief Construct a new empty Ring Buffer object
+     */
+    RingBuffer();
+
+    /**
+     * @brief Drop the content.
+     */
+    void clear();
+
+    /**
+     * @brief Return the amount of bytes in the buffer.
+     */
+    size_t used() const { return m_Head - m_Tail; }
+
+    /**
+     * @brief Return the amount of bytes that can be added.
+     */
+    size_t room() const { return RING_BUFFER_SIZE - used(); }
+
+    /**
+     * @brief Return the free space after the head up to the end of the buffer, fill it and commit() the added bytes.
+     *
+     * @param length output for the size of the span, 0 when the buffer is full
+     * @return uint8* the start of the span
+     */
+    uint8 *writeSpan( size_t &length );
+
+    /**
+     * @brief Add bytes that have been written into the span of writeSpan().
+     */
+    void commit( size_t length ) { m_Head += length; }
+
+    /**
+     * @brief Return the content after the tail up to the end of the buffer, send it and consume() the sent bytes.
+     *
+     * @param length output for the size of the span, 0 when the buffer is empty
+     * @return const uint8* the start of the span
+     */
+    const uint8 *readSpan( size_t &length ) const;
+
+    /**
+     * @brief Remove bytes from the front of the buffer.
+     */
+    void consume( size_t length ) { m_Tail += length; }
+
+private:
+    /**
+     * @brief The content.
+     */
+    uint8 m_Buffer[RING_BUFFER_SIZE];
+
+    /**
+     * @brief The total amount of bytes added and removed, masked they are the write and read position.
+     */
+    uint32 m_Head;
+    uint32 m_Tail;
+};
+
+#endif
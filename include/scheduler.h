@@ -0,0 +1,145 @@
+/**
+ * @file scheduler.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+#include "loopstats.h"
+#include "metrics.h"
+
+/**
+ * @brief Time (in us) of one loop iteration, a task that would not fit in the rest of it waits for the next iteration.
+ */
+#define SCHEDULER_SLICE_US 2000
+
+/**
+ * @brief A task is never deferred more than this many loop iterations in a row.
+ */
+#define SCHEDULER_MAX_DEFER 8
+
+/**
+ * @brief Time (in us) the earlier tasks of a loop iteration may have taken for a task longer than the slice to run,
+ * such a task never fits, so it waits for an iteration that is still nearly idle.
+ */
+#define SCHEDULER_IDLE_US 250
+
+/**
+ * @brief The priority of a task, urgent tasks run first and are never deferred.
+ */
+enum TaskPriority{
+    PRIORITY_URGENT = 0,
+    PRIORITY_NORMAL,
+    PRIORITY_BACKGROUND
+};
+
+/**
+ * @brief The Scheduler class runs the tasks of the main loop cooperatively.
+ * Every task has a period, a priority and a time budget. A loop iteration runs the tasks that are due
+ * in order of priority. A task that is not urgent and is expected to take longer than the rest of the
+ * SCHEDULER_SLICE_US slice waits for the next iteration, so a slow task does not delay the urgent ones.
+ * A task that is expected to take longer than the whole slice only waits while the iteration is not nearly idle.
+ * A task that takes longer than its budget counts an overrun. The durations are also recorded in LoopStats.
+ */
+class Scheduler{
+public:
+    /**
+     * @brief Construct a new Scheduler object
+     *
+     * @param loopStats instance pointer to the loop timing, every task is a loop stage
+     * @param metrics instance pointer to the metrics counters, a failed result of a task is counted when it differs from its previous one
+     */
+    Scheduler( LoopStats *loopStats, Metrics *metrics );
+
+    /**
+     * @brief Register a task, it runs for the first time in the next loop iteration.
+     *
+     * @param stage the loop stage of the task, also the name of the task
+     * @param priority the priority of the task
+     * @param period the time (in ms) between two runs, 0 to run in every loop iteration
+     * @param budget the time (in us) the task may take before it counts an overrun
+     * @param task the function of the task, returns a result code
+     */
+    void add( LoopStage stage, TaskPriority priority, uint32 period, uint32 budget, std::function<uint16()> task );
+
+    /**
+     * @brief Run one loop iteration.
+     */
+    void run();
+
+    /**
+     * @brief Clear the counters of the tasks.
+     */
+    void reset();
+
+    /**
+     * @brief Print the tasks and their counters.
+     *
+     * @param out the output to print to
+     */
+    void print( Print &out );
+
+private:
+    /**
+     * @brief A registered task, result is the result of its last run.
+     */
+    struct Task{
+        LoopStage stage;
+        TaskPriority priority;
+        uint32 period;
+        uint32 budget;
+        std::function<uint16()> run;
+        unsigned long lastRun;
+        uint32 estimate;
+        uint32 deferrals;
+        uint32 runs;
+        uint32 overruns;
+        uint32 deferred;
+        uint32 maxTime;
+        uint16 result;
+    };
+
+    /**
+     * @brief The tasks in order of priority.
+     */
+    std::vector<Task> m_Tasks;
+
+    /**
+     * @brief Instance pointer of the loop timing.
+     */
+    LoopStats *m_LoopStats;
+
+    /**
+     * @brief Instance pointer of the metrics counters.
+     */
+    Metrics *m_Metrics;
+};
+
+#endif
@@ -0,0 +1,173 @@
+/**
+ * @file sensorcontrol.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SENSORCONTROL_H
+#define SENSORCONTROL_H
+
+#include <Arduino.h>
+#include <vector>
+#include "configcontrol.h"
+#include "iocontrol.h"
+#include "metrics.h"
+#include "sensordriver.h"
+
+/**
+ * @brief Default time (in ms) between two measurements of a DS18B20, a DHT11 and a DHT22.
+ * It is also the shortest interval, a DHT returns stale or wrong values when it is read more often.
+ */
+#define SENSOR_INTERVAL_DS18B20 1000
+#define SENSOR_INTERVAL_DHT11 1000
+#define SENSOR_INTERVAL_DHT22 2000
+
+/**
+ * @brief The SensorControl class measures the sensors of the configuration (ConfigControl::Sensors) in the background.
+ * Every sensor has a driver whose state machine is stepped once per loop iteration by update(), the results
+ * are cached with the time of the measurement. The sensor command, the metrics and the /sensor page only
+ * read the cache, so a read never waits for a conversion.
+ */
+class SensorControl{
+public:
+    /**
+     * @brief Construct a new Sensor Control object
+     * 
+     * @param configControl instance pointer to the cofiguration control of the flash memory
+     * @param ioControl instance pointer to the pin control that reserves the data pins
+     * @param metrics instance pointer to the metrics counters
+     */
+    SensorControl( ConfigControl *configControl, IOControl *ioControl, Metrics *metrics );
+
+    /**
+     * @brief Destroy the Sensor Control object and its drivers.
+     */
+    ~SensorControl();
+
+    /**
+     * @brief Start the sensors of the flash memory configuration.
+     */
+    void load();
+
+    /**
+     * @brief Execute a configuration command for a sensor: config sensor SLOT TYPE [PIN] [INTERVAL_MS].
+     * 
+     * @param slot the number of the sensor, 0 to SENSOR_COUNT - 1
+     * @param type the chip, or none to remove the sensor
+     * @param pin the data pin, D1 to D8
+     * @param interval the time between two measurements in ms, empty for the default of the chip
+     * @return uint16 result code
+     */
+    uint16 configure( const String &slot, const String &type, const String &pin, const String &interval );
+
+    /**
+     * @brief Step the measurements in progress and start the ones that are due.
+     * 
+     * @return uint16 result code
+     */
+    uint16 update();
+
+    /**
+     * @brief Execute a sensor command: sensor [SLOT].
+     * 
+     * @param command the command and its arguments
+     * @param out the output the values are printed to
+     * @return uint16 result code
+     */
+    uint16 command( const std::vector<String> &command, Print &out );
+
+    /**
+     * @brief Print the cached values as Prometheus gauges.
+     * 
+     * @param out the output to print to
+     */
+    void printPrometheus( Print &out );
+
+    /**
+     * @brief Print the cached values as space separated key=value pairs.
+     * 
+     * @param out the output to print to
+     */
+    void printCompact( Print &out );
+
+private:
+    /**
+     * @brief The state of a sensor: its driver, the last values and when they were measured.
+     */
+    struct Sensor{
+        SensorDriver *driver;
+        bool busy;
+        bool valid;
+        int values[SENSOR_VALUES];
+        unsigned long valueTime;
+        unsigned long nextStart;
+        uint32 reads;
+        uint32 errors;
+    };
+
+    /**
+     * @brief Reserve the data pin of a sensor and create its driver.
+     * 
+     * @return uint16 result code
+     */
+    uint16 attach( uint slot );
+
+    /**
+     * @brief Delete the driver of a sensor and release its data pin.
+     */
+    void detach( uint slot );
+
+    /**
+     * @brief Print the values of a sensor as name=value pairs and their age in ms.
+     */
+    void printValues( Print &out, uint slot );
+
+    /**
+     * @brief Return the default and shortest measurement interval of a chip.
+     */
+    static uint32 minimumInterval( SensorType type );
+
+    /**
+     * @brief Instance poiner of the configuration data in the flash memory of the NodeMCU.
+     */
+    ConfigControl *m_ConfigControl;
+
+    /**
+     * @brief Instance pointer of the pin control.
+     */
+    IOControl *m_IOControl;
+
+    /**
+     * @brief Instance pointer of the metrics counters.
+     */
+    Metrics *m_Metrics;
+
+    /**
+     * @brief The state of the sensors, by slot.
+     */
+    Sensor m_Sensors[SENSOR_COUNT];
+};
+
+#endif
@@ -0,0 +1,222 @@
+/**
+ * @file sensordriver.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SENSORDRIVER_H
+#define SENSORDRIVER_H
+
+#include <Arduino.h>
+#include "onewire.h"
+
+/**
+ * @brief Maximum amount of values a sensor measures.
+ */
+#define SENSOR_VALUES 2
+
+/**
+ * @brief Time (in ms) a DS18B20 needs for a 12 bit conversion.
+ */
+#define DS18B20_CONVERSION_TIME 750
+
+/**
+ * @brief Time (in ms) the start signal of a DHT11 and a DHT22 holds the line low.
+ */
+#define DHT11_START_TIME 20
+#define DHT22_START_TIME 2
+
+/**
+ * @brief Maximum time (in us) a level of the DHT response lasts, a longer one ends the measurement.
+ */
+#define DHT_LEVEL_TIMEOUT 100
+
+/**
+ * @brief High time (in us) above which a DHT bit is a 1, a 0 is 26 to 28 us and a 1 is 70 us high.
+ */
+#define DHT_BIT_THRESHOLD 48
+
+/**
+ * @brief The result of a step of a sensor driver.
+ */
+enum SensorStep{
+    SENSOR_BUSY = 0,
+    SENSOR_DONE,
+    SENSOR_FAILED
+};
+
+/**
+ * @brief The SensorDriver class is the state machine of a measurement of one sensor chip.
+ * The main loop calls step() until the measurement is done, every step does a short piece of
+ * the bus traffic (at most a few ms) or returns right away while the chip is still busy, so a
+ * conversion that takes the chip hundreds of ms never blocks the loop.
+ * The values are in hundredths: the temperature in centidegrees Celsius, the humidity in centipercent.
+ */
+class SensorDriver{
+public:
+    virtual ~SensorDriver() {}
+
+    /**
+     * @brief Prepare the pin of the sensor.
+     */
+    virtual void begin() = 0;
+
+    /**
+     * @brief Start a measurement.
+     *
+     * @param now the time in ms
+     */
+    virtual void start( unsigned long now ) = 0;
+
+    /**
+     * @brief Do the next step of the measurement.
+     *
+     * @param now the time in ms
+     * @param values output buffer for the values once the measurement is done
+     * @return SensorStep SENSOR_BUSY until the measurement is done or has failed
+     */
+    virtual SensorStep step( unsigned long now, int *values ) = 0;
+
+    /**
+     * @brief Return the amount of values the sensor measures: the temperature, and the humidity for a DHT.
+     */
+    virtual uint valueCount() const = 0;
+};
+
+/**
+ * @brief The Ds18b20 class measures the temperature of a DS18B20, the only device on its 1-Wire bus.
+ * A measurement is: reset, skip ROM, convert T, wait for the conversion, reset, skip ROM,
+ * read scratchpad and the 9 scratchpad bytes (one per step), checked with their CRC.
+ * The sensor needs its own power supply, parasite power is not supported.
+ */
+class Ds18b20 : public SensorDriver{
+public:
+    /**
+     * @brief Construct a new Ds18b20 object
+     *
+     * @param gpio the GPIO of the data line
+     */
+    Ds18b20( uint8 gpio );
+
+    void begin() override;
+    void start( unsigned long now ) override;
+    SensorStep step( unsigned long now, int *values ) override;
+    uint valueCount() const override { return 1; }
+
+private:
+    /**
+     * @brief The steps of a measurement.
+     */
+    enum State{
+        DS18B20_RESET,
+        DS18B20_SKIP,
+        DS18B20_CONVERT,
+        DS18B20_WAIT,
+        DS18B20_READ_RESET,
+        DS18B20_READ_SKIP,
+        DS18B20_READ_COMMAND,
+        DS18B20_READ
+    };
+
+    /**
+     * @brief The 1-Wire bus of the sensor.
+     */
+    OneWire m_Bus;
+
+    /**
+     * @brief The GPIO of the data line.
+     */
+    uint8 m_Gpio;
+
+    /**
+     * @brief The next step of the measurement.
+     */
+    State m_State;
+
+    /**
+     * @brief Time (in ms) at which the conversion started.
+     */
+    unsigned long m_ConvertTime;
+
+    /**
+     * @brief The scratchpad bytes that have been read and their amount.
+     */
+    uint8 m_Scratchpad[9];
+    uint8 m_Length;
+};
+
+/**
+ * @brief The DhtSensor class measures the temperature and the humidity of a DHT11 or a DHT22 (AM2302).
+ * The start signal holds the line low for some ms, it is timed by the steps. The 40 bits of the answer
+ * follow right after the release and are read in one step of about 5 ms, every bit with the interrupts
+ * disabled from its low phase until the end of its high phase.
+ */
+class DhtSensor : public SensorDriver{
+public:
+    /**
+     * @brief Construct a new Dht Sensor object
+     *
+     * @param gpio the GPIO of the data line
+     * @param dht11 true for a DHT11, false for a DHT22
+     */
+    DhtSensor( uint8 gpio, bool dht11 );
+
+    void begin() override;
+    void start( unsigned long now ) override;
+    SensorStep step( unsigned long now, int *values ) override;
+    uint valueCount() const override { return 2; }
+
+private:
+    /**
+     * @brief Release the line and read the 5 bytes of the answer.
+     *
+     * @return true if all bits have been received
+     */
+    bool collect( uint8 *data );
+
+    /**
+     * @brief Wait until the line has a level.
+     *
+     * @return int the time waited in us, -1 after DHT_LEVEL_TIMEOUT
+     */
+    int waitLevel( uint8 level );
+
+    /**
+     * @brief The GPIO of the data line.
+     */
+    uint8 m_Gpio;
+
+    /**
+     * @brief Flag which is set to true for a DHT11.
+     */
+    bool m_Dht11;
+
+    /**
+     * @brief Time (in ms) at which the start signal began.
+     */
+    unsigned long m_StartTime;
+};
+
+#endif
@@ -0,0 +1,267 @@
+/**
+ * @file seriallink.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SERIALLINK_H
+#define SERIALLINK_H
+
+#include <vector>
+#include "metrics.h"
+
+/**
+ * @brief Maximum payload size of a binary serial frame.
+ */
+#define SERIAL_FRAME_PAYLOAD 250
+
+/**
+ * @brief Size of the frame buffers: channel, sequence number, payload, CRC and COBS overhead.
+ */
+#define SERIAL_FRAME_SIZE ( SERIAL_FRAME_PAYLOAD + 8 )
+
+/**
+ * @brief Maximum amount of log bytes carried by a single log frame.
+ */
+#define SERIAL_LOG_PAYLOAD 48
+
+/**
+ * @brief Maximum length of a command line in text mode, longer lines are discarded.
+ */
+#define SERIAL_LINE_SIZE 256
+
+/**
+ * @brief Time (in ms) after which an incomplete command line in text mode is discarded.
+ */
+#define SERIAL_LINE_TIMEOUT 10000
+
+/**
+ * @brief Default baud rate of the binary mode.
+ */
+#define SERIAL_BINARY_BAUD 921600
+
+class NodeMCU;
+
+/**
+ * @brief The channel IDs of binary serial frames.
+ */
+enum SerialChannel{
+    CHANNEL_COMMAND = 0x01,
+    CHANNEL_REPLY = 0x02,
+    CHANNEL_REPLY_DATA = 0x03,
+    CHANNEL_LOG = 0x04
+};
+
+/**
+ * @brief The SerialLink class reads the serial port without blocking, in text mode it collects command lines
+ * and in binary mode it handles command frames.
+ * In binary mode every packet is [channel][sequence][payload][CRC-16 high][CRC-16 low],
+ * COBS encoded and terminated by a 0x00 byte. A command packet carries a command line,
+ * its reply is one or more REPLY_DATA packets with text followed by a REPLY packet that starts with the result code.
+ * Log messages are sent on their own channel so they never mix with replies.
+ */
+class SerialLink{
+public:
+    /**
+     * @brief Construct a new Serial Link object
+     * 
+     * @param nodeMCU instance to the NodeMCU singleton
+     * @param metrics instance pointer to the metrics counters
+     * @param baudRate the baud rate of the text mode
+     */
+    SerialLink( NodeMCU *nodeMCU, Metrics *metrics, const uint &baudRate );
+
+    /**
+     * @brief Return if the serial port is in binary mode.
+     */
+    bool isBinary();
+
+    /**
+     * @brief Execute a serial command, the mode change is applied after the reply has been sent.
+     * serial binary [baud] switches to binary mode, serial text switches back.
+     * 
+     * @param command commands and arguments
+     * @return uint16 result code
+     */
+    uint16 configure( const std::vector<String> &command );
+
+    /**
+     * @brief Switch to the requested mode and baud rate if a change is pending.
+     */
+    void applyMode();
+
+    /**
+     * @brief Return to text mode and drop what has been received, for when the UART has been used by something else.
+     */
+    void reset();
+
+    /**
+     * @brief Return the baud rate of the text mode.
+     */
+    uint32 textBaud() const { return m_TextBaud; }
+
+    /**
+     * @brief Read available bytes in text mode until a command line is complete.
+     * Never waits for bytes that have not arrived yet, a line that is too long or
+     * incomplete for longer than SERIAL_LINE_TIMEOUT is discarded.
+     * 
+     * @param command output buffer for the command and arguments of a complete line
+     * @return uint16 result code
+     */
+    uint16 readLine( std::vector<String> &command );
+
+    /**
+     * @brief Read available bytes and execute every complete command frame.
+     * 
+     * @return uint16 result code
+     */
+    uint16 update();
+
+    /**
+     * @brief Send buffered log messages as log frames as far as the UART has room for them.
+     * Does nothing in text mode, the logger sends them itself.
+     */
+    void flushLog();
+
+    /**
+     * @brief Encode and send a frame.
+     * 
+     * @param channel the channel ID
+     * @param sequence the sequence number of the command the frame belongs to
+     * @param payload the payload bytes
+     * @param length the amount of payload bytes
+     */
+    void sendFrame( uint8 channel, uint8 sequence, const uint8_t *payload, size_t length );
+
+private:
+    /**
+     * @brief Decode, check and execute a received frame.
+     * 
+     * @return uint16 result code
+     */
+    uint16 handleFrame();
+
+    /**
+     * @brief The singleton NodeMCU instance
+     */
+    NodeMCU *m_NodeMCU;
+
+    /**
+     * @brief Instance pointer of the metrics counters.
+     */
+    Metrics *m_Metrics;
+
+    /**
+     * @brief The baud rate of the text mode.
+     */
+    uint32 m_TextBaud;
+
+    /**
+     * @brief Flag which is set to true while in binary mode.
+     */
+    bool m_Binary;
+
+    /**
+     * @brief Flag which is set to true when a mode change is waiting for the reply to be sent.
+     */
+    bool m_ModePending;
+
+    /**
+     * @brief The requested mode.
+     */
+    bool m_PendingBinary;
+
+    /**
+     * @brief The requested baud rate.
+     */
+    uint32 m_PendingBaud;
+
+    /**
+     * @brief The encoded bytes of the frame that is being received.
+     */
+    uint8_t m_RxBuffer[SERIAL_FRAME_SIZE];
+
+    /**
+     * @brief Amount of bytes in the receive buffer.
+     */
+    size_t m_RxLength;
+
+    /**
+     * @brief Flag which is set to true when the frame being received does not fit, it is dropped at the delimiter.
+     */
+    bool m_RxOverflow;
+
+    /**
+     * @brief The command line that is being received in text mode.
+     */
+    char m_Line[SERIAL_LINE_SIZE];
+
+    /**
+     * @brief Amount of bytes in the command line buffer.
+     */
+    size_t m_LineLength;
+
+    /**
+     * @brief Time (in ms) the first byte of the current command line arrived.
+     */
+    unsigned long m_LineStart;
+
+    /**
+     * @brief Flag which is set to true when the current command line does not fit, it is dropped at the newline.
+     */
+    bool m_LineOverflow;
+};
+
+/**
+ * @brief The FrameWriter class collects the reply of a command and sends it as reply frames.
+ */
+class FrameWriter : public Print{
+public:
+    /**
+     * @brief Construct a new Frame Writer object
+     * 
+     * @param link the serial link to send the frames on
+     * @param sequence the sequence number of the command
+     */
+    FrameWriter( SerialLink *link, uint8 sequence );
+
+    size_t write( uint8_t c ) override;
+    size_t write( const uint8_t *buffer, size_t size ) override;
+
+    /**
+     * @brief Send the final reply frame with the result code and the remaining text.
+     * 
+     * @param result the result code of the command
+     */
+    void finish( uint16 result );
+
+private:
+    SerialLink *m_Link;
+    uint8 m_Sequence;
+    uint8_t m_Buffer[SERIAL_FRAME_PAYLOAD];
+    size_t m_Length;
+};
+
+#endif
@@ -30,12 +30,19 @@
 #define TCPCLIENT_H
 
 #include "configcontrol.h"
+#include "metrics.h"
+#include "tokenbucket.h"
 
 /**
  * @brief timeout (in ms) for connected clients that dont do anything.
  */
 #define INACTIVE_TIMEOUT 1000*60*2
 
+/**
+ * @brief Size of the receive buffer of a client, the longest command line that can be received.
+ */
+#define TCP_LINE_SIZE 256
+
 class NodeMCU;
 
 /**
@@ -43,6 +50,8 @@ class NodeMCU;
  * And offers the capability to read client data and safe it as a command, 
  * so it can be used to execute an known command.
  * When a TcpClient didnt receie any input for a while they will automatically be terminated and flagged for removal;
+ * Received data is collected without waiting, commands are executed by the scheduler of the WifiControl
+ * once their line is complete and the rate limits of the client allow it.
  */
 class TcpClient {
 public:
@@ -50,9 +59,11 @@ public:
      * @brief Construct a new Tcp Client object
      * 
      * @param configControl instance pointer to the cofiguration control of the flash memory
+     * @param metrics instance pointer to the metrics counters
      * @param m_WifiClient The ESP8266 WiFiClient retrieed from a WiFiSerer
+     * @param id the unique id of the connection
      */
-    TcpClient( ConfigControl *configControl, WiFiClient wificlient );
+    TcpClient( ConfigControl *configControl, Metrics *metrics, WiFiClient wificlient, uint32 id );
 
     /**
      * @brief Destroy the Tcp Client object
@@ -60,12 +71,59 @@ public:
     ~TcpClient();
 
     /**
-     * @brief Read client data and execute the command
+     * @brief Read the data that has arrived without waiting, as far as the receive buffer has room.
+     * The rest stays in the TCP window, so a client that sends too much is slowed down by flow control.
+     * 
+     * @return uint16 result code, ERROR_CLIENT_DISCONNECTED when the connection is closed
+     */
+    uint16 receive();
+
+    /**
+     * @brief Close the connection.
+     * 
+     * @param result the result code sent to the client as reason, nothing is sent for SUCCESS
+     */
+    void stop( uint16 result );
+
+    /**
+     * @brief Return the time (in ms) since data has been received.
+     */
+    unsigned long idleTime() const;
+
+    /**
+     * @brief Return the amount of received bytes that have not been executed yet.
+     */
+    size_t queued() const { return m_Length; }
+
+    /**
+     * @brief Return the size of the next complete command line.
+     * 
+     * @return size_t the size including the newline, 0 if no line is complete
+     */
+    size_t pendingCommand() const;
+
+    /**
+     * @brief Check the command and bandwidth limits of the client.
+     * A command that has to wait is counted as throttled once.
+     * 
+     * @return true if the next command may be executed
+     */
+    bool allowed();
+
+    /**
+     * @brief Execute the next complete command line and send the reply.
      * 
      * @return uint16 result code
      */
     uint16 handleCommand( NodeMCU *nodeMCU );
 
+    /**
+     * @brief Print the address and the counters of the client on one line.
+     * 
+     * @param out the output to print to
+     */
+    void print( Print &out );
+
     /**
      * @brief Return the active state of the connection
      * 
@@ -74,12 +132,47 @@ public:
      */
     bool isActive();
 
+    /**
+     * @brief The unique id of the connection, used by the timeout timers.
+     */
+    uint32 Id;
+
+    /**
+     * @brief The credit (in bytes) of the client in the deficit round robin of the scheduler.
+     */
+    uint32 Deficit;
+
+    /**
+     * @brief Amount of commands the client has sent.
+     */
+    uint32 Commands;
+
+    /**
+     * @brief Amount of bytes received from the client.
+     */
+    uint32 BytesIn;
+
+    /**
+     * @brief Amount of bytes sent to the client.
+     */
+    uint32 BytesOut;
+
+    /**
+     * @brief Amount of commands that had to wait for the rate limits of the client.
+     */
+    uint32 Throttled;
+
 private:
     
     /**
      * @brief Instance poiner of the configuration data in the flash memory of the NodeMCU.
      */
     ConfigControl *m_ConfigControl;
+
+    /**
+     * @brief Instance pointer of the metrics counters.
+     */
+    Metrics *m_Metrics;
     
     /**
      * @brief The ESP8266 wifi client
@@ -87,19 +180,44 @@ private:
     WiFiClient m_WifiClient;
 
     /**
-     * @brief The start time of last command
+     * @brief The time data has been received last
      */
     unsigned long m_ActiveTime;
 
     /**
-     * @brief The milliseconds of no activity since last command
+     * @brief The time the connection was accepted.
+     */
+    unsigned long m_ConnectTime;
+
+    /**
+     * @brief The received data that has not been executed yet.
+     */
+    char m_Buffer[TCP_LINE_SIZE];
+
+    /**
+     * @brief The amount of bytes in the receive buffer.
+     */
+    size_t m_Length;
+
+    /**
+     * @brief Flag which is set while the rest of a line that did not fit in the buffer is discarded.
+     */
+    bool m_Overflow;
+
+    /**
+     * @brief Flag which is set while the next command waits for the rate limits.
+     */
+    bool m_Throttled;
+
+    /**
+     * @brief The commands per second limit of the client.
      */
-    unsigned long m_InActiveTime;
+    TokenBucket m_CommandRate;
 
     /**
-     * @brief Flag that connection is still active, when set to false it can be cleaned up
+     * @brief The bytes per second limit of the client, received and sent bytes both count.
      */
-    bool m_Active;
+    TokenBucket m_ByteRate;
 };
 
 
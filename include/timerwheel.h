@@ -0,0 +1,102 @@
+/**
+ * @file timerwheel.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <Arduino.h>
+#include <vector>
+
+/**
+ * @brief Amount of slots of a timer wheel, one turn of the wheel takes TIMER_WHEEL_SLOTS times the resolution.
+ */
+#define TIMER_WHEEL_SLOTS 64
+
+/**
+ * @brief The TimerWheel class keeps track of many timeouts at the cost of one slot per tick.
+ * A timer is put in the slot of its expiry time, a delay longer than one turn of the wheel
+ * counts the turns it still has to wait. Only the slots that passed since the last call to expired()
+ * are looked at, instead of checking every timer in every loop iteration.
+ * Timers can not be cancelled, the owner ignores or reschedules an expired timer that is no longer valid.
+ */
+class TimerWheel{
+public:
+    /**
+     * @brief Construct a new Timer Wheel object
+     * 
+     * @param resolution the time (in ms) of one slot
+     */
+    TimerWheel( uint32 resolution );
+
+    /**
+     * @brief Start a timer.
+     * 
+     * @param id the id that is returned when the timer expires
+     * @param delay the time (in ms) until the timer expires, rounded up to the resolution
+     */
+    void schedule( uint32 id, uint32 delay );
+
+    /**
+     * @brief Collect the timers that expired since the last call.
+     * 
+     * @param ids output buffer for the ids of the expired timers
+     * @return true if a timer expired
+     */
+    bool expired( std::vector<uint32> &ids );
+
+private:
+    /**
+     * @brief A timer in a slot.
+     */
+    struct Timer{
+        uint32 id;
+        uint32 turns;
+    };
+
+    /**
+     * @brief The timers by slot.
+     */
+    std::vector<Timer> m_Slots[TIMER_WHEEL_SLOTS];
+
+    /**
+     * @brief The time (in ms) of one slot.
+     */
+    uint32 m_Resolution;
+
+    /**
+     * @brief The slot of the current tick.
+     */
+    uint m_Current;
+
+    /**
+     * @brief The start time of the current tick.
+     */
+    unsigned long m_Tick;
+};
+
+#endif
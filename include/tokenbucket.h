@@ -0,0 +1,84 @@
+/**
+ * @file tokenbucket.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef TOKENBUCKET_H
+#define TOKENBUCKET_H
+
+#include <Arduino.h>
+
+/**
+ * @brief The TokenBucket class limits the rate of an activity.
+ * The bucket fills up with `rate` tokens per second and holds at most one second of tokens,
+ * so a short burst is allowed while the average stays at the rate.
+ * Taking more tokens than there are puts the bucket in debt, which is paid off before anything
+ * is allowed again. This way a cost that is only known afterwards (like the size of a reply) can be charged.
+ */
+class TokenBucket{
+public:
+    /**
+     * @brief Construct a new full Token Bucket object
+     */
+    TokenBucket();
+
+    /**
+     * @brief Check if tokens are available.
+     * 
+     * @param rate the tokens per second, 0 for no limit
+     * @param tokens the amount of tokens that are needed
+     * @return true if the tokens are available or there is no limit
+     */
+    bool available( uint32 rate, uint32 tokens = 1 );
+
+    /**
+     * @brief Take tokens from the bucket, the bucket can get in debt.
+     * 
+     * @param rate the tokens per second, 0 for no limit
+     * @param tokens the amount of tokens to take
+     */
+    void take( uint32 rate, uint32 tokens = 1 );
+
+private:
+    /**
+     * @brief Add the tokens of the time that passed since the last refill.
+     * 
+     * @param rate the tokens per second
+     */
+    void refill( uint32 rate );
+
+    /**
+     * @brief The tokens in the bucket, negative when in debt.
+     */
+    sint32 m_Tokens;
+
+    /**
+     * @brief The time (in ms) up to which tokens have been added.
+     */
+    unsigned long m_Refilled;
+};
+
+#endif
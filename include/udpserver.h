@@ -0,0 +1,217 @@
+/**
+ * @file udpserver.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef UDPSERVER_H
+#define UDPSERVER_H
+
+#include <WiFiUdp.h>
+#include "configcontrol.h"
+#include "metrics.h"
+
+/**
+ * @brief First byte of every UDP datagram.
+ */
+#define UDP_MAGIC 0x4E
+
+/**
+ * @brief Size of the datagram header: magic, flags, sequence number and operation.
+ */
+#define UDP_HEADER_SIZE 5
+
+/**
+ * @brief Maximum amount of pins in one datagram.
+ */
+#define UDP_MAX_PINS 10
+
+/**
+ * @brief Size of the datagram buffers, a reply carries a result code and a value for every pin.
+ */
+#define UDP_PACKET_SIZE ( UDP_HEADER_SIZE + 2 + UDP_MAX_PINS * 3 )
+
+/**
+ * @brief Size of the largest datagram, a pixel upload: the largest payload that is not fragmented on ethernet.
+ */
+#define UDP_MAX_PACKET_SIZE 1472
+
+/**
+ * @brief Amount of senders whose last sequence number is remembered.
+ */
+#define UDP_SOURCES 4
+
+/**
+ * @brief Time (in ms) after which a silent sender is forgotten, so it can start again with any sequence number.
+ */
+#define UDP_SOURCE_TIMEOUT 10000
+
+/**
+ * @brief Maximum amount of datagrams handled per loop iteration, so a flood can not stall the loop.
+ */
+#define UDP_PACKETS_PER_LOOP 8
+
+/**
+ * @brief The flags of a UDP datagram.
+ */
+enum UdpFlags{
+    UDP_FLAG_ACK = 0x01,
+    UDP_FLAG_SYNC = 0x02,
+    UDP_FLAG_SHOW = 0x04,
+    UDP_FLAG_REPLY = 0x80
+};
+
+/**
+ * @brief The operations of a UDP datagram.
+ */
+enum UdpOperation{
+    UDP_WRITE = 0x01,
+    UDP_READ = 0x02,
+    UDP_PIXELS = 0x03
+};
+
+class NodeMCU;
+
+/**
+ * @brief The UdpServer class is the fast path for writes and reads without a connection.
+ * A datagram is [magic][flags][sequence high][sequence low][operation] followed by [pin][value high][value low]
+ * for every pin of a write or [pin] for every pin of a read, pins are the PinId values.
+ * The pins of a write are set at once like a write command with PIN=VALUE arguments, all of them or none.
+ * A read is always answered, a write only when UDP_FLAG_ACK is set. The reply has the same header with
+ * UDP_FLAG_REPLY set, followed by the result code and for a read [pin][value high][value low] for every pin.
+ * Datagrams with a sequence number that is not newer than the last one of their sender are dropped,
+ * a duplicate write is acknowledged again. UDP_FLAG_SYNC accepts any sequence number, for a sender that restarted.
+ * A pixels datagram carries runs for the LED strip, see PixelControl::upload(), up to UDP_MAX_PACKET_SIZE bytes.
+ * With UDP_FLAG_SHOW the frame is shown after the runs, so a large frame is sent in several datagrams
+ * and only the last one has the flag. It is answered like a write.
+ * The listener can join a multicast group, so one datagram reaches all boards of the group at once.
+ */
+class UdpServer{
+public:
+    /**
+     * @brief Construct a new Udp Server object
+     *
+     * @param nodeMCU instance to the NodeMCU singleton
+     * @param configControl instance pointer to the cofiguration control of the flash memory
+     * @param metrics instance pointer to the metrics counters
+     */
+    UdpServer( NodeMCU *nodeMCU, ConfigControl *configControl, Metrics *metrics );
+
+    /**
+     * @brief Start listening on the UDP port and join the multicast group of the configuration.
+     *
+     * @return uint16 result code
+     */
+    uint16 begin();
+
+    /**
+     * @brief Stop listening.
+     */
+    void stop();
+
+    /**
+     * @brief Handle the datagrams that have arrived, at most UDP_PACKETS_PER_LOOP.
+     *
+     * @return uint16 result code
+     */
+    uint16 update();
+
+private:
+    /**
+     * @brief The last datagram of a sender.
+     */
+    struct UdpSource{
+        IPAddress ip;
+        uint16 port;
+        uint16 sequence;
+        uint16 result;
+        unsigned long lastSeen;
+        bool used;
+    };
+
+    /**
+     * @brief Check the sequence number of a datagram against the last one of its sender.
+     *
+     * @param sequence the sequence number of the datagram
+     * @param sync true if the sender started a new sequence
+     * @param source output pointer to the sender
+     * @return true if the datagram is new, false if it is a duplicate or out of order
+     */
+    bool accept( uint16 sequence, bool sync, UdpSource *&source );
+
+    /**
+     * @brief Execute the pins or pixels of a datagram and build the reply.
+     *
+     * @param flags the flags of the datagram
+     * @param operation the operation of the datagram
+     * @param data the pin data after the header
+     * @param length the length of the pin data
+     * @param reply output buffer for the reply, the header is already filled in
+     * @return size_t the length of the reply
+     */
+    size_t execute( uint8 flags, uint8 operation, const uint8_t *data, size_t length, uint8_t *reply );
+
+    /**
+     * @brief Send a reply to the sender of the current datagram.
+     */
+    void sendReply( const uint8_t *reply, size_t length );
+
+    /**
+     * @brief The singleton NodeMCU instance
+     */
+    NodeMCU *m_NodeMCU;
+
+    /**
+     * @brief Instance poiner of the configuration data in the flash memory of the NodeMCU.
+     */
+    ConfigControl *m_ConfigControl;
+
+    /**
+     * @brief Instance pointer of the metrics counters.
+     */
+    Metrics *m_Metrics;
+
+    /**
+     * @brief The ESP8266 UDP socket.
+     */
+    WiFiUDP m_Udp;
+
+    /**
+     * @brief Flag which is set to true while listening.
+     */
+    bool m_Started;
+
+    /**
+     * @brief The senders whose last sequence number is known.
+     */
+    UdpSource m_Sources[UDP_SOURCES];
+
+    /**
+     * @brief The received datagram, a member because a pixel upload is too large for the stack.
+     */
+    uint8_t m_Packet[UDP_MAX_PACKET_SIZE];
+};
+
+#endif
@@ -31,10 +31,44 @@
 
 #include <vector>
 #include "tcpclient.h"
-#include <ESP8266WebServer.h>
+#include "metrics.h"
+#include "udpserver.h"
+#include "timerwheel.h"
+#include "responsewriter.h"
+#include "httpserver.h"
 
 #define MAX_RETRY 10
 
+/**
+ * @brief timeout (in ms) for a single attempt to connect to the access point.
+ */
+#define WIFI_CONNECT_TIMEOUT 5000
+
+/**
+ * @brief Credit (in bytes of command lines) a TCP client with waiting commands gets per scheduler round.
+ */
+#define TCP_QUANTUM 64
+
+/**
+ * @brief Bytes of TCP command lines executed per loop iteration, the rest waits for the next iteration.
+ */
+#define TCP_LOOP_BUDGET 512
+
+/**
+ * @brief Maximum amount of TCP connections admitted per loop iteration.
+ */
+#define TCP_ACCEPT_PER_LOOP 4
+
+/**
+ * @brief Time (in ms) without data after which a TCP client may be evicted for a new connection.
+ */
+#define TCP_EVICT_IDLE 5000
+
+/**
+ * @brief Resolution (in ms) of the timer wheel of the TCP client timeouts.
+ */
+#define TCP_TIMEOUT_RESOLUTION 100
+
 class NodeMCU;
 
 /**
@@ -49,8 +83,9 @@ public:
      * @brief Construct a new Wifi Control:: Wifi Control object
      * @param nodeMCU instance to the NodeMCU singleton
      * @param configControl instance pointer to the cofiguration control of the flash memory
+     * @param metrics instance pointer to the metrics counters
      */
-    WifiControl( NodeMCU *nodeMCU, ConfigControl *configControl );
+    WifiControl( NodeMCU *nodeMCU, ConfigControl *configControl, Metrics *metrics );
 
     /**
      * @brief Destroy the WifiServer object.
@@ -59,7 +94,7 @@ public:
     
     /**
      * @brief Connect to wifi.
-     * will skip if already connected
+     * will skip if already connected, with fast boot enabled it will not wait for the connection
      * 
      * @return uint16 result code
      */
@@ -81,6 +116,14 @@ public:
      */
     uint16 updateHttpSerer();
 
+    /**
+     * @brief Handle incomming UDP datagrams
+     * and start or stop the UDP server when the UDP port or the multicast group has changed
+     * 
+     * @return uint16 result code
+     */
+    uint16 updateUdpServer();
+
     /**
      * @brief Configure the server settings.
      * 
@@ -90,7 +133,29 @@ public:
      */
     uint16 configure( const ConfigCommand &command, const String &value );
 
+    /**
+     * @brief Print the connected TCP clients and their counters.
+     * 
+     * @param out the output to print to
+     */
+    void printClients( Print &out );
+
 private:
+    /**
+     * @brief Execute the waiting commands of the TCP clients with deficit round robin.
+     */
+    void scheduleTcpClients();
+
+    /**
+     * @brief Accept a waiting TCP connection, when the server is full the admission policy decides.
+     */
+    void admitTcpClient();
+
+    /**
+     * @brief Close the TCP clients whose timeout expired.
+     */
+    void expireTcpClients();
+
     /**
      * @brief Load index.html or the corresponding CSS, JS or Font files from the flash memory.
      * 
@@ -98,6 +163,15 @@ private:
      */
     void handleFileRequest( String path );
 
+    /**
+     * @brief Send the response to the current HTTP request.
+     * 
+     * @param code the HTTP status code
+     * @param contentType the content type of the response
+     * @param content the response body
+     */
+    void sendResponse( int code, const char *contentType, const String &content );
+
     /**
      * @brief The singleton NodeMCU instance
      */
@@ -107,6 +181,26 @@ private:
      * @brief Vector containing the current connected clients
      */
     std::vector<TcpClient> m_TcpClients;
+
+    /**
+     * @brief The client the scheduler starts with in the next loop iteration.
+     */
+    uint m_NextClient;
+
+    /**
+     * @brief The id of the next accepted TCP client.
+     */
+    uint32 m_NextClientId;
+
+    /**
+     * @brief The inactivity timeouts of the TCP clients by id.
+     */
+    TimerWheel m_Timeouts;
+
+    /**
+     * @brief Buffer for the ids of the expired timeouts.
+     */
+    std::vector<uint32> m_Expired;
     
     /**
      * @brief The ESP8266 wifi server instance
@@ -114,9 +208,19 @@ private:
     WiFiServer *m_TcpServer;
 
     /**
-     * @brief The ESP8266 web server instance
+     * @brief The HTTP server instance
+     */
+    HttpServer *m_HttpServer;
+
+    /**
+     * @brief The UDP fast path for writes and reads
      */
-    ESP8266WebServer *m_HttpServer;
+    UdpServer m_UdpServer;
+
+    /**
+     * @brief Flag which is set to true when the UDP server has to be (re)started or stopped
+     */
+    bool m_UdpServerChanged;
 
     /**
      * @brief Flag which is set to true when the TCP server has started
@@ -133,10 +237,25 @@ private:
      */
     ConfigControl *m_ConfigControl;
 
+    /**
+     * @brief Instance pointer of the metrics counters.
+     */
+    Metrics *m_Metrics;
+
     /**
      * @brief The amount of times the wifi connection has tried to be established but failed.
      */
     uint m_ConnectRetries;
+
+    /**
+     * @brief Flag which is set to true while waiting for the access point to accept the connection.
+     */
+    bool m_Connecting;
+
+    /**
+     * @brief The start time of the current connection attempt.
+     */
+    unsigned long m_ConnectStart;
 };
 
 
@@ -0,0 +1,268 @@
+/**
+ * @file Arduino.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Arduino.h"
+#include <chrono>
+#include <poll.h>
+#include <thread>
+#include <unistd.h>
+
+HardwareSerial Serial( 0 );
+HardwareSerial Serial1( 1 );
+EspClass ESP;
+GpioRegister GPO( 0, 16 );
+GpioRegister GP16O( 16, 1 );
+
+unsigned long millis(){
+    return hal::nowUs() / 1000;
+}
+
+unsigned long micros(){
+    return hal::nowUs();
+}
+
+void delay( unsigned long ms ){
+    if( hal::board().ManualClock ) hal::advance( ms * 1000 );
+    else std::this_thread::sleep_for( std::chrono::milliseconds( ms ) );
+}
+
+void delayMicroseconds( unsigned int us ){
+    if( hal::board().ManualClock ) hal::advance( us );
+    else if( us < 1000 ) {
+        // A sleep overshoots short delays by far, bit-banged protocols need them to be close
+        uint64_t end = hal::nowUs() + us;
+        while( hal::nowUs() < end );
+    }
+    else std::this_thread::sleep_for( std::chrono::microseconds( us ) );
+}
+
+void yield(){
+    // A stopped clock would let blocking reads wait forever, so every yield takes a millisecond
+    if( hal::board().ManualClock ) hal::advance( 1000 );
+}
+
+void pinMode( uint8_t pin, uint8_t mode ){
+    if( pin >= HAL_PIN_COUNT ) return;
+    hal::board().Modes[pin] = mode;
+    if( mode == INPUT_PULLUP ) hal::board().Values[pin] = HIGH;
+}
+
+void digitalWrite( uint8_t pin, uint8_t value ){
+    if( pin >= HAL_PIN_COUNT ) return;
+    hal::Board &board = hal::board();
+    board.Values[pin] = value ? HIGH : LOW;
+    if( board.Output ) board.Output( pin, board.Values[pin], hal::nowUs() );
+}
+
+GpioRegister::operator uint32_t() const {
+    hal::Board &board = hal::board();
+    uint32_t bits = 0;
+    for( uint8_t i = 0; i < m_Count; i++ ) if( board.Values[m_First + i] ) bits |= 1u << i;
+    return bits;
+}
+
+GpioRegister &GpioRegister::operator=( uint32_t bits ){
+    // All pins change first, the listener sees them with the same timestamp
+    hal::Board &board = hal::board();
+    uint32_t changed = *this ^ bits;
+    for( uint8_t i = 0; i < m_Count; i++ ) board.Values[m_First + i] = bits >> i & 1;
+    uint64_t now = hal::nowUs();
+    for( uint8_t i = 0; i < m_Count; i++ ){
+        if( board.Output && changed >> i & 1 ) board.Output( m_First + i, board.Values[m_First + i], now );
+    }
+    return *this;
+}
+
+int digitalRead( uint8_t pin ){
+    if( pin >= HAL_PIN_COUNT ) return LOW;
+    hal::Board &board = hal::board();
+    // An open-drain output that drives low reads low, released it reads what the line does
+    if( board.Modes[pin] == OUTPUT_OPEN_DRAIN && !board.Values[pin] ) return LOW;
+    if( board.Input && board.Modes[pin] != OUTPUT ) {
+        int value = board.Input( pin, hal::nowUs() );
+        if( value >= 0 ) return value ? HIGH : LOW;
+    }
+    return board.Values[pin] ? HIGH : LOW;
+}
+
+int analogRead( uint8_t pin ){
+    hal::Board &board = hal::board();
+    if( pin != A0 ) return 0;
+    if( board.Input ) {
+        int value = board.Input( pin, hal::nowUs() );
+        if( value >= 0 ) return constrain( value, 0, 1023 );
+    }
+    return board.Values[pin];
+}
+
+void analogWrite( uint8_t pin, int value ){
+    if( pin >= HAL_PIN_COUNT ) return;
+    hal::Board &board = hal::board();
+    board.Values[pin] = value;
+    if( board.Output ) board.Output( pin, value, hal::nowUs() );
+}
+
+long random( long max ){
+    return max > 0 ? hal::board().Random() % max : 0;
+}
+
+long random( long min, long max ){
+    return max > min ? min + random( max - min ) : min;
+}
+
+void randomSeed( unsigned long seed ){
+    hal::board().Random.seed( seed );
+}
+
+void attachInterrupt( uint8_t pin, std::function<void( void )> handler, int mode ){
+    if( pin >= HAL_PIN_COUNT ) return;
+    hal::Board &board = hal::board();
+    board.Interrupts[pin] = handler;
+    board.InterruptModes[pin] = mode;
+    board.InterruptLevels[pin] = digitalRead( pin );
+}
+
+void attachInterruptArg( uint8_t pin, void ( *handler )( void* ), void *arg, int mode ){
+    attachInterrupt( pin, [ handler, arg ](){ handler( arg ); }, mode );
+}
+
+void detachInterrupt( uint8_t pin ){
+    if( pin < HAL_PIN_COUNT ) hal::board().Interrupts[pin] = nullptr;
+}
+
+/**
+ * @brief Run the interrupt handlers of the pins of the selected board whose level changed since the last check.
+ */
+void hal::checkInterrupts(){
+    hal::Board &board = hal::board();
+    for( uint8_t pin = 0; pin < HAL_PIN_COUNT; pin++ ){
+        if( !board.Interrupts[pin] ) continue;
+        int level = digitalRead( pin );
+        if( level == board.InterruptLevels[pin] ) continue;
+        board.InterruptLevels[pin] = level;
+        int mode = board.InterruptModes[pin];
+        if( mode == CHANGE || ( mode == RISING && level ) || ( mode == FALLING && !level ) ) board.Interrupts[pin]();
+    }
+}
+
+void HardwareSerial::begin( unsigned long baud, SerialConfig config, SerialMode, uint8_t, bool invert ){
+    if( m_Uart ) {
+        hal::board().Serial1Invert = invert;
+        return;
+    }
+    hal::board().Baud = baud;
+    hal::board().SerialFormat = config;
+}
+
+/**
+ * @brief Move UART 0 to GPIO13 (RX) and GPIO15 (TX) or back.
+ */
+void HardwareSerial::swap(){
+    if( !m_Uart ) hal::board().SerialSwapped = !hal::board().SerialSwapped;
+}
+
+void HardwareSerial::updateBaudRate( unsigned long baud ){
+    if( !m_Uart ) hal::board().Baud = baud;
+}
+
+unsigned long HardwareSerial::baudRate() const {
+    return hal::board().Baud;
+}
+
+int HardwareSerial::available(){
+    hal::Board &board = hal::board();
+    if( m_Uart ) return 0;
+    if( board.SerialStdio ) {
+        // Move what stdin has to the receive buffer without blocking
+        pollfd input = { 0, POLLIN, 0 };
+        char buffer[256];
+        ssize_t length;
+        if( board.SerialIn.empty() && poll( &input, 1, 0 ) > 0 && ( length = ::read( 0, buffer, sizeof( buffer ) ) ) > 0 ) {
+            board.SerialIn.append( buffer, length );
+        }
+    }
+    return board.SerialIn.size();
+}
+
+int HardwareSerial::read(){
+    if( !available() ) return -1;
+    std::string &input = hal::board().SerialIn;
+    int c = static_cast<uint8_t>( input[0] );
+    input.erase( 0, 1 );
+    return c;
+}
+
+size_t HardwareSerial::read( uint8_t *buffer, size_t size ){
+    size_t count = 0;
+    while( count < size && available() ) buffer[count++] = read();
+    return count;
+}
+
+int HardwareSerial::peek(){
+    if( !available() ) return -1;
+    return static_cast<uint8_t>( hal::board().SerialIn[0] );
+}
+
+size_t HardwareSerial::write( uint8_t c ){
+    return write( &c, 1 );
+}
+
+size_t HardwareSerial::write( const uint8_t *buffer, size_t size ){
+    hal::Board &board = hal::board();
+    if( m_Uart ) {
+        board.Serial1Out.append( reinterpret_cast<const char*>( buffer ), size );
+        return size;
+    }
+    if( board.SerialStdio ) return fwrite( buffer, 1, size, stdout );
+    board.SerialOut.append( reinterpret_cast<const char*>( buffer ), size );
+    return size;
+}
+
+int HardwareSerial::availableForWrite(){
+    return HAL_SERIAL_FIFO;
+}
+
+void HardwareSerial::flush(){
+    if( hal::board().SerialStdio ) fflush( stdout );
+}
+
+uint32_t EspClass::getFreeHeap(){
+    return hal::board().FreeHeap;
+}
+
+uint32_t EspClass::getMaxFreeBlockSize(){
+    return hal::board().MaxFreeBlock;
+}
+
+uint8_t EspClass::getHeapFragmentation(){
+    return hal::board().HeapFragmentation;
+}
+
+uint32_t EspClass::getCycleCount(){
+    return static_cast<uint32_t>( hal::nowUs() * getCpuFreqMHz() );
+}
@@ -0,0 +1,186 @@
+/**
+ * @file Arduino.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include "c_types.h"
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "hal.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+
+#define LOW 0
+#define HIGH 1
+
+#define INPUT 0x00
+#define INPUT_PULLUP 0x02
+#define OUTPUT 0x01
+#define OUTPUT_OPEN_DRAIN 0x03
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+/**
+ * @brief The UART frame formats, with the bits of the ESP8266 core: data bits 5 to 8 in bits 2-3,
+ * parity (none 0x0, even 0x2, odd 0x3) in bits 0-1 and 1 (0x10) or 2 (0x30) stop bits.
+ */
+enum SerialConfig{
+    SERIAL_5N1 = 0x10, SERIAL_6N1 = 0x14, SERIAL_7N1 = 0x18, SERIAL_8N1 = 0x1c,
+    SERIAL_5N2 = 0x30, SERIAL_6N2 = 0x34, SERIAL_7N2 = 0x38, SERIAL_8N2 = 0x3c,
+    SERIAL_5E1 = 0x12, SERIAL_6E1 = 0x16, SERIAL_7E1 = 0x1a, SERIAL_8E1 = 0x1e,
+    SERIAL_5E2 = 0x32, SERIAL_6E2 = 0x36, SERIAL_7E2 = 0x3a, SERIAL_8E2 = 0x3e,
+    SERIAL_5O1 = 0x13, SERIAL_6O1 = 0x17, SERIAL_7O1 = 0x1b, SERIAL_8O1 = 0x1f,
+    SERIAL_5O2 = 0x33, SERIAL_6O2 = 0x37, SERIAL_7O2 = 0x3b, SERIAL_8O2 = 0x3f
+};
+
+/**
+ * @brief The directions a UART is started with.
+ */
+enum SerialMode{
+    SERIAL_FULL = 0, SERIAL_RX_ONLY = 1, SERIAL_TX_ONLY = 2
+};
+
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+#define PROGMEM
+#define F( text ) ( text )
+
+/**
+ * @brief The NodeMCU pin names and their GPIO numbers.
+ */
+static const uint8_t D0 = 16;
+static const uint8_t D1 = 5;
+static const uint8_t D2 = 4;
+static const uint8_t D3 = 0;
+static const uint8_t D4 = 2;
+static const uint8_t D5 = 14;
+static const uint8_t D6 = 12;
+static const uint8_t D7 = 13;
+static const uint8_t D8 = 15;
+static const uint8_t RX = 3;
+static const uint8_t TX = 1;
+static const uint8_t A0 = HAL_PIN_A0;
+
+unsigned long millis();
+unsigned long micros();
+void delay( unsigned long ms );
+void delayMicroseconds( unsigned int us );
+void yield();
+
+void pinMode( uint8_t pin, uint8_t mode );
+void digitalWrite( uint8_t pin, uint8_t value );
+int digitalRead( uint8_t pin );
+int analogRead( uint8_t pin );
+void analogWrite( uint8_t pin, int value );
+
+/**
+ * @brief A GPIO output register of the ESP8266 (esp8266_peri.h), GPO holds GPIO0-15 and GP16O holds GPIO16.
+ * Writing a register changes all of its pins of the selected board at the same time.
+ */
+class GpioRegister {
+public:
+    GpioRegister( uint8_t first, uint8_t count ) : m_First( first ), m_Count( count ) {}
+    operator uint32_t() const;
+    GpioRegister &operator=( uint32_t bits );
+
+private:
+    uint8_t m_First;
+    uint8_t m_Count;
+};
+
+extern GpioRegister GPO;
+extern GpioRegister GP16O;
+
+void attachInterrupt( uint8_t pin, std::function<void( void )> handler, int mode );
+void attachInterruptArg( uint8_t pin, void ( *handler )( void* ), void *arg, int mode );
+void detachInterrupt( uint8_t pin );
+inline int digitalPinToInterrupt( uint8_t pin ) { return pin; }
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+long random( long max );
+long random( long min, long max );
+void randomSeed( unsigned long seed );
+
+template<typename T> T constrain( T value, T low, T high ) { return value < low ? low : ( value > high ? high : value ); }
+
+/**
+ * @brief The UARTs of the selected board, see hal::Board. UART 1 only transmits.
+ */
+class HardwareSerial : public Stream {
+public:
+    HardwareSerial( int uart ) : m_Uart( uart ) {}
+    void begin( unsigned long baud, SerialConfig config = SERIAL_8N1, SerialMode mode = SERIAL_FULL, uint8_t txPin = 1, bool invert = false );
+    void swap();
+    void end() {}
+    void updateBaudRate( unsigned long baud );
+    unsigned long baudRate() const;
+    void setRxBufferSize( size_t ) {}
+
+    int available() override;
+    int read() override;
+    size_t read( uint8_t *buffer, size_t size );
+    int peek() override;
+    size_t write( uint8_t c ) override;
+    size_t write( const uint8_t *buffer, size_t size ) override;
+    using Print::write;
+    int availableForWrite() override;
+    void flush() override;
+    explicit operator bool() const { return true; }
+
+private:
+    int m_Uart;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+/**
+ * @brief The ESP8266 system functions, the heap values come from the selected board.
+ */
+class EspClass {
+public:
+    uint32_t getFreeHeap();
+    uint32_t getMaxFreeBlockSize();
+    uint8_t getHeapFragmentation();
+    uint32_t getCycleCount();
+    uint8_t getCpuFreqMHz() { return 80; }
+    void restart() {}
+    void reset() {}
+};
+
+extern EspClass ESP;
+
+#endif
@@ -0,0 +1,251 @@
+/**
+ * @file ESP8266WebServer.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ESP8266WebServer.h"
+#include <strings.h>
+
+/**
+ * @brief Decode a form or query value, + is a space and %XX a reserved character.
+ */
+static String urlDecode( const std::string &text ){
+    std::string decoded;
+    for( size_t i = 0; i < text.size(); i++ ){
+        if( text[i] == '+' ) decoded += ' ';
+        else if( text[i] == '%' && i + 2 < text.size() ) {
+            decoded += static_cast<char>( strtol( text.substr( i + 1, 2 ).c_str(), nullptr, 16 ) );
+            i += 2;
+        }
+        else decoded += text[i];
+    }
+    return String( decoded );
+}
+
+/**
+ * @brief Return the reason phrase of a status code.
+ */
+static const char *reason( int code ){
+    switch( code ){
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    default: return "";
+    }
+}
+
+ESP8266WebServer::ESP8266WebServer( int port )
+: m_Server( port )
+, m_ClientStart( 0 )
+, m_Method( HTTP_GET )
+, m_ContentLength( CONTENT_LENGTH_NOT_SET )
+, m_Chunked( false )
+, m_HeadersSent( false )
+{}
+
+void ESP8266WebServer::begin(){
+    m_Server.begin();
+}
+
+void ESP8266WebServer::close(){
+    m_Client.stop();
+    m_Server.stop();
+}
+
+void ESP8266WebServer::on( const String &uri, HTTPMethod method, THandlerFunction handler ){
+    m_Routes.push_back( { uri, method, handler } );
+}
+
+void ESP8266WebServer::handleClient(){
+    if( !m_Client ) {
+        if( !m_Server.hasClient() ) return;
+        m_Client = m_Server.accept();
+        m_ClientStart = millis();
+        m_Request.clear();
+    }
+
+    if( !readRequest() ) {
+        // Give up on clients that are gone or too slow
+        if( !m_Client.connected() || millis() - m_ClientStart > HTTP_MAX_DATA_WAIT ) {
+            m_Client.stop();
+            m_Client = WiFiClient();
+        }
+        return;
+    }
+    handleRequest();
+    m_Client.stop();
+    m_Client = WiFiClient();
+}
+
+bool ESP8266WebServer::readRequest(){
+    int length = m_Client.available();
+    if( length > 0 ) {
+        size_t size = m_Request.size();
+        m_Request.resize( size + length );
+        m_Client.read( reinterpret_cast<uint8_t*>( &m_Request[size] ), length );
+    }
+
+    size_t end = m_Request.find( "\r\n\r\n" );
+    if( end == std::string::npos ) return false;
+
+    // GET /read?pin=D1 HTTP/1.1
+    size_t lineEnd = m_Request.find( "\r\n" );
+    std::string line = m_Request.substr( 0, lineEnd );
+    size_t space = line.find( ' ' );
+    size_t secondSpace = line.find( ' ', space + 1 );
+    if( space == std::string::npos ) return false;
+    std::string method = line.substr( 0, space );
+    std::string target = line.substr( space + 1, secondSpace == std::string::npos ? std::string::npos : secondSpace - space - 1 );
+
+    m_RequestHeaders.clear();
+    size_t contentLength = 0;
+    size_t start = lineEnd + 2;
+    while( start < end ){
+        size_t next = m_Request.find( "\r\n", start );
+        std::string header = m_Request.substr( start, next - start );
+        size_t colon = header.find( ':' );
+        if( colon != std::string::npos ) {
+            std::string value = header.substr( colon + 1 );
+            value.erase( 0, value.find_first_not_of( ' ' ) );
+            m_RequestHeaders.emplace_back( String( header.substr( 0, colon ) ), String( value ) );
+            if( strcasecmp( header.substr( 0, colon ).c_str(), "Content-Length" ) == 0 ) contentLength = strtoul( value.c_str(), nullptr, 10 );
+        }
+        start = next + 2;
+    }
+    if( m_Request.size() < end + 4 + contentLength ) return false;
+    std::string body = m_Request.substr( end + 4, contentLength );
+
+    m_Method = method == "POST" ? HTTP_POST : method == "PUT" ? HTTP_PUT : method == "DELETE" ? HTTP_DELETE
+             : method == "HEAD" ? HTTP_HEAD : method == "PATCH" ? HTTP_PATCH : method == "OPTIONS" ? HTTP_OPTIONS : HTTP_GET;
+    size_t query = target.find( '?' );
+    m_Uri = String( target.substr( 0, query ) );
+    m_Args.clear();
+    if( query != std::string::npos ) parseArguments( target.substr( query + 1 ) );
+    if( body.size() ) {
+        if( header( "Content-Type" ).startsWith( "application/x-www-form-urlencoded" ) ) parseArguments( body );
+        else m_Args.emplace_back( String( "plain" ), String( body ) );
+    }
+    return true;
+}
+
+void ESP8266WebServer::parseArguments( const std::string &text ){
+    size_t start = 0;
+    while( start < text.size() ){
+        size_t end = text.find( '&', start );
+        if( end == std::string::npos ) end = text.size();
+        std::string pair = text.substr( start, end - start );
+        size_t equals = pair.find( '=' );
+        if( pair.size() ) {
+            if( equals == std::string::npos ) m_Args.emplace_back( urlDecode( pair ), String() );
+            else m_Args.emplace_back( urlDecode( pair.substr( 0, equals ) ), urlDecode( pair.substr( equals + 1 ) ) );
+        }
+        start = end + 1;
+    }
+}
+
+void ESP8266WebServer::handleRequest(){
+    m_ResponseHeaders.clear();
+    m_ContentLength = CONTENT_LENGTH_NOT_SET;
+    m_Chunked = false;
+    m_HeadersSent = false;
+
+    THandlerFunction handler = m_NotFound;
+    for( const Route &route: m_Routes ){
+        if( route.Uri == m_Uri && ( route.Method == HTTP_ANY || route.Method == m_Method ) ) {
+            handler = route.Handler;
+            break;
+        }
+    }
+    if( handler ) handler();
+    else send( 404, "text/plain", String( "Not found: " ) + m_Uri );
+
+    // A chunked response ends with an empty chunk
+    if( m_Chunked ) m_Client.write( "0\r\n\r\n" );
+}
+
+String ESP8266WebServer::arg( const String &name ) const {
+    for( const auto &arg: m_Args ) if( arg.first == name ) return arg.second;
+    return String();
+}
+
+String ESP8266WebServer::arg( int index ) const {
+    return index >= 0 && index < args() ? m_Args[index].second : String();
+}
+
+String ESP8266WebServer::argName( int index ) const {
+    return index >= 0 && index < args() ? m_Args[index].first : String();
+}
+
+bool ESP8266WebServer::hasArg( const String &name ) const {
+    for( const auto &arg: m_Args ) if( arg.first == name ) return true;
+    return false;
+}
+
+String ESP8266WebServer::header( const String &name ) const {
+    for( const auto &header: m_RequestHeaders ) if( header.first.equalsIgnoreCase( name ) ) return header.second;
+    return String();
+}
+
+void ESP8266WebServer::sendHeader( const String &name, const String &value, bool first ){
+    std::string line = name.str() + ": " + value.str() + "\r\n";
+    if( first ) m_ResponseHeaders.insert( 0, line );
+    else m_ResponseHeaders += line;
+}
+
+void ESP8266WebServer::send( int code, const char *contentType, const String &content ){
+    if( m_HeadersSent ) return;
+    std::string headers = "HTTP/1.1 " + std::to_string( code ) + " " + reason( code ) + "\r\n";
+    if( contentType && *contentType ) headers += std::string( "Content-Type: " ) + contentType + "\r\n";
+    if( m_ContentLength == CONTENT_LENGTH_UNKNOWN ) {
+        m_Chunked = true;
+        headers += "Transfer-Encoding: chunked\r\n";
+    } else {
+        size_t length = m_ContentLength == CONTENT_LENGTH_NOT_SET ? content.length() : m_ContentLength;
+        headers += "Content-Length: " + std::to_string( length ) + "\r\n";
+    }
+    headers += m_ResponseHeaders;
+    headers += "Connection: close\r\n\r\n";
+    m_HeadersSent = true;
+    m_Client.write( headers.data(), headers.size() );
+    if( content.length() ) sendContent( content );
+}
+
+void ESP8266WebServer::sendContent( const char *content, size_t size ){
+    if( !size ) return;
+    if( m_Chunked ) {
+        char length[20];
+        snprintf( length, sizeof( length ), "%zX\r\n", size );
+        m_Client.write( length );
+        m_Client.write( content, size );
+        m_Client.write( "\r\n" );
+    } else {
+        m_Client.write( content, size );
+    }
+}
@@ -0,0 +1,145 @@
+/**
+ * @file ESP8266WebServer.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ESP8266WEBSERVER_H
+#define ESP8266WEBSERVER_H
+
+#include "ESP8266WiFi.h"
+#include "FS.h"
+#include <functional>
+#include <utility>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+#define CONTENT_LENGTH_UNKNOWN ( (size_t) -1 )
+#define CONTENT_LENGTH_NOT_SET ( (size_t) -2 )
+
+/**
+ * @brief The time a client gets to send its complete request, in ms.
+ */
+#define HTTP_MAX_DATA_WAIT 5000
+
+/**
+ * @brief A HTTP/1.1 server with the request handling of the ESP8266 core: one request per connection,
+ * routes by path and method, query and form arguments.
+ * A request is collected over several handleClient calls, so a slow client does not block the loop.
+ */
+class ESP8266WebServer {
+public:
+    typedef std::function<void( void )> THandlerFunction;
+
+    ESP8266WebServer( int port = 80 );
+
+    void begin();
+    void close();
+    void stop() { close(); }
+    void handleClient();
+
+    void on( const String &uri, THandlerFunction handler ) { on( uri, HTTP_ANY, handler ); }
+    void on( const String &uri, HTTPMethod method, THandlerFunction handler );
+    void onNotFound( THandlerFunction handler ) { m_NotFound = handler; }
+
+    const String &uri() const { return m_Uri; }
+    HTTPMethod method() const { return m_Method; }
+    String arg( const String &name ) const;
+    String arg( int index ) const;
+    String argName( int index ) const;
+    int args() const { return m_Args.size(); }
+    bool hasArg( const String &name ) const;
+    String header( const String &name ) const;
+    WiFiClient &client() { return m_Client; }
+
+    void setContentLength( size_t length ) { m_ContentLength = length; }
+    void sendHeader( const String &name, const String &value, bool first = false );
+    void send( int code, const char *contentType = nullptr, const String &content = String() );
+    void send( int code, const String &contentType, const String &content ) { send( code, contentType.c_str(), content ); }
+    void sendContent( const String &content ) { sendContent( content.c_str(), content.length() ); }
+    void sendContent( const char *content, size_t size );
+
+    /**
+     * @brief Send a file as response.
+     *
+     * @return size_t the amount of sent file bytes
+     */
+    template<typename T> size_t streamFile( T &file, const String &contentType ){
+        setContentLength( file.size() );
+        send( 200, contentType.c_str() );
+        uint8_t buffer[1460];
+        size_t sent = 0;
+        while( size_t length = file.read( buffer, sizeof( buffer ) ) ) sent += m_Client.write( buffer, length );
+        return sent;
+    }
+
+private:
+    /**
+     * @brief A handler registered with on().
+     */
+    struct Route {
+        String Uri;
+        HTTPMethod Method;
+        THandlerFunction Handler;
+    };
+
+    /**
+     * @brief Collect the bytes of the request and parse it when it is complete.
+     *
+     * @return true if the request is complete
+     */
+    bool readRequest();
+
+    /**
+     * @brief Parse the arguments of a query string or form body.
+     */
+    void parseArguments( const std::string &text );
+
+    /**
+     * @brief Run the handler of the request and end the response.
+     */
+    void handleRequest();
+
+    WiFiServer m_Server;
+    WiFiClient m_Client;
+    unsigned long m_ClientStart;
+    std::string m_Request;
+
+    std::vector<Route> m_Routes;
+    THandlerFunction m_NotFound;
+
+    String m_Uri;
+    HTTPMethod m_Method;
+    std::vector<std::pair<String, String>> m_Args;
+    std::vector<std::pair<String, String>> m_RequestHeaders;
+
+    std::string m_ResponseHeaders;
+    size_t m_ContentLength;
+    bool m_Chunked;
+    bool m_HeadersSent;
+};
+
+#endif
@@ -0,0 +1,261 @@
+/**
+ * @file ESP8266WiFi.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ESP8266WiFi.h"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/**
+ * @brief The time a write waits for a full socket buffer to drain, in ms.
+ */
+#define HAL_WRITE_TIMEOUT 5000
+
+ESP8266WiFiClass WiFi;
+
+wl_status_t ESP8266WiFiClass::status(){
+    return hal::board().WifiConnected ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+bool ESP8266WiFiClass::config( IPAddress local, IPAddress, IPAddress, IPAddress, IPAddress ){
+    m_LocalIP = local;
+    return true;
+}
+
+wl_status_t ESP8266WiFiClass::begin( const String &, const String & ){
+    return status();
+}
+
+IPAddress ESP8266WiFiClass::localIP(){
+    return m_LocalIP;
+}
+
+ClientSocket::ClientSocket( int fd )
+: Fd( fd )
+, PeerClosed( false )
+, ReadIndex( 0 )
+{
+    hal::watch( fd );
+}
+
+ClientSocket::~ClientSocket(){
+    close();
+}
+
+void ClientSocket::close(){
+    if( Fd < 0 ) return;
+    hal::unwatch( Fd );
+    ::close( Fd );
+    Fd = -1;
+    Received.clear();
+    ReadIndex = 0;
+    Delayed.clear();
+}
+
+void ClientSocket::receive(){
+    if( Fd < 0 ) return;
+    if( ReadIndex == Received.size() ) {
+        Received.clear();
+        ReadIndex = 0;
+    }
+
+    // Delayed segments become readable in order, once their time has come
+    uint64_t now = hal::nowUs();
+    while( Delayed.size() && Delayed.front().first <= now ){
+        Received += Delayed.front().second;
+        Delayed.pop_front();
+    }
+    if( PeerClosed ) return;
+
+    hal::Board &board = hal::board();
+    bool delayed = board.LatencyUs || board.JitterUs || board.LossRate > 0 || Delayed.size();
+    char buffer[1460];
+    for( ;; ){
+        ssize_t length = recv( Fd, buffer, sizeof( buffer ), MSG_DONTWAIT );
+        if( length > 0 && delayed ) {
+            // A segment can not overtake the ones before it
+            uint64_t due = std::max( now + hal::receiveDelay(), Delayed.size() ? Delayed.back().first : 0 );
+            Delayed.emplace_back( due, std::string( buffer, length ) );
+            continue;
+        }
+        if( length > 0 ) {
+            Received.append( buffer, length );
+            continue;
+        }
+        if( length < 0 && errno == EINTR ) continue;
+        if( length == 0 || ( errno != EAGAIN && errno != EWOULDBLOCK ) ) {
+            // Nothing more will arrive, hal::wait should not wake up for the closed socket
+            PeerClosed = true;
+            hal::unwatch( Fd );
+        }
+        return;
+    }
+}
+
+WiFiClient::WiFiClient( int fd )
+: m_Socket( std::make_shared<ClientSocket>( fd ) )
+{}
+
+int WiFiClient::available(){
+    if( !m_Socket ) return 0;
+    m_Socket->receive();
+    return m_Socket->Received.size() - m_Socket->ReadIndex;
+}
+
+int WiFiClient::read(){
+    if( !available() ) return -1;
+    return static_cast<uint8_t>( m_Socket->Received[ m_Socket->ReadIndex++ ] );
+}
+
+int WiFiClient::read( uint8_t *buffer, size_t size ){
+    size_t length = std::min<size_t>( size, available() );
+    if( !length ) return 0;
+    memcpy( buffer, m_Socket->Received.data() + m_Socket->ReadIndex, length );
+    m_Socket->ReadIndex += length;
+    return length;
+}
+
+int WiFiClient::peek(){
+    if( !available() ) return -1;
+    return static_cast<uint8_t>( m_Socket->Received[ m_Socket->ReadIndex ] );
+}
+
+size_t WiFiClient::write( uint8_t c ){
+    return write( &c, 1 );
+}
+
+size_t WiFiClient::write( const uint8_t *buffer, size_t size ){
+    if( !m_Socket || m_Socket->Fd < 0 ) return 0;
+
+    // Like the ESP8266 a write blocks until the data has been handed to the network, or times out
+    size_t written = 0;
+    while( written < size ){
+        ssize_t length = send( m_Socket->Fd, buffer + written, size - written, MSG_DONTWAIT | MSG_NOSIGNAL );
+        if( length > 0 ) {
+            written += length;
+            continue;
+        }
+        if( length < 0 && errno == EINTR ) continue;
+        if( length < 0 && errno != EAGAIN && errno != EWOULDBLOCK ) break;
+        pollfd output = { m_Socket->Fd, POLLOUT, 0 };
+        if( poll( &output, 1, HAL_WRITE_TIMEOUT ) <= 0 ) break;
+    }
+    return written;
+}
+
+int WiFiClient::availableForWrite(){
+    return m_Socket && m_Socket->Fd >= 0 ? 1460 : 0;
+}
+
+uint8_t WiFiClient::connected(){
+    if( !m_Socket || m_Socket->Fd < 0 ) return 0;
+    m_Socket->receive();
+    return !m_Socket->PeerClosed || m_Socket->ReadIndex < m_Socket->Received.size() || m_Socket->Delayed.size();
+}
+
+void WiFiClient::stop(){
+    if( m_Socket ) m_Socket->close();
+}
+
+void WiFiClient::setNoDelay( bool noDelay ){
+    int flag = noDelay;
+    if( m_Socket && m_Socket->Fd >= 0 ) setsockopt( m_Socket->Fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof( flag ) );
+}
+
+IPAddress WiFiClient::remoteIP(){
+    sockaddr_in address = {};
+    socklen_t length = sizeof( address );
+    if( !m_Socket || getpeername( m_Socket->Fd, reinterpret_cast<sockaddr*>( &address ), &length ) < 0 ) return IPAddress();
+    uint32_t ip = ntohl( address.sin_addr.s_addr );
+    return IPAddress( ip >> 24, ip >> 16, ip >> 8, ip );
+}
+
+uint16_t WiFiClient::remotePort(){
+    sockaddr_in address = {};
+    socklen_t length = sizeof( address );
+    if( !m_Socket || getpeername( m_Socket->Fd, reinterpret_cast<sockaddr*>( &address ), &length ) < 0 ) return 0;
+    return ntohs( address.sin_port );
+}
+
+WiFiServer::WiFiServer( uint16_t port )
+: m_Port( port )
+, m_Fd( -1 )
+, m_Pending( -1 )
+, m_NoDelay( true )
+{}
+
+WiFiServer::~WiFiServer(){
+    stop();
+}
+
+void WiFiServer::begin(){
+    stop();
+    hal::Board &board = hal::board();
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    uint16_t port = hal::port( m_Port );
+    address.sin_port = htons( port );
+    inet_pton( AF_INET, board.Address.c_str(), &address.sin_addr );
+
+    m_Fd = socket( AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 );
+    int flag = 1;
+    setsockopt( m_Fd, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof( flag ) );
+    if( bind( m_Fd, reinterpret_cast<sockaddr*>( &address ), sizeof( address ) ) < 0 || listen( m_Fd, 16 ) < 0 ) {
+        fprintf( stderr, "hal: can not listen on %s:%d: %s\n", board.Address.c_str(), port, strerror( errno ) );
+        ::close( m_Fd );
+        m_Fd = -1;
+        return;
+    }
+    hal::watch( m_Fd );
+}
+
+void WiFiServer::stop(){
+    if( m_Pending >= 0 ) ::close( m_Pending );
+    m_Pending = -1;
+    if( m_Fd < 0 ) return;
+    hal::unwatch( m_Fd );
+    ::close( m_Fd );
+    m_Fd = -1;
+}
+
+bool WiFiServer::hasClient(){
+    if( m_Pending < 0 && m_Fd >= 0 ) m_Pending = accept4( m_Fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC );
+    return m_Pending >= 0;
+}
+
+WiFiClient WiFiServer::accept(){
+    if( !hasClient() ) return WiFiClient();
+    WiFiClient client( m_Pending );
+    m_Pending = -1;
+    client.setNoDelay( m_NoDelay );
+    return client;
+}
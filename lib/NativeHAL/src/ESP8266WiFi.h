@@ -0,0 +1,145 @@
+/**
+ * @file ESP8266WiFi.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ESP8266WIFI_H
+#define ESP8266WIFI_H
+
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "WiFiUdp.h"
+#include <deque>
+#include <memory>
+
+enum wl_status_t {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+};
+
+/**
+ * @brief The wifi station, it is connected when the selected board says so.
+ */
+class ESP8266WiFiClass {
+public:
+    wl_status_t status();
+    bool config( IPAddress local, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress() );
+    wl_status_t begin( const String &ssid, const String &password );
+    IPAddress localIP();
+
+private:
+    /**
+     * @brief The static IP set by config.
+     */
+    IPAddress m_LocalIP;
+};
+
+extern ESP8266WiFiClass WiFi;
+
+/**
+ * @brief The socket shared by the copies of a WiFiClient.
+ */
+struct ClientSocket {
+    ClientSocket( int fd );
+    ~ClientSocket();
+    void close();
+
+    /**
+     * @brief Move the bytes that have arrived to the receive buffer without blocking.
+     */
+    void receive();
+
+    int Fd;
+    bool PeerClosed;
+    std::string Received;
+    size_t ReadIndex;
+
+    /**
+     * @brief Received segments held back by the network conditions of the board, with the time they become readable.
+     */
+    std::deque<std::pair<uint64_t, std::string>> Delayed;
+};
+
+/**
+ * @brief A TCP connection on a non-blocking host socket.
+ * Copies share the connection like they do on the ESP8266, it is closed by stop() or by the last copy.
+ */
+class WiFiClient : public Stream {
+public:
+    WiFiClient() {}
+    explicit WiFiClient( int fd );
+
+    int available() override;
+    int read() override;
+    int read( uint8_t *buffer, size_t size );
+    int peek() override;
+    size_t write( uint8_t c ) override;
+    size_t write( const uint8_t *buffer, size_t size ) override;
+    using Print::write;
+    int availableForWrite() override;
+    void flush() override {}
+
+    uint8_t connected();
+    void stop();
+    void setNoDelay( bool noDelay );
+    IPAddress remoteIP();
+    uint16_t remotePort();
+    explicit operator bool() { return m_Socket && m_Socket->Fd >= 0; }
+
+private:
+    std::shared_ptr<ClientSocket> m_Socket;
+};
+
+/**
+ * @brief A TCP server on a non-blocking host socket.
+ * It listens on hal::Board::Address at the port plus hal::Board::PortOffset of the board selected when begin() is called.
+ */
+class WiFiServer {
+public:
+    WiFiServer( uint16_t port );
+    ~WiFiServer();
+
+    void begin();
+    void stop();
+    bool hasClient();
+    WiFiClient accept();
+    WiFiClient available() { return accept(); }
+    void setNoDelay( bool noDelay ) { m_NoDelay = noDelay; }
+    uint16_t port() const { return m_Port; }
+
+private:
+    uint16_t m_Port;
+    int m_Fd;
+    int m_Pending;
+    bool m_NoDelay;
+};
+
+#endif
@@ -0,0 +1,145 @@
+/**
+ * @file FS.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "LittleFS.h"
+
+FS LittleFS;
+
+File::File( const std::shared_ptr<std::string> &content, bool writable, const String &name )
+: m_Content( content )
+, m_Writable( writable )
+, m_Name( name )
+{}
+
+int File::available(){
+    return m_Content ? m_Content->size() - std::min( m_Position, m_Content->size() ) : 0;
+}
+
+int File::read(){
+    if( !available() ) return -1;
+    return static_cast<uint8_t>( ( *m_Content )[ m_Position++ ] );
+}
+
+size_t File::read( uint8_t *buffer, size_t size ){
+    size_t length = std::min<size_t>( size, available() );
+    if( length ) memcpy( buffer, m_Content->data() + m_Position, length );
+    m_Position += length;
+    return length;
+}
+
+/**
+ * @brief Read the rest of the file, a file has no timeout to wait for like the ESP8266 core.
+ */
+String File::readString(){
+    if( !available() ) return String();
+    String text( m_Content->substr( m_Position ) );
+    m_Position = m_Content->size();
+    return text;
+}
+
+int File::peek(){
+    if( !available() ) return -1;
+    return static_cast<uint8_t>( ( *m_Content )[ m_Position ] );
+}
+
+size_t File::write( uint8_t c ){
+    return write( &c, 1 );
+}
+
+size_t File::write( const uint8_t *buffer, size_t size ){
+    if( !m_Content || !m_Writable ) return 0;
+    m_Content->replace( std::min( m_Position, m_Content->size() ), size, reinterpret_cast<const char*>( buffer ), size );
+    m_Position += size;
+    return size;
+}
+
+bool File::seek( uint32_t position ){
+    if( !m_Content || position > m_Content->size() ) return false;
+    m_Position = position;
+    return true;
+}
+
+namespace fs {
+
+bool FS::format(){
+    hal::board().Files.clear();
+    return true;
+}
+
+bool FS::exists( const String &path ){
+    return hal::board().Files.count( path.str() ) > 0;
+}
+
+File FS::open( const String &path, const char *mode ){
+    auto &files = hal::board().Files;
+    auto file = files.find( path.str() );
+    if( mode[0] == 'r' ) {
+        if( file == files.end() ) return File();
+        return File( file->second, mode[1] == '+', path );
+    }
+
+    // "w" starts a new content, "a" continues the existing one
+    if( mode[0] == 'a' && file != files.end() ) {
+        File appended( file->second, true, path );
+        appended.seek( file->second->size() );
+        return appended;
+    }
+    std::shared_ptr<std::string> content = std::make_shared<std::string>();
+    files[ path.str() ] = content;
+    return File( content, true, path );
+}
+
+bool FS::remove( const String &path ){
+    return hal::board().Files.erase( path.str() ) > 0;
+}
+
+bool FS::rename( const String &from, const String &to ){
+    auto &files = hal::board().Files;
+    auto file = files.find( from.str() );
+    if( file == files.end() ) return false;
+    std::shared_ptr<std::string> content = file->second;
+    files.erase( file );
+    files[ to.str() ] = content;
+    return true;
+}
+
+Dir FS::openDir( const String &path ){
+    std::string prefix = path.str();
+    if( prefix.empty() || prefix.back() != '/' ) prefix += '/';
+
+    // Only the files directly in the directory, by their name without the path
+    std::vector<String> names;
+    for( const auto &file: hal::board().Files ){
+        if( file.first.compare( 0, prefix.size(), prefix ) != 0 ) continue;
+        std::string name = file.first.substr( prefix.size() );
+        if( name.find( '/' ) == std::string::npos ) names.push_back( String( name ) );
+    }
+    return Dir( names );
+}
+
+}
@@ -0,0 +1,106 @@
+/**
+ * @file FS.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FS_H
+#define FS_H
+
+#include "Arduino.h"
+#include <memory>
+#include <vector>
+
+/**
+ * @brief An open file of the in-memory flash, see hal::Board::Files.
+ * Writes go straight to the stored content, like a LittleFS file that is flushed on every write.
+ */
+class File : public Stream {
+public:
+    File() {}
+    File( const std::shared_ptr<std::string> &content, bool writable, const String &name );
+
+    int available() override;
+    int read() override;
+    size_t read( uint8_t *buffer, size_t size );
+    String readString() override;
+    int peek() override;
+    size_t write( uint8_t c ) override;
+    size_t write( const uint8_t *buffer, size_t size ) override;
+    using Print::write;
+    int availableForWrite() override { return m_Writable ? 0x7FFFFFFF : 0; }
+
+    bool seek( uint32_t position );
+    size_t position() const { return m_Position; }
+    size_t size() const { return m_Content ? m_Content->size() : 0; }
+    const char *name() const { return m_Name.c_str(); }
+    void close() { m_Content.reset(); }
+    explicit operator bool() const { return m_Content != nullptr; }
+
+private:
+    std::shared_ptr<std::string> m_Content;
+    bool m_Writable = false;
+    size_t m_Position = 0;
+    String m_Name;
+};
+
+/**
+ * @brief A listing of the files in a directory.
+ */
+class Dir {
+public:
+    Dir() {}
+    Dir( const std::vector<String> &names ) : m_Names( names ) {}
+
+    bool next() { return ++m_Index < static_cast<int>( m_Names.size() ); }
+    String fileName() const { return m_Names[m_Index]; }
+
+private:
+    std::vector<String> m_Names;
+    int m_Index = -1;
+};
+
+namespace fs {
+
+/**
+ * @brief The flash file system of the selected board.
+ */
+class FS {
+public:
+    bool begin() { return true; }
+    void end() {}
+    bool format();
+    bool exists( const String &path );
+    File open( const String &path, const char *mode );
+    bool remove( const String &path );
+    bool rename( const String &from, const String &to );
+    Dir openDir( const String &path );
+};
+
+}
+
+using fs::FS;
+
+#endif
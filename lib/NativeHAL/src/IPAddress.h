@@ -0,0 +1,68 @@
+/**
+ * @file IPAddress.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef IPADDRESS_H
+#define IPADDRESS_H
+
+#include "Arduino.h"
+
+/**
+ * @brief An IPv4 address.
+ */
+class IPAddress {
+public:
+    IPAddress() {}
+    IPAddress( uint8_t a, uint8_t b, uint8_t c, uint8_t d ) : m_Octets{ a, b, c, d } {}
+
+    bool fromString( const String &address ) { return fromString( address.c_str() ); }
+    bool fromString( const char *address ){
+        unsigned a, b, c, d;
+        char end;
+        if( sscanf( address, "%u.%u.%u.%u%c", &a, &b, &c, &d, &end ) != 4 || a > 255 || b > 255 || c > 255 || d > 255 ) return false;
+        m_Octets[0] = a;
+        m_Octets[1] = b;
+        m_Octets[2] = c;
+        m_Octets[3] = d;
+        return true;
+    }
+    static bool isValid( const char *address ) { IPAddress ip; return ip.fromString( address ); }
+
+    String toString() const {
+        char text[16];
+        snprintf( text, sizeof( text ), "%u.%u.%u.%u", m_Octets[0], m_Octets[1], m_Octets[2], m_Octets[3] );
+        return String( text );
+    }
+    bool isSet() const { return m_Octets[0] || m_Octets[1] || m_Octets[2] || m_Octets[3]; }
+    uint8_t operator[]( int index ) const { return m_Octets[index]; }
+    operator uint32_t() const { return m_Octets[0] | m_Octets[1] << 8 | m_Octets[2] << 16 | static_cast<uint32_t>( m_Octets[3] ) << 24; }
+
+private:
+    uint8_t m_Octets[4] = { 0, 0, 0, 0 };
+};
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ * @file Print.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Print.h"
+#include <cstdarg>
+#include <cstdio>
+#include <vector>
+
+size_t Print::write( const uint8_t *buffer, size_t size ){
+    size_t written = 0;
+    while( size-- ){
+        if( !write( *buffer++ ) ) break;
+        written++;
+    }
+    return written;
+}
+
+size_t Print::printf( const char *format, ... ){
+    // Short lines are formatted on the stack like the ESP8266 core does, longer ones on the heap
+    char line[64];
+    va_list args;
+    va_start( args, format );
+    int length = vsnprintf( line, sizeof( line ), format, args );
+    va_end( args );
+    if( length < 0 ) return 0;
+    if( static_cast<size_t>( length ) < sizeof( line ) ) return write( line, length );
+
+    std::vector<char> buffer( length + 1 );
+    va_start( args, format );
+    vsnprintf( buffer.data(), buffer.size(), format, args );
+    va_end( args );
+    return write( buffer.data(), length );
+}
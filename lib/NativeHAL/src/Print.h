@@ -0,0 +1,70 @@
+/**
+ * @file Print.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PRINT_H
+#define PRINT_H
+
+#include "WString.h"
+#include <cstddef>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+/**
+ * @brief The Arduino Print interface, a byte sink with text formatting.
+ */
+class Print {
+public:
+    virtual ~Print() {}
+
+    virtual size_t write( uint8_t c ) = 0;
+    virtual size_t write( const uint8_t *buffer, size_t size );
+    size_t write( const char *text ) { return text ? write( reinterpret_cast<const uint8_t*>( text ), strlen( text ) ) : 0; }
+    size_t write( const char *buffer, size_t size ) { return write( reinterpret_cast<const uint8_t*>( buffer ), size ); }
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+
+    size_t print( const String &text ) { return write( text.c_str(), text.length() ); }
+    size_t print( const char *text ) { return write( text ); }
+    size_t print( char c ) { return write( static_cast<uint8_t>( c ) ); }
+    size_t print( int value, int base = DEC ) { return print( String( value, base ) ); }
+    size_t print( unsigned int value, int base = DEC ) { return print( String( value, base ) ); }
+    size_t print( long value, int base = DEC ) { return print( String( value, base ) ); }
+    size_t print( unsigned long value, int base = DEC ) { return print( String( value, base ) ); }
+    size_t print( double value, int decimals = 2 ) { return print( String( value, decimals ) ); }
+
+    size_t println() { return write( "\r\n" ); }
+    template<typename T> size_t println( const T &value ) { size_t size = print( value ); return size + println(); }
+    template<typename T> size_t println( const T &value, int format ) { size_t size = print( value, format ); return size + println(); }
+
+    size_t printf( const char *format, ... ) __attribute__ ( ( format( printf, 2, 3 ) ) );
+};
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * @file SPI.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SPI_H
+#define SPI_H
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x10
+#define SPI_MODE3 0x11
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+/**
+ * @brief The clock, bit order and mode of a SPI transaction.
+ */
+class SPISettings {
+public:
+    SPISettings( uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0 )
+    : Clock( clock ), BitOrder( bitOrder ), DataMode( dataMode ) {}
+
+    uint32_t Clock;
+    uint8_t BitOrder;
+    uint8_t DataMode;
+};
+
+/**
+ * @brief The SPI master of the ESP8266 core on the simulated device of the selected board (hal::Board::Spi).
+ * Without device every received byte is 0xFF, like a bus without pull-down.
+ */
+class SPIClass {
+public:
+    void begin() {}
+    void end() {}
+    void beginTransaction( SPISettings settings ) { m_Settings = settings; }
+    void endTransaction() {}
+
+    uint8_t transfer( uint8_t data );
+    void transfer( void *buffer, uint16_t count );
+
+private:
+    SPISettings m_Settings;
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @file Stream.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Arduino.h"
+
+int Stream::timedRead(){
+    unsigned long start = millis();
+    do {
+        int c = read();
+        if( c >= 0 ) return c;
+        yield();
+    } while( millis() - start < m_Timeout );
+    return -1;
+}
+
+int Stream::timedPeek(){
+    unsigned long start = millis();
+    do {
+        int c = peek();
+        if( c >= 0 ) return c;
+        yield();
+    } while( millis() - start < m_Timeout );
+    return -1;
+}
+
+size_t Stream::readBytes( char *buffer, size_t length ){
+    size_t count = 0;
+    while( count < length ){
+        int c = timedRead();
+        if( c < 0 ) break;
+        buffer[count++] = static_cast<char>( c );
+    }
+    return count;
+}
+
+String Stream::readString(){
+    String text;
+    int c;
+    while( ( c = timedRead() ) >= 0 ) text += static_cast<char>( c );
+    return text;
+}
+
+String Stream::readStringUntil( char terminator ){
+    String text;
+    int c;
+    while( ( c = timedRead() ) >= 0 && c != terminator ) text += static_cast<char>( c );
+    return text;
+}
+
+long Stream::parseInt(){
+    // Skip everything up to the first digit or minus sign
+    int c;
+    while( ( c = timedPeek() ) >= 0 && c != '-' && !isdigit( c ) ) read();
+    if( c < 0 ) return 0;
+
+    bool negative = c == '-';
+    if( negative ) read();
+    long value = 0;
+    while( ( c = timedPeek() ) >= 0 && isdigit( c ) ){
+        value = value * 10 + c - '0';
+        read();
+    }
+    return negative ? -value : value;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file Stream.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef STREAM_H
+#define STREAM_H
+
+#include "Print.h"
+
+/**
+ * @brief The Arduino Stream interface, a Print that can also be read.
+ * The blocking reads wait at most the timeout, in board time.
+ */
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout( unsigned long timeout ) { m_Timeout = timeout; }
+    unsigned long getTimeout() const { return m_Timeout; }
+
+    size_t readBytes( char *buffer, size_t length );
+    size_t readBytes( uint8_t *buffer, size_t length ) { return readBytes( reinterpret_cast<char*>( buffer ), length ); }
+    virtual String readString();
+    String readStringUntil( char terminator );
+    long parseInt();
+
+protected:
+    /**
+     * @brief Read a byte, wait for it at most the timeout.
+     *
+     * @return int the byte or -1 on timeout
+     */
+    int timedRead();
+
+    /**
+     * @brief Peek a byte, wait for it at most the timeout.
+     *
+     * @return int the byte or -1 on timeout
+     */
+    int timedPeek();
+
+    /**
+     * @brief The timeout of the blocking reads in milliseconds.
+     */
+    unsigned long m_Timeout = 1000;
+};
+
+#endif
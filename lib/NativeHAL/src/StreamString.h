@@ -0,0 +1,54 @@
+/**
+ * @file StreamString.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef STREAMSTRING_H
+#define STREAMSTRING_H
+
+#include "Arduino.h"
+
+/**
+ * @brief A String that can be printed to and read from.
+ */
+class StreamString : public String, public Stream {
+public:
+    size_t write( uint8_t c ) override { m_Buffer += static_cast<char>( c ); return 1; }
+    size_t write( const uint8_t *buffer, size_t size ) override { m_Buffer.append( reinterpret_cast<const char*>( buffer ), size ); return size; }
+    using Print::write;
+    int availableForWrite() override { return 0x7FFFFFFF; }
+
+    int available() override { return m_Buffer.size(); }
+    int read() override {
+        if( m_Buffer.empty() ) return -1;
+        int c = static_cast<uint8_t>( m_Buffer[0] );
+        m_Buffer.erase( 0, 1 );
+        return c;
+    }
+    int peek() override { return m_Buffer.empty() ? -1 : static_cast<uint8_t>( m_Buffer[0] ); }
+};
+
+#endif
@@ -0,0 +1,139 @@
+/**
+ * @file WString.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "WString.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+
+/**
+ * @brief Format an integer in the given base, like ltoa and ultoa of the ESP8266 core.
+ */
+static std::string formatNumber( unsigned long value, bool negative, unsigned char base ){
+    if( base < 2 || base > 36 ) base = 10;
+    std::string text;
+    do {
+        unsigned digit = value % base;
+        text += static_cast<char>( digit < 10 ? '0' + digit : 'a' + digit - 10 );
+        value /= base;
+    } while( value );
+    if( negative ) text += '-';
+    std::reverse( text.begin(), text.end() );
+    return text;
+}
+
+String::String( int value, unsigned char base )
+: m_Buffer( base == 10 ? formatNumber( value < 0 ? -static_cast<long>( value ) : value, value < 0, base )
+                       : formatNumber( static_cast<unsigned int>( value ), false, base ) )
+{}
+
+String::String( unsigned int value, unsigned char base )
+: m_Buffer( formatNumber( value, false, base ) )
+{}
+
+String::String( long value, unsigned char base )
+: m_Buffer( base == 10 ? formatNumber( value < 0 ? -static_cast<unsigned long>( value ) : value, value < 0, base )
+                       : formatNumber( static_cast<unsigned long>( value ), false, base ) )
+{}
+
+String::String( unsigned long value, unsigned char base )
+: m_Buffer( formatNumber( value, false, base ) )
+{}
+
+String::String( double value, unsigned char decimals ){
+    char text[64];
+    snprintf( text, sizeof( text ), "%.*f", decimals, value );
+    m_Buffer = text;
+}
+
+bool String::equalsIgnoreCase( const String &other ) const {
+    if( m_Buffer.size() != other.m_Buffer.size() ) return false;
+    for( size_t i = 0; i < m_Buffer.size(); i++ ){
+        if( tolower( (unsigned char) m_Buffer[i] ) != tolower( (unsigned char) other.m_Buffer[i] ) ) return false;
+    }
+    return true;
+}
+
+bool String::endsWith( const String &suffix ) const {
+    return m_Buffer.size() >= suffix.m_Buffer.size()
+        && m_Buffer.compare( m_Buffer.size() - suffix.m_Buffer.size(), suffix.m_Buffer.size(), suffix.m_Buffer ) == 0;
+}
+
+int String::indexOf( char c, unsigned int from ) const {
+    size_t index = m_Buffer.find( c, from );
+    return index == std::string::npos ? -1 : static_cast<int>( index );
+}
+
+int String::indexOf( const String &text, unsigned int from ) const {
+    size_t index = m_Buffer.find( text.m_Buffer, from );
+    return index == std::string::npos ? -1 : static_cast<int>( index );
+}
+
+int String::lastIndexOf( char c ) const {
+    size_t index = m_Buffer.rfind( c );
+    return index == std::string::npos ? -1 : static_cast<int>( index );
+}
+
+String String::substring( unsigned int from ) const {
+    return from > m_Buffer.size() ? String() : String( m_Buffer.substr( from ) );
+}
+
+String String::substring( unsigned int from, unsigned int to ) const {
+    if( from > to ) std::swap( from, to );
+    if( from > m_Buffer.size() ) return String();
+    return String( m_Buffer.substr( from, std::min<size_t>( to, m_Buffer.size() ) - from ) );
+}
+
+void String::trim(){
+    size_t begin = 0;
+    size_t end = m_Buffer.size();
+    while( begin < end && isspace( (unsigned char) m_Buffer[begin] ) ) begin++;
+    while( end > begin && isspace( (unsigned char) m_Buffer[end - 1] ) ) end--;
+    m_Buffer = m_Buffer.substr( begin, end - begin );
+}
+
+void String::toLowerCase(){
+    for( char &c: m_Buffer ) c = tolower( (unsigned char) c );
+}
+
+void String::toUpperCase(){
+    for( char &c: m_Buffer ) c = toupper( (unsigned char) c );
+}
+
+void String::replace( const String &find, const String &replacement ){
+    if( find.m_Buffer.empty() ) return;
+    size_t index = 0;
+    while( ( index = m_Buffer.find( find.m_Buffer, index ) ) != std::string::npos ){
+        m_Buffer.replace( index, find.m_Buffer.size(), replacement.m_Buffer );
+        index += replacement.m_Buffer.size();
+    }
+}
+
+void String::remove( unsigned int index, unsigned int count ){
+    if( index < m_Buffer.size() ) m_Buffer.erase( index, count );
+}
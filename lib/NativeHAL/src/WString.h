@@ -0,0 +1,115 @@
+/**
+ * @file WString.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef WSTRING_H
+#define WSTRING_H
+
+#include "c_types.h"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+/**
+ * @brief The Arduino String, backed by a std::string.
+ * Only the part of the API the firmware uses is available.
+ */
+class String {
+public:
+    String() {}
+    String( const char *text ) : m_Buffer( text ? text : "" ) {}
+    String( const std::string &text ) : m_Buffer( text ) {}
+    explicit String( char c ) : m_Buffer( 1, c ) {}
+    String( int value, unsigned char base = 10 );
+    String( unsigned int value, unsigned char base = 10 );
+    String( long value, unsigned char base = 10 );
+    String( unsigned long value, unsigned char base = 10 );
+    String( double value, unsigned char decimals = 2 );
+
+    unsigned int length() const { return m_Buffer.size(); }
+    bool isEmpty() const { return m_Buffer.empty(); }
+    const char *c_str() const { return m_Buffer.c_str(); }
+    const std::string &str() const { return m_Buffer; }
+    bool reserve( unsigned int size ) { m_Buffer.reserve( size ); return true; }
+    void clear() { m_Buffer.clear(); }
+
+    bool concat( const String &text ) { m_Buffer += text.m_Buffer; return true; }
+    bool concat( const char *text ) { m_Buffer += text; return true; }
+    bool concat( const char *text, unsigned int length ) { m_Buffer.append( text, length ); return true; }
+    bool concat( char c ) { m_Buffer += c; return true; }
+    String &operator+=( const String &text ) { m_Buffer += text.m_Buffer; return *this; }
+    String &operator+=( const char *text ) { m_Buffer += text; return *this; }
+    String &operator+=( char c ) { m_Buffer += c; return *this; }
+    String &operator+=( int value ) { return *this += String( value ); }
+    String &operator+=( unsigned int value ) { return *this += String( value ); }
+    String &operator+=( long value ) { return *this += String( value ); }
+    String &operator+=( unsigned long value ) { return *this += String( value ); }
+
+    bool equals( const String &other ) const { return m_Buffer == other.m_Buffer; }
+    bool equalsIgnoreCase( const String &other ) const;
+    bool startsWith( const String &prefix ) const { return m_Buffer.compare( 0, prefix.length(), prefix.m_Buffer ) == 0; }
+    bool endsWith( const String &suffix ) const;
+    bool operator==( const String &other ) const { return m_Buffer == other.m_Buffer; }
+    bool operator==( const char *other ) const { return m_Buffer == other; }
+    bool operator!=( const String &other ) const { return m_Buffer != other.m_Buffer; }
+    bool operator!=( const char *other ) const { return m_Buffer != other; }
+    bool operator<( const String &other ) const { return m_Buffer < other.m_Buffer; }
+
+    char charAt( unsigned int index ) const { return index < m_Buffer.size() ? m_Buffer[index] : 0; }
+    char operator[]( unsigned int index ) const { return charAt( index ); }
+    char &operator[]( unsigned int index ) { return m_Buffer[index]; }
+    int indexOf( char c, unsigned int from = 0 ) const;
+    int indexOf( const String &text, unsigned int from = 0 ) const;
+    int lastIndexOf( char c ) const;
+    String substring( unsigned int from ) const;
+    String substring( unsigned int from, unsigned int to ) const;
+
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    void replace( const String &find, const String &replacement );
+    void remove( unsigned int index, unsigned int count = (unsigned int) -1 );
+    long toInt() const { return strtol( m_Buffer.c_str(), nullptr, 10 ); }
+    float toFloat() const { return strtof( m_Buffer.c_str(), nullptr ); }
+
+    friend String operator+( const String &left, const String &right ) { return String( left.m_Buffer + right.m_Buffer ); }
+    friend String operator+( const String &left, const char *right ) { return String( left.m_Buffer + right ); }
+    friend String operator+( const char *left, const String &right ) { return String( left + right.m_Buffer ); }
+    friend String operator+( const String &left, char right ) { return String( left.m_Buffer + right ); }
+    friend String operator+( const String &left, int right ) { return left + String( right ); }
+    friend String operator+( const String &left, unsigned int right ) { return left + String( right ); }
+    friend String operator+( const String &left, long right ) { return left + String( right ); }
+    friend String operator+( const String &left, unsigned long right ) { return left + String( right ); }
+
+protected:
+    /**
+     * @brief The characters of the string.
+     */
+    std::string m_Buffer;
+};
+
+#endif
@@ -0,0 +1,208 @@
+/**
+ * @file WiFiUdp.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "WiFiUdp.h"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/**
+ * @brief Largest datagram that is received, the size of an unfragmented packet on the ESP8266.
+ */
+#define HAL_UDP_PACKET 1472
+
+/**
+ * @brief Convert an IPAddress to a socket address.
+ */
+static in_addr toAddress( const IPAddress &ip ){
+    in_addr address;
+    address.s_addr = htonl( static_cast<uint32_t>( ip[0] ) << 24 | ip[1] << 16 | ip[2] << 8 | ip[3] );
+    return address;
+}
+
+/**
+ * @brief Convert a socket address to an IPAddress.
+ */
+static IPAddress fromAddress( const in_addr &address ){
+    uint32_t ip = ntohl( address.s_addr );
+    return IPAddress( ip >> 24, ip >> 16, ip >> 8, ip );
+}
+
+WiFiUDP::WiFiUDP()
+: m_Fd( -1 )
+, m_GroupFd( -1 )
+, m_Port( 0 )
+, m_ReadIndex( 0 )
+, m_RemotePort( 0 )
+, m_OutPort( 0 )
+{}
+
+WiFiUDP::~WiFiUDP(){
+    stop();
+}
+
+int WiFiUDP::open( const std::string &address, uint16_t port, bool shared ){
+    sockaddr_in local = {};
+    local.sin_family = AF_INET;
+    local.sin_port = htons( port );
+    inet_pton( AF_INET, address.c_str(), &local.sin_addr );
+
+    int fd = socket( AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 );
+    int flag = 1;
+    if( shared ) setsockopt( fd, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof( flag ) );
+    if( fd < 0 || bind( fd, reinterpret_cast<sockaddr*>( &local ), sizeof( local ) ) < 0 ) {
+        fprintf( stderr, "hal: can not bind UDP %s:%d: %s\n", address.c_str(), port, strerror( errno ) );
+        if( fd >= 0 ) ::close( fd );
+        return -1;
+    }
+    hal::watch( fd );
+    return fd;
+}
+
+uint8_t WiFiUDP::begin( uint16_t port ){
+    stop();
+    m_Port = port;
+    m_Fd = open( hal::board().Address, hal::port( port ), false );
+    return m_Fd >= 0;
+}
+
+uint8_t WiFiUDP::beginMulticast( IPAddress, IPAddress multicast, uint16_t port ){
+    if( !begin( port ) ) return 0;
+    hal::Board &board = hal::board();
+    m_Group = multicast;
+    m_GroupFd = open( multicast.toString().c_str(), port + board.PortOffset, true );
+    if( m_GroupFd < 0 ) return 0;
+
+    // Join the group on the interface of the board address
+    ip_mreq membership = {};
+    membership.imr_multiaddr = toAddress( multicast );
+    inet_pton( AF_INET, board.Address.c_str(), &membership.imr_interface );
+    if( setsockopt( m_GroupFd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof( membership ) ) < 0 ) {
+        fprintf( stderr, "hal: can not join %s: %s\n", multicast.toString().c_str(), strerror( errno ) );
+        return 0;
+    }
+    return 1;
+}
+
+void WiFiUDP::stop(){
+    for( int *fd: { &m_Fd, &m_GroupFd } ){
+        if( *fd < 0 ) continue;
+        hal::unwatch( *fd );
+        ::close( *fd );
+        *fd = -1;
+    }
+    m_Packet.clear();
+    m_ReadIndex = 0;
+}
+
+bool WiFiUDP::receive( int fd ){
+    if( fd < 0 ) return false;
+    char buffer[HAL_UDP_PACKET];
+    sockaddr_in remote = {};
+    socklen_t length = sizeof( remote );
+    for( ;; ){
+        ssize_t size = recvfrom( fd, buffer, sizeof( buffer ), MSG_DONTWAIT, reinterpret_cast<sockaddr*>( &remote ), &length );
+        if( size < 0 ) return false;
+
+        // A lost datagram is gone, UDP does not retransmit
+        hal::Board &board = hal::board();
+        if( board.LossRate > 0 && std::uniform_real_distribution<double>( 0, 1 )( board.Random ) < board.LossRate ) continue;
+
+        m_Packet.assign( buffer, size );
+        m_ReadIndex = 0;
+        m_RemoteIP = fromAddress( remote.sin_addr );
+        m_RemotePort = ntohs( remote.sin_port );
+        m_DestinationIP = fd == m_GroupFd ? m_Group : IPAddress();
+        return true;
+    }
+}
+
+int WiFiUDP::parsePacket(){
+    m_Packet.clear();
+    m_ReadIndex = 0;
+    if( !receive( m_Fd ) && !receive( m_GroupFd ) ) return 0;
+    return m_Packet.size();
+}
+
+int WiFiUDP::available(){
+    return m_Packet.size() - m_ReadIndex;
+}
+
+int WiFiUDP::read(){
+    if( !available() ) return -1;
+    return static_cast<uint8_t>( m_Packet[ m_ReadIndex++ ] );
+}
+
+int WiFiUDP::read( uint8_t *buffer, size_t size ){
+    size_t length = std::min<size_t>( size, available() );
+    memcpy( buffer, m_Packet.data() + m_ReadIndex, length );
+    m_ReadIndex += length;
+    return length;
+}
+
+int WiFiUDP::peek(){
+    if( !available() ) return -1;
+    return static_cast<uint8_t>( m_Packet[ m_ReadIndex ] );
+}
+
+void WiFiUDP::flush(){
+    m_ReadIndex = m_Packet.size();
+}
+
+int WiFiUDP::beginPacket( IPAddress ip, uint16_t port ){
+    m_Out.clear();
+    m_OutIP = ip;
+    m_OutPort = port;
+    return m_Fd >= 0;
+}
+
+int WiFiUDP::beginPacketMulticast( IPAddress multicast, uint16_t port, IPAddress, int ){
+    return beginPacket( multicast, port + hal::board().PortOffset );
+}
+
+size_t WiFiUDP::write( uint8_t c ){
+    return write( &c, 1 );
+}
+
+size_t WiFiUDP::write( const uint8_t *buffer, size_t size ){
+    m_Out.append( reinterpret_cast<const char*>( buffer ), size );
+    return size;
+}
+
+int WiFiUDP::endPacket(){
+    if( m_Fd < 0 ) return 0;
+    sockaddr_in remote = {};
+    remote.sin_family = AF_INET;
+    remote.sin_port = htons( m_OutPort );
+    remote.sin_addr = toAddress( m_OutIP );
+    ssize_t sent = sendto( m_Fd, m_Out.data(), m_Out.size(), MSG_DONTWAIT, reinterpret_cast<sockaddr*>( &remote ), sizeof( remote ) );
+    m_Out.clear();
+    return sent >= 0;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file WiFiUdp.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef WIFIUDP_H
+#define WIFIUDP_H
+
+#include "Arduino.h"
+#include "IPAddress.h"
+#include <string>
+
+/**
+ * @brief A UDP socket on non-blocking host sockets.
+ * It listens on hal::Board::Address at the port of the board selected when begin() is called.
+ * A multicast group is shared by all boards, so its port is only moved by hal::Board::PortOffset
+ * and not by hal::Board::Ports. Received datagrams are lost at the hal::Board::LossRate.
+ */
+class WiFiUDP : public Stream {
+public:
+    WiFiUDP();
+    ~WiFiUDP();
+
+    uint8_t begin( uint16_t port );
+    uint8_t beginMulticast( IPAddress interfaceAddress, IPAddress multicast, uint16_t port );
+    void stop();
+
+    int parsePacket();
+    int available() override;
+    int read() override;
+    int read( uint8_t *buffer, size_t size );
+    int read( char *buffer, size_t size ) { return read( reinterpret_cast<uint8_t*>( buffer ), size ); }
+    int peek() override;
+    void flush() override;
+
+    int beginPacket( IPAddress ip, uint16_t port );
+    int beginPacketMulticast( IPAddress multicast, uint16_t port, IPAddress interfaceAddress, int ttl = 1 );
+    size_t write( uint8_t c ) override;
+    size_t write( const uint8_t *buffer, size_t size ) override;
+    using Print::write;
+    int endPacket();
+
+    IPAddress remoteIP() const { return m_RemoteIP; }
+    uint16_t remotePort() const { return m_RemotePort; }
+    IPAddress destinationIP() const { return m_DestinationIP; }
+    uint16_t localPort() const { return m_Port; }
+
+private:
+    /**
+     * @brief Open a socket bound to an address and a host port.
+     *
+     * @return int the file descriptor or -1 on failure
+     */
+    static int open( const std::string &address, uint16_t port, bool shared );
+
+    /**
+     * @brief Receive one datagram from a socket into the packet buffer.
+     *
+     * @return true if a datagram has been received
+     */
+    bool receive( int fd );
+
+    int m_Fd;
+    int m_GroupFd;
+    uint16_t m_Port;
+    IPAddress m_Group;
+    std::string m_Packet;
+    size_t m_ReadIndex;
+    IPAddress m_RemoteIP;
+    uint16_t m_RemotePort;
+    IPAddress m_DestinationIP;
+    std::string m_Out;
+    IPAddress m_OutIP;
+    uint16_t m_OutPort;
+};
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file Wire.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Wire.h"
+
+TwoWire Wire;
+
+TwoWire::TwoWire()
+: m_Clock( 100000 )
+, m_Address( 0 )
+, m_ReadIndex( 0 )
+{}
+
+void TwoWire::begin( int, int ){
+    m_Out.clear();
+    m_In.clear();
+    m_ReadIndex = 0;
+}
+
+void TwoWire::beginTransmission( uint8_t address ){
+    m_Address = address;
+    m_Out.clear();
+}
+
+/**
+ * @brief Send the written bytes to the device, 2 when the address is not acknowledged like the ESP8266 core.
+ */
+uint8_t TwoWire::endTransmission( bool ){
+    auto device = hal::board().I2c.find( m_Address );
+    if( device == hal::board().I2c.end() ) return 2;
+    if( device->second.Write ) device->second.Write( reinterpret_cast<const uint8_t*>( m_Out.data() ), m_Out.size() );
+    m_Out.clear();
+    return 0;
+}
+
+/**
+ * @brief Read bytes from a device, 0 when the address is not acknowledged.
+ */
+size_t TwoWire::requestFrom( uint8_t address, size_t size, bool ){
+    m_In.clear();
+    m_ReadIndex = 0;
+    auto device = hal::board().I2c.find( address );
+    if( device == hal::board().I2c.end() ) return 0;
+    m_In.assign( size, '\xFF' );
+    if( device->second.Read ) device->second.Read( reinterpret_cast<uint8_t*>( &m_In[0] ), size );
+    return size;
+}
+
+size_t TwoWire::write( uint8_t c ){
+    m_Out += static_cast<char>( c );
+    return 1;
+}
+
+size_t TwoWire::write( const uint8_t *buffer, size_t size ){
+    m_Out.append( reinterpret_cast<const char*>( buffer ), size );
+    return size;
+}
+
+int TwoWire::available(){
+    return m_In.size() - m_ReadIndex;
+}
+
+int TwoWire::read(){
+    return m_ReadIndex < m_In.size() ? static_cast<uint8_t>( m_In[m_ReadIndex++] ) : -1;
+}
+
+int TwoWire::peek(){
+    return m_ReadIndex < m_In.size() ? static_cast<uint8_t>( m_In[m_ReadIndex] ) : -1;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file Wire.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef WIRE_H
+#define WIRE_H
+
+#include "Arduino.h"
+#include <string>
+
+/**
+ * @brief The I2C master of the ESP8266 core on the simulated devices of the selected board (hal::Board::I2c).
+ * A transmission to an address without device is not acknowledged.
+ */
+class TwoWire : public Stream {
+public:
+    TwoWire();
+
+    void begin( int sda, int scl );
+    void setClock( uint32_t frequency ) { m_Clock = frequency; }
+
+    void beginTransmission( uint8_t address );
+    uint8_t endTransmission( bool sendStop = true );
+    size_t requestFrom( uint8_t address, size_t size, bool sendStop = true );
+
+    size_t write( uint8_t c ) override;
+    size_t write( const uint8_t *buffer, size_t size ) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override {}
+
+private:
+    uint32_t m_Clock;
+    uint8_t m_Address;
+    std::string m_Out;
+    std::string m_In;
+    size_t m_ReadIndex;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ * @file hal.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "hal.h"
+#include <chrono>
+#include <dirent.h>
+#include <fstream>
+#include <poll.h>
+#include <set>
+#include <sstream>
+#include <vector>
+
+namespace hal {
+
+/**
+ * @brief Return the real time in microseconds.
+ */
+static uint64_t realUs(){
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+/**
+ * @brief Return the board used when none has been selected.
+ * Created on first use, global firmware objects already use it while they are constructed.
+ */
+static Board &defaultBoard(){
+    static Board board;
+    return board;
+}
+
+/**
+ * @brief The selected board, nullptr for the default board.
+ */
+static Board *selected = nullptr;
+
+/**
+ * @brief Return the sockets wait() polls.
+ */
+static std::set<int> &watched(){
+    static std::set<int> fds;
+    return fds;
+}
+
+/**
+ * @brief Construct a new Board, with a running clock that starts at zero.
+ */
+Board::Board()
+: ManualClock( false )
+, ClockUs( 0 )
+, StartUs( realUs() )
+, Modes{}
+, Values{}
+, InterruptModes{}
+, InterruptLevels{}
+, SerialStdio( false )
+, Baud( 0 )
+, SerialFormat( 0x1c )
+, SerialSwapped( false )
+, Serial1Invert( false )
+, Address( "127.0.0.1" )
+, PortOffset( 0 )
+, LatencyUs( 0 )
+, JitterUs( 0 )
+, LossRate( 0 )
+, RetransmitUs( 200000 )
+, WifiConnected( true )
+, FreeHeap( 40000 )
+, MaxFreeBlock( 30000 )
+, HeapFragmentation( 10 )
+{}
+
+/**
+ * @brief Return the selected board.
+ */
+Board &board(){
+    return selected ? *selected : defaultBoard();
+}
+
+/**
+ * @brief Select the board the Arduino API works on, nullptr selects the default board.
+ */
+void select( Board *board ){
+    selected = board;
+}
+
+/**
+ * @brief Return the time of the selected board in microseconds.
+ */
+uint64_t nowUs(){
+    Board &current = board();
+    return current.ManualClock ? current.ClockUs : realUs() - current.StartUs;
+}
+
+/**
+ * @brief Move the manual clock of the selected board forward.
+ */
+void advance( uint64_t us ){
+    board().ClockUs += us;
+}
+
+/**
+ * @brief Return the host port of a server port of the selected board.
+ */
+uint16_t port( uint16_t port ){
+    Board &current = board();
+    auto mapped = current.Ports.find( port );
+    return mapped != current.Ports.end() ? mapped->second : port + current.PortOffset;
+}
+
+/**
+ * @brief Return the delay of a TCP segment that is received now, by the network conditions of the selected board.
+ */
+uint64_t receiveDelay(){
+    Board &current = board();
+    uint64_t delay = current.LatencyUs;
+    if( current.JitterUs ) delay += current.Random() % current.JitterUs;
+    if( current.LossRate > 0 && std::uniform_real_distribution<double>( 0, 1 )( current.Random ) < current.LossRate ) {
+        delay += current.RetransmitUs;
+    }
+    return delay;
+}
+
+/**
+ * @brief Copy the files of a host directory into the flash memory of the selected board.
+ *
+ * @param directory the host directory, its files are stored as /<name>
+ * @return int amount of loaded files, -1 if the directory can not be opened
+ */
+int loadFiles( const std::string &directory ){
+    DIR *dir = opendir( directory.c_str() );
+    if( !dir ) return -1;
+
+    int count = 0;
+    while( dirent *entry = readdir( dir ) ){
+        std::ifstream file( directory + "/" + entry->d_name, std::ios::binary );
+        if( entry->d_name[0] == '.' || entry->d_type == DT_DIR || !file ) continue;
+        std::ostringstream content;
+        content << file.rdbuf();
+        board().Files[ std::string( "/" ) + entry->d_name ] = std::make_shared<std::string>( content.str() );
+        count++;
+    }
+    closedir( dir );
+    return count;
+}
+
+/**
+ * @brief Register a socket, wait() returns when it can be read.
+ */
+void watch( int fd ){
+    watched().insert( fd );
+}
+
+/**
+ * @brief Unregister a socket.
+ */
+void unwatch( int fd ){
+    watched().erase( fd );
+}
+
+/**
+ * @brief Sleep until a watched socket or stdin has data or the timeout passes.
+ *
+ * @param timeoutMs the maximum time to sleep in milliseconds
+ */
+void wait( int timeoutMs ){
+    std::vector<pollfd> fds;
+    if( board().SerialStdio ) fds.push_back( { 0, POLLIN, 0 } );
+    for( int fd: watched() ) fds.push_back( { fd, POLLIN, 0 } );
+    poll( fds.data(), fds.size(), timeoutMs );
+}
+
+}
@@ -0,0 +1,290 @@
+/**
+ * @file hal.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef HAL_H
+#define HAL_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+
+/**
+ * @brief Amount of virtual pins, GPIO 0 to 16 and A0.
+ */
+#define HAL_PIN_COUNT 18
+
+/**
+ * @brief The virtual pin of the analog input.
+ */
+#define HAL_PIN_A0 17
+
+/**
+ * @brief Bytes the virtual UART accepts per call of availableForWrite, the size of the ESP8266 FIFO.
+ */
+#define HAL_SERIAL_FIFO 128
+
+namespace hal {
+
+/**
+ * @brief A simulated I2C device, Write gets the bytes of a transmission and Read fills the bytes of a request.
+ */
+struct I2cDevice {
+    std::function<void( const uint8_t *data, size_t length )> Write;
+    std::function<void( uint8_t *data, size_t length )> Read;
+};
+
+/**
+ * @brief Everything that differs between boards: clock, pins, UART, flash memory and network.
+ * The Arduino API (millis, digitalRead, Serial, LittleFS, WiFiServer...) works on the selected board,
+ * so several firmware instances can run in one process by selecting their board before running them.
+ */
+struct Board {
+    /**
+     * @brief Construct a new Board, with a running clock that starts at zero.
+     */
+    Board();
+
+    /**
+     * @brief When set millis() and micros() only change by advance(), delay() and yield().
+     */
+    bool ManualClock;
+
+    /**
+     * @brief The time of the manual clock in microseconds.
+     */
+    uint64_t ClockUs;
+
+    /**
+     * @brief The real time in microseconds at which the running clock was zero.
+     */
+    uint64_t StartUs;
+
+    /**
+     * @brief The pin modes set by pinMode.
+     */
+    uint8_t Modes[HAL_PIN_COUNT];
+
+    /**
+     * @brief The pin levels, written by digitalWrite or by the test that drives the inputs.
+     * A0 holds the analog value 0-1023.
+     */
+    int Values[HAL_PIN_COUNT];
+
+    /**
+     * @brief Optional signal source of the input pins, called with the pin and the board time in us.
+     * A negative result falls back to Values.
+     */
+    std::function<int( uint8_t pin, uint64_t us )> Input;
+
+    /**
+     * @brief Optional observer of digitalWrite, called with the pin, the level and the board time in us.
+     */
+    std::function<void( uint8_t pin, int value, uint64_t us )> Output;
+
+    /**
+     * @brief The interrupt handlers set by attachInterrupt, their mode (RISING, FALLING or CHANGE)
+     * and the level of the pin when it was checked last.
+     */
+    std::function<void( void )> Interrupts[HAL_PIN_COUNT];
+    int InterruptModes[HAL_PIN_COUNT];
+    int InterruptLevels[HAL_PIN_COUNT];
+
+    /**
+     * @brief The devices on the I2C bus by address.
+     */
+    std::map<uint8_t, I2cDevice> I2c;
+
+    /**
+     * @brief Optional device on the SPI bus, called with every sent byte and returns the received byte.
+     */
+    std::function<uint8_t( uint8_t data )> Spi;
+
+    /**
+     * @brief Bytes received by the UART that the firmware has not read yet.
+     */
+    std::string SerialIn;
+
+    /**
+     * @brief Bytes sent by the UART, cleared by the owner of the board.
+     */
+    std::string SerialOut;
+
+    /**
+     * @brief When set the UART is connected to stdin and stdout instead of SerialIn and SerialOut.
+     */
+    bool SerialStdio;
+
+    /**
+     * @brief The baud rate and frame format set by Serial.begin.
+     */
+    unsigned long Baud;
+    int SerialFormat;
+
+    /**
+     * @brief Flag which is set while UART 0 is swapped to GPIO13 and GPIO15.
+     */
+    bool SerialSwapped;
+
+    /**
+     * @brief Bytes sent by the transmit only UART 1, cleared by the owner of the board.
+     */
+    std::string Serial1Out;
+
+    /**
+     * @brief Flag which is set while UART 1 sends inverted, the LED strip data and no text.
+     */
+    bool Serial1Invert;
+
+    /**
+     * @brief The files of the flash memory, by absolute path.
+     */
+    std::map<std::string, std::shared_ptr<std::string>> Files;
+
+    /**
+     * @brief The address the servers of the board listen on.
+     */
+    std::string Address;
+
+    /**
+     * @brief Added to every server port, so boards can share a host and ports below 1024 need no root.
+     */
+    int PortOffset;
+
+    /**
+     * @brief Host ports of single server ports, for example 333 -> 20017. They take precedence over PortOffset.
+     */
+    std::map<uint16_t, uint16_t> Ports;
+
+    /**
+     * @brief Time received TCP data takes before the firmware can read it, in us.
+     */
+    uint32_t LatencyUs;
+
+    /**
+     * @brief Random extra delay of received TCP data, up to this value in us.
+     */
+    uint32_t JitterUs;
+
+    /**
+     * @brief Fraction of received TCP segments that is lost. Like a TCP retransmission
+     * the segment and everything after it arrives RetransmitUs later.
+     */
+    double LossRate;
+
+    /**
+     * @brief The delay of a lost segment in us.
+     */
+    uint32_t RetransmitUs;
+
+    /**
+     * @brief The random generator of the board, for random() and the network conditions.
+     */
+    std::minstd_rand Random;
+
+    /**
+     * @brief The state WiFi.status() reports.
+     */
+    bool WifiConnected;
+
+    /**
+     * @brief The values reported by ESP.getFreeHeap, getMaxFreeBlockSize and getHeapFragmentation.
+     */
+    uint32_t FreeHeap;
+    uint32_t MaxFreeBlock;
+    uint8_t HeapFragmentation;
+};
+
+/**
+ * @brief Return the selected board.
+ */
+Board &board();
+
+/**
+ * @brief Select the board the Arduino API works on, nullptr selects the default board.
+ */
+void select( Board *board );
+
+/**
+ * @brief Return the time of the selected board in microseconds.
+ */
+uint64_t nowUs();
+
+/**
+ * @brief Move the manual clock of the selected board forward.
+ */
+void advance( uint64_t us );
+
+/**
+ * @brief Run the interrupt handlers of the pins of the selected board whose level changed since the last check.
+ * A board has no real interrupts, its owner checks them before every loop iteration,
+ * so the edges of an input signal are seen at the loop frequency.
+ */
+void checkInterrupts();
+
+/**
+ * @brief Return the host port of a server port of the selected board.
+ */
+uint16_t port( uint16_t port );
+
+/**
+ * @brief Return the delay of a TCP segment that is received now, by the network conditions of the selected board.
+ */
+uint64_t receiveDelay();
+
+/**
+ * @brief Copy the files of a host directory into the flash memory of the selected board.
+ *
+ * @param directory the host directory, its files are stored as /<name>
+ * @return int amount of loaded files, -1 if the directory can not be opened
+ */
+int loadFiles( const std::string &directory );
+
+/**
+ * @brief Register a socket, wait() returns when it can be read.
+ */
+void watch( int fd );
+
+/**
+ * @brief Unregister a socket.
+ */
+void unwatch( int fd );
+
+/**
+ * @brief Sleep until a watched socket or stdin has data or the timeout passes.
+ * Lets a firmware loop run on a host without spinning a core.
+ *
+ * @param timeoutMs the maximum time to sleep in milliseconds
+ */
+void wait( int timeoutMs );
+
+}
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * @file halmain.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Arduino.h"
+
+#ifndef HAL_NO_MAIN
+
+/**
+ * @brief The server ports of the native firmware are moved by this offset, so 333 and 80 become 10333 and 10080.
+ */
+#define HAL_PORT_OFFSET 10000
+
+void setup();
+void loop();
+
+/**
+ * @brief Run the firmware as a Linux process: the UART is stdin and stdout and the servers listen on localhost.
+ *
+ * usage: program [port offset] [data directory]
+ */
+int main( int argc, char **argv ){
+    hal::Board &board = hal::board();
+    board.SerialStdio = true;
+    board.PortOffset = argc > 1 ? atoi( argv[1] ) : HAL_PORT_OFFSET;
+    setvbuf( stdout, nullptr, _IONBF, 0 );
+
+    // The web interface of the data directory, like the uploaded file system image
+    hal::loadFiles( argc > 2 ? argv[2] : "data" );
+
+    setup();
+    for( ;; ){
+        hal::checkInterrupts();
+        loop();
+        // UART 1 only has the log while the bridge uses UART 0, inverted it drives the LED strip
+        if( board.Serial1Out.size() ) {
+            if( !board.Serial1Invert ) fputs( board.Serial1Out.c_str(), stderr );
+            board.Serial1Out.clear();
+        }
+        hal::wait( 1 );
+    }
+}
+
+#endif
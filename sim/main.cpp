@@ -0,0 +1,180 @@
+/**
+ * @file main.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "simulator.h"
+#include <csignal>
+#include <cstring>
+#include <sys/resource.h>
+
+/**
+ * @brief Cleared by SIGINT and SIGTERM to end the simulation.
+ */
+static volatile sig_atomic_t running = 1;
+
+static void usage(){
+    printf( "usage: simulator [options]\n"
+            "  -n BOARDS          amount of boards (1)\n"
+            "  --address ADDRESS  address to listen on (127.0.0.1)\n"
+            "  --tcp-port PORT    TCP port of the first board, board N uses PORT + N (20000)\n"
+            "  --http-port PORT   HTTP port of the first board, board N uses PORT + N (30000)\n"
+            "  --udp-port PORT    UDP port of the first board once UDP is configured, board N uses PORT + N (40000)\n"
+            "  --pin PIN=SIGNAL   drive an input pin, for example D5=square:500 or A0=noise:400:600\n"
+            "                     signals: VALUE, square:PERIOD_MS[:DUTY], sine:PERIOD_MS:MIN:MAX,\n"
+            "                     ramp:PERIOD_MS:MIN:MAX, noise:MIN:MAX\n"
+            "  --i2c ADDRESS      add an I2C device with 256 registers to every board, for example 0x76\n"
+            "  --ds18b20 PIN=SIGNAL  add a DS18B20 to every board, the signal is the temperature in\n"
+            "                     centidegrees, for example D4=2150 or D4=sine:60000:1800:2600\n"
+            "  --dht11 PIN=SIGNAL, --dht22 PIN=SIGNAL  add a DHT11 or DHT22 (humidity 50%%) to every board\n"
+            "  --uart-loopback    connect RX and TX of the swapped UART (D7 and D8), the serial bridge echoes\n"
+            "  --serial-pty       connect the serial port of every board to a pseudo terminal, its path is printed\n"
+            "  --latency MS       delay of received TCP data (0)\n"
+            "  --jitter MS        random extra delay of received TCP data (0)\n"
+            "  --loss PERCENT     received TCP segments that arrive after a retransmission delay (0)\n"
+            "  --seed SEED        seed of the phases, noise and network conditions (1)\n"
+            "  --data DIRECTORY   load the files of a directory into every board\n"
+            "  --report SECONDS   print the loop timing every interval (0: never)\n"
+            "  -v                 print the serial output of the boards\n" );
+}
+
+/**
+ * @brief Return the GPIO of a pin name (D0-D8 or A0), -1 if the name is not valid.
+ */
+static int pinNumber( const std::string &name ){
+    static const uint8_t digital[] = { D0, D1, D2, D3, D4, D5, D6, D7, D8 };
+    if( name == "A0" || name == "a0" ) return A0;
+    if( name.size() == 2 && ( name[0] == 'D' || name[0] == 'd' ) && name[1] >= '0' && name[1] <= '8' ) return digital[ name[1] - '0' ];
+    return -1;
+}
+
+static void stop( int ){
+    running = 0;
+}
+
+int main( int argc, char **argv ){
+    SimulatorOptions options;
+    uint32_t report = 0;
+    for( int i = 1; i < argc; i++ ){
+        std::string arg = argv[i];
+        bool value = i + 1 < argc;
+        if( arg == "-n" && value ) options.Boards = strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--address" && value ) options.Address = argv[++i];
+        else if( arg == "--tcp-port" && value ) options.TcpPort = strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--http-port" && value ) options.HttpPort = strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--udp-port" && value ) options.UdpPort = strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--latency" && value ) options.LatencyUs = atof( argv[++i] ) * 1000;
+        else if( arg == "--jitter" && value ) options.JitterUs = atof( argv[++i] ) * 1000;
+        else if( arg == "--loss" && value ) options.LossRate = atof( argv[++i] ) / 100;
+        else if( arg == "--seed" && value ) options.Seed = strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "--data" && value ) options.DataDirectory = argv[++i];
+        else if( arg == "--report" && value ) report = strtoul( argv[++i], nullptr, 10 );
+        else if( arg == "-v" ) options.Verbose = true;
+        else if( arg == "--uart-loopback" ) options.UartLoopback = true;
+        else if( arg == "--serial-pty" ) options.SerialPty = true;
+        else if( arg == "--i2c" && value ) {
+            char *end = nullptr;
+            unsigned long address = strtoul( argv[++i], &end, 0 );
+            if( *end || address > 0x7F ) {
+                fprintf( stderr, "invalid I2C address: %s\n", argv[i] );
+                return 1;
+            }
+            options.I2cDevices.push_back( address );
+        }
+        else if( ( arg == "--ds18b20" || arg == "--dht11" || arg == "--dht22" ) && value ) {
+            std::string pin = argv[++i];
+            size_t equals = pin.find( '=' );
+            SensorDevice device;
+            device.Type = parseSensorType( String( arg.substr( 2 ) ) );
+            int number = equals == std::string::npos ? -1 : pinNumber( pin.substr( 0, equals ) );
+            if( number < 0 || number == A0 || !parseSignal( pin.substr( equals + 1 ), device.Temperature ) ) {
+                fprintf( stderr, "invalid sensor: %s\n", pin.c_str() );
+                return 1;
+            }
+            options.Sensors[number] = device;
+        }
+        else if( arg == "--pin" && value ) {
+            std::string pin = argv[++i];
+            size_t equals = pin.find( '=' );
+            Signal signal;
+            int number = equals == std::string::npos ? -1 : pinNumber( pin.substr( 0, equals ) );
+            if( number < 0 || !parseSignal( pin.substr( equals + 1 ), signal ) ) {
+                fprintf( stderr, "invalid pin signal: %s\n", pin.c_str() );
+                return 1;
+            }
+            options.Pins[number] = signal;
+        }
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if( !options.Boards || options.TcpPort + options.Boards > 65536 || options.HttpPort + options.Boards > 65536 || options.UdpPort + options.Boards > 65536 ) {
+        usage();
+        return 1;
+    }
+
+    // Every board has two listening sockets and its clients, the default limit of 1024 files is too low for hundreds
+    rlimit files;
+    if( getrlimit( RLIMIT_NOFILE, &files ) == 0 && files.rlim_cur < files.rlim_max ) {
+        files.rlim_cur = files.rlim_max;
+        setrlimit( RLIMIT_NOFILE, &files );
+    }
+    signal( SIGINT, stop );
+    signal( SIGTERM, stop );
+
+    Simulator simulator( options );
+    simulator.start();
+    printf( "%zu board(s) on %s, TCP %u-%u, HTTP %u-%u\n", simulator.size(), options.Address.c_str(),
+        options.TcpPort, options.TcpPort + options.Boards - 1, options.HttpPort, options.HttpPort + options.Boards - 1 );
+    for( size_t i = 0; options.SerialPty && i < simulator.size(); i++ ) printf( "board %zu serial %s\n", i, simulator.serialDevice( i ).c_str() );
+    fflush( stdout );
+
+    uint64_t iterations = 0;
+    uint64_t busiest = 0;
+    uint64_t total = 0;
+    unsigned long lastReport = millis();
+    while( running ){
+        uint64_t us = simulator.runOnce();
+        iterations++;
+        total += us;
+        if( us > busiest ) busiest = us;
+
+        // Sleep until a socket has data, the boards still run at least every millisecond for their timers
+        hal::wait( 1 );
+
+        if( report && millis() - lastReport >= report * 1000 ) {
+            printf( "loop: %.0f/s, mean %.3fms, max %.3fms\n", iterations * 1000.0 / ( millis() - lastReport ),
+                total / 1000.0 / iterations, busiest / 1000.0 );
+            fflush( stdout );
+            iterations = 0;
+            busiest = 0;
+            total = 0;
+            lastReport = millis();
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,360 @@
+/**
+ * @file simulator.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "simulator.h"
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sstream>
+#include <termios.h>
+#include <unistd.h>
+
+/**
+ * @brief Return the value of the signal.
+ *
+ * @param us the board time
+ * @param phase the offset of the board in the period, so boards dont run in lockstep
+ * @param random the random generator of the board, for noise
+ */
+int Signal::sample( uint64_t us, uint64_t phase, std::minstd_rand &random ) const {
+    uint64_t position = ( us + phase ) % PeriodUs;
+    switch( Kind ){
+    case SIGNAL_SQUARE:
+        return position * 100 < PeriodUs * Duty ? Max : Min;
+    case SIGNAL_SINE:
+        return Min + static_cast<int>( std::lround( ( Max - Min ) * ( 1 + std::sin( 2 * M_PI * position / PeriodUs ) ) / 2 ) );
+    case SIGNAL_RAMP:
+        return Min + static_cast<int>( ( Max - Min ) * position / PeriodUs );
+    case SIGNAL_NOISE:
+        return Min + static_cast<int>( random() % ( Max - Min + 1 ) );
+    case SIGNAL_CONSTANT:
+        break;
+    }
+    return Max;
+}
+
+/**
+ * @brief Parse a signal description:
+ * a number, square:PERIOD_MS[:DUTY], sine:PERIOD_MS:MIN:MAX, ramp:PERIOD_MS:MIN:MAX or noise:MIN:MAX.
+ *
+ * @return false if the description is not valid
+ */
+bool parseSignal( const std::string &text, Signal &signal ){
+    std::vector<std::string> parts;
+    std::stringstream stream( text );
+    std::string part;
+    while( std::getline( stream, part, ':' ) ) parts.push_back( part );
+    if( parts.empty() ) return false;
+
+    auto number = [ & ]( size_t index, long fallback ){
+        return index < parts.size() ? std::strtol( parts[index].c_str(), nullptr, 10 ) : fallback;
+    };
+    signal = Signal();
+    if( parts[0] == "square" && ( parts.size() == 2 || parts.size() == 3 ) ) {
+        signal.Kind = SIGNAL_SQUARE;
+        signal.PeriodUs = number( 1, 0 ) * 1000;
+        signal.Duty = number( 2, 50 );
+    } else if( ( parts[0] == "sine" || parts[0] == "ramp" ) && parts.size() == 4 ) {
+        signal.Kind = parts[0] == "sine" ? SIGNAL_SINE : SIGNAL_RAMP;
+        signal.PeriodUs = number( 1, 0 ) * 1000;
+        signal.Min = number( 2, 0 );
+        signal.Max = number( 3, 0 );
+    } else if( parts[0] == "noise" && parts.size() == 3 ) {
+        signal.Kind = SIGNAL_NOISE;
+        signal.Min = number( 1, 0 );
+        signal.Max = number( 2, 0 );
+    } else if( parts.size() == 1 && parts[0].size() > ( parts[0][0] == '-' ) && parts[0].find_first_not_of( "0123456789", parts[0][0] == '-' ) == std::string::npos ) {
+        signal.Min = signal.Max = number( 0, 0 );
+    } else {
+        return false;
+    }
+    return signal.PeriodUs > 0 && signal.Duty <= 100 && signal.Min <= signal.Max;
+}
+
+/**
+ * @brief Take an edge that the firmware writes. A DS18B20 sees a reset in a low pulse of more than 400 us,
+ * a write slot of a 1 is shorter than 30 us. A DHT starts its answer when a low pulse of more than 800 us ends.
+ *
+ * @param temperature the temperature in centidegrees at the time of the edge
+ */
+void Simulator::VirtualBoard::SensorLine::drive( int level, uint64_t us, int temperature ){
+    if( !level ) {
+        if( Low ) return;
+        Low = true;
+        FallUs = us;
+        // A slot while the scratchpad is sent is a read slot
+        Sending = SendBit < SendLength;
+        if( Sending ) {
+            Bit = Scratchpad[SendBit / 8] >> ( SendBit % 8 ) & 1;
+            SendBit++;
+        }
+        return;
+    }
+    if( !Low ) return;
+    Low = false;
+    uint64_t width = us - FallUs;
+
+    if( Device->Type != SENSOR_DS18B20 ) {
+        if( width < 800 ) return;
+        AnswerUs = us;
+        int magnitude = std::abs( temperature );
+        if( Device->Type == SENSOR_DHT11 ) {
+            uint8_t bytes[4] = { 50, 0, static_cast<uint8_t>( magnitude / 100 ), static_cast<uint8_t>( magnitude % 100 / 10 | ( temperature < 0 ? 0x80 : 0 ) ) };
+            memcpy( Data, bytes, 4 );
+        } else {
+            int tenths = magnitude / 10;
+            uint8_t bytes[4] = { 500 >> 8, 500 & 0xFF, static_cast<uint8_t>( tenths >> 8 | ( temperature < 0 ? 0x80 : 0 ) ), static_cast<uint8_t>( tenths ) };
+            memcpy( Data, bytes, 4 );
+        }
+        Data[4] = Data[0] + Data[1] + Data[2] + Data[3];
+        return;
+    }
+
+    if( width >= 400 ) {
+        PresenceUs = us + 20;
+        RomCommand = true;
+        Shift = 0;
+        Bits = 0;
+        SendLength = 0;
+        SendBit = 0;
+        return;
+    }
+    if( Sending ) return;
+    Shift = Shift >> 1 | ( width < 30 ? 0x80 : 0 );
+    if( ++Bits < 8 ) return;
+    Bits = 0;
+    if( RomCommand ) {
+        // Only skip ROM, the device is alone on its bus
+        RomCommand = false;
+        if( Shift != 0xCC ) SendLength = 0;
+    } else if( Shift == 0x44 ) {
+        int16_t raw = static_cast<int16_t>( std::lround( temperature * 16 / 100.0 ) );
+        Scratchpad[0] = raw & 0xFF;
+        Scratchpad[1] = raw >> 8 & 0xFF;
+        Scratchpad[8] = OneWire::crc8( Scratchpad, 8 );
+    } else if( Shift == 0xBE ) {
+        Scratchpad[8] = OneWire::crc8( Scratchpad, 8 );
+        SendBit = 0;
+        SendLength = sizeof( Scratchpad ) * 8;
+    }
+}
+
+/**
+ * @brief Return the level the device pulls the line to, 1 while it is released.
+ * The presence pulse of a DS18B20 lasts 120 us, a 0 in a read slot 45 us from the start of the slot.
+ * The answer of a DHT is 80 us low and 80 us high, then 50 us low and 26 us (0) or 70 us (1) high per bit.
+ */
+int Simulator::VirtualBoard::SensorLine::sample( uint64_t us ) const {
+    if( Device->Type == SENSOR_DS18B20 ) {
+        if( us >= PresenceUs && us < PresenceUs + 120 ) return 0;
+        if( Sending && !Bit && us - FallUs < 45 ) return 0;
+        return 1;
+    }
+    if( !AnswerUs || us < AnswerUs ) return 1;
+    uint64_t time = us - AnswerUs;
+    if( time < 30 ) return 1;
+    time -= 30;
+    if( time < 80 ) return 0;
+    time -= 80;
+    if( time < 80 ) return 1;
+    time -= 80;
+    for( int i = 0; i < 40; i++ ){
+        if( time < 50 ) return 0;
+        time -= 50;
+        uint64_t high = Data[i / 8] & ( 0x80 >> ( i % 8 ) ) ? 70 : 26;
+        if( time < high ) return 1;
+        time -= high;
+    }
+    return time < 50 ? 0 : 1;
+}
+
+/**
+ * @brief Construct a new Simulator object
+ *
+ * @param options the settings of the simulation
+ */
+Simulator::Simulator( const SimulatorOptions &options )
+: m_Options( options )
+{}
+
+/**
+ * @brief Destroy the Simulator object
+ */
+Simulator::~Simulator(){
+    for( auto &board: m_Boards ){
+        if( board->SerialMaster >= 0 ) close( board->SerialMaster );
+        if( board->SerialSlave >= 0 ) close( board->SerialSlave );
+    }
+    hal::select( nullptr );
+}
+
+/**
+ * @brief Create the boards.
+ */
+void Simulator::start(){
+    std::minstd_rand random( m_Options.Seed );
+    for( uint32_t i = 0; i < m_Options.Boards; i++ ){
+        std::unique_ptr<VirtualBoard> board( new VirtualBoard() );
+        hal::Board &hal = board->Board;
+        hal.Address = m_Options.Address;
+        hal.Ports[333] = m_Options.TcpPort + i;
+        hal.Ports[80] = m_Options.HttpPort + i;
+        hal.Ports[334] = m_Options.UdpPort + i;
+        hal.LatencyUs = m_Options.LatencyUs;
+        hal.JitterUs = m_Options.JitterUs;
+        hal.LossRate = m_Options.LossRate;
+        hal.Random.seed( random() );
+        board->Phase = random();
+
+        // The sensors see the edges the firmware writes on their pins
+        VirtualBoard *owner = board.get();
+        for( auto &sensor: m_Options.Sensors ) owner->Sensors[sensor.first].Device = &sensor.second;
+        if( m_Options.Sensors.size() ) {
+            hal.Output = [ owner ]( uint8_t pin, int value, uint64_t us ){
+                auto line = owner->Sensors.find( pin );
+                if( line == owner->Sensors.end() ) return;
+                int temperature = line->second.Device->Temperature.sample( us, owner->Phase, owner->Board.Random );
+                line->second.drive( value, us, temperature );
+            };
+        }
+
+        // The input pins follow their signals, every board at its own phase
+        if( m_Options.Pins.size() || m_Options.Sensors.size() ) {
+            hal.Input = [ this, owner ]( uint8_t pin, uint64_t us ){
+                auto line = owner->Sensors.find( pin );
+                if( line != owner->Sensors.end() ) return line->second.sample( us );
+                auto signal = m_Options.Pins.find( pin );
+                if( signal == m_Options.Pins.end() ) return -1;
+                return signal->second.sample( us, owner->Phase, owner->Board.Random );
+            };
+        }
+
+        // Every I2C device is a register file
+        for( uint8_t address: m_Options.I2cDevices ){
+            VirtualBoard::Registers *registers = &board->I2c[address];
+            hal.I2c[address].Write = [ registers ]( const uint8_t *data, size_t length ){
+                if( !length ) return;
+                registers->Pointer = data[0];
+                for( size_t i = 1; i < length; i++ ) registers->Data[registers->Pointer++] = data[i];
+            };
+            hal.I2c[address].Read = [ registers ]( uint8_t *data, size_t length ){
+                for( size_t i = 0; i < length; i++ ) data[i] = registers->Data[registers->Pointer++];
+            };
+        }
+
+        // The serial port is a raw pseudo terminal, a terminal that echoes would send the output back as commands
+        if( m_Options.SerialPty ) {
+            board->SerialMaster = posix_openpt( O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC );
+            termios settings = {};
+            if( board->SerialMaster < 0 || grantpt( board->SerialMaster ) || unlockpt( board->SerialMaster ) ) {
+                fprintf( stderr, "board %u has no pseudo terminal: %s\n", i, strerror( errno ) );
+            } else {
+                board->SerialDevice = ptsname( board->SerialMaster );
+                board->SerialSlave = open( board->SerialDevice.c_str(), O_RDWR | O_NOCTTY | O_CLOEXEC );
+                if( board->SerialSlave >= 0 && tcgetattr( board->SerialSlave, &settings ) == 0 ) {
+                    cfmakeraw( &settings );
+                    tcsetattr( board->SerialSlave, TCSANOW, &settings );
+                }
+            }
+        }
+
+        // The firmware objects use the board that is selected while they are created
+        hal::select( &hal );
+        if( m_Options.DataDirectory.size() ) hal::loadFiles( m_Options.DataDirectory );
+        board->Node = new NodeMCU();
+        m_Boards.push_back( std::move( board ) );
+    }
+    hal::select( nullptr );
+}
+
+/**
+ * @brief Run one loop iteration of every board.
+ *
+ * @return uint64_t the time the iteration took in us
+ */
+uint64_t Simulator::runOnce(){
+    uint64_t start = micros();
+    for( size_t i = 0; i < m_Boards.size(); i++ ){
+        VirtualBoard &board = *m_Boards[i];
+        hal::select( &board.Board );
+        bool pty = board.SerialMaster >= 0 && !board.Board.SerialSwapped;
+        if( pty ) {
+            char buffer[256];
+            ssize_t length;
+            while( ( length = read( board.SerialMaster, buffer, sizeof( buffer ) ) ) > 0 ){
+                board.Board.SerialIn.append( buffer, length );
+                board.SerialOpen = true;
+            }
+        }
+        hal::checkInterrupts();
+        board.Node->run();
+
+        // Without a pseudo terminal the serial port has no listener, its output is printed or dropped.
+        // The swapped UART can be looped back and the log is on UART 1 then.
+        if( m_Options.UartLoopback && board.Board.SerialSwapped ) {
+            board.Board.SerialIn += board.Board.SerialOut;
+        } else if( pty ) {
+            // A client that does not read loses what does not fit the terminal
+            const std::string &output = board.Board.SerialOut;
+            if( board.SerialOpen && output.size() && write( board.SerialMaster, output.data(), output.size() ) < static_cast<ssize_t>( output.size() ) && m_Options.Verbose ) {
+                printf( "[%zu] serial output dropped\n", i );
+            }
+        } else if( m_Options.Verbose && board.Board.SerialOut.size() ) {
+            std::stringstream lines( board.Board.SerialOut );
+            std::string line;
+            while( std::getline( lines, line ) ) printf( "[%zu] %s\n", i, line.c_str() );
+        }
+        if( m_Options.Verbose && board.Board.Serial1Out.size() && !board.Board.Serial1Invert ) {
+            std::stringstream lines( board.Board.Serial1Out );
+            std::string line;
+            while( std::getline( lines, line ) ) printf( "[%zu] %s\n", i, line.c_str() );
+        }
+        board.Board.SerialOut.clear();
+        board.Board.Serial1Out.clear();
+    }
+    hal::select( nullptr );
+    return micros() - start;
+}
+
+/**
+ * @brief Return the amount of boards.
+ */
+size_t Simulator::size() const {
+    return m_Boards.size();
+}
+
+/**
+ * @brief Return the pseudo terminal of the serial port of a board, empty without SerialPty.
+ *
+ * @param board the index of the board
+ */
+std::string Simulator::serialDevice( size_t board ) const {
+    return m_Boards[board]->SerialDevice;
+}
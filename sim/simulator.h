@@ -0,0 +1,292 @@
+/**
+ * @file simulator.h
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include "nodemcu.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The shapes of a simulated pin signal.
+ */
+enum SignalKind{
+    SIGNAL_CONSTANT = 0,
+    SIGNAL_SQUARE,
+    SIGNAL_SINE,
+    SIGNAL_RAMP,
+    SIGNAL_NOISE
+};
+
+/**
+ * @brief A signal that drives an input pin of a simulated board.
+ */
+struct Signal {
+    /**
+     * @brief The shape of the signal.
+     */
+    SignalKind Kind = SIGNAL_CONSTANT;
+
+    /**
+     * @brief The period of square, sine and ramp in us.
+     */
+    uint64_t PeriodUs = 1000000;
+
+    /**
+     * @brief The part of the period a square wave is high, in percent.
+     */
+    uint32_t Duty = 50;
+
+    /**
+     * @brief The range of the signal, a digital pin uses 0 and 1. The constant value is Max.
+     */
+    int Min = 0;
+    int Max = 1;
+
+    /**
+     * @brief Return the value of the signal.
+     *
+     * @param us the board time
+     * @param phase the offset of the board in the period, so boards dont run in lockstep
+     * @param random the random generator of the board, for noise
+     */
+    int sample( uint64_t us, uint64_t phase, std::minstd_rand &random ) const;
+};
+
+/**
+ * @brief Parse a signal description:
+ * a number, square:PERIOD_MS[:DUTY], sine:PERIOD_MS:MIN:MAX, ramp:PERIOD_MS:MIN:MAX or noise:MIN:MAX.
+ *
+ * @return false if the description is not valid
+ */
+bool parseSignal( const std::string &text, Signal &signal );
+
+/**
+ * @brief A sensor on a pin of every simulated board, it answers the 1-Wire or DHT protocol on the pin.
+ * The temperature follows a signal in centidegrees, the humidity of a DHT is 50%.
+ */
+struct SensorDevice {
+    SensorType Type = SENSOR_DS18B20;
+    Signal Temperature;
+};
+
+/**
+ * @brief The settings of a simulation.
+ */
+struct SimulatorOptions {
+    /**
+     * @brief Amount of boards.
+     */
+    uint32_t Boards = 1;
+
+    /**
+     * @brief The address the boards listen on.
+     */
+    std::string Address = "127.0.0.1";
+
+    /**
+     * @brief Board N listens on TcpPort + N for TCP, on HttpPort + N for HTTP
+     * and on UdpPort + N for UDP when it is configured with UDP port 334.
+     */
+    uint16_t TcpPort = 20000;
+    uint16_t HttpPort = 30000;
+    uint16_t UdpPort = 40000;
+
+    /**
+     * @brief The signals of the input pins by GPIO number, HAL_PIN_A0 for the analog input.
+     */
+    std::map<uint8_t, Signal> Pins;
+
+    /**
+     * @brief The addresses of the I2C devices every board gets, each one a file of 256 registers.
+     */
+    std::vector<uint8_t> I2cDevices;
+
+    /**
+     * @brief The sensors by GPIO number.
+     */
+    std::map<uint8_t, SensorDevice> Sensors;
+
+    /**
+     * @brief The network conditions of every board, see hal::Board.
+     */
+    uint32_t LatencyUs = 0;
+    uint32_t JitterUs = 0;
+    double LossRate = 0;
+
+    /**
+     * @brief Seed of the random generators, the same seed gives the same phases and noise.
+     */
+    uint32_t Seed = 1;
+
+    /**
+     * @brief Directory with the files every board gets in its file system, empty for none.
+     */
+    std::string DataDirectory;
+
+    /**
+     * @brief Connect RX and TX of the swapped UART (D7 and D8) of every board, the serial bridge gets back what it sends.
+     */
+    bool UartLoopback = false;
+
+    /**
+     * @brief Connect the serial port of every board to a pseudo terminal, for the serial transport of the host tools.
+     */
+    bool SerialPty = false;
+
+    /**
+     * @brief Print the serial output of the boards.
+     */
+    bool Verbose = false;
+};
+
+/**
+ * @brief Runs many virtual boards in one process, each with its own NodeMCU instance,
+ * clock, pins, file system and TCP/HTTP ports.
+ * The boards run the firmware sources, so commands and result codes are those of the firmware.
+ */
+class Simulator{
+public:
+    /**
+     * @brief Construct a new Simulator object
+     *
+     * @param options the settings of the simulation
+     */
+    Simulator( const SimulatorOptions &options );
+
+    /**
+     * @brief Destroy the Simulator object
+     */
+    ~Simulator();
+
+    /**
+     * @brief Create the boards.
+     */
+    void start();
+
+    /**
+     * @brief Run one loop iteration of every board.
+     *
+     * @return uint64_t the time the iteration took in us
+     */
+    uint64_t runOnce();
+
+    /**
+     * @brief Return the amount of boards.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Return the pseudo terminal of the serial port of a board, empty without SerialPty.
+     *
+     * @param board the index of the board
+     */
+    std::string serialDevice( size_t board ) const;
+
+private:
+    /**
+     * @brief A simulated board and the firmware that runs on it.
+     */
+    struct VirtualBoard {
+        hal::Board Board;
+        NodeMCU *Node = nullptr;
+        uint64_t Phase = 0;
+
+        /**
+         * @brief The pseudo terminal of the serial port. The simulator keeps the slave side open,
+         * so the port stays up between the clients. The output is dropped until the first byte
+         * arrives, like that of a USB serial port nobody has opened.
+         */
+        int SerialMaster = -1;
+        int SerialSlave = -1;
+        std::string SerialDevice;
+        bool SerialOpen = false;
+
+        /**
+         * @brief The register files of the I2C devices by address. The first byte of a transmission
+         * sets the register pointer, it increments with every byte that is written or read.
+         */
+        struct Registers {
+            uint8_t Data[256] = {};
+            uint8_t Pointer = 0;
+        };
+        std::map<uint8_t, Registers> I2c;
+
+        /**
+         * @brief The state of the line of a sensor. The device decodes the slots from the times of the
+         * edges the firmware writes, its answer is the level the firmware reads back.
+         */
+        struct SensorLine {
+            const SensorDevice *Device = nullptr;
+            bool Low = false;
+            uint64_t FallUs = 0;
+
+            // DS18B20: presence pulse, received command bits and the scratchpad bits that are sent
+            uint64_t PresenceUs = 0;
+            bool RomCommand = false;
+            uint8_t Shift = 0;
+            uint8_t Bits = 0;
+            uint8_t Scratchpad[9] = { 0x50, 0x05, 0x4B, 0x46, 0x7F, 0xFF, 0x0C, 0x10, 0x00 };
+            uint32_t SendBit = 0;
+            uint32_t SendLength = 0;
+            bool Sending = false;
+            bool Bit = true;
+
+            // DHT: the time the answer started and its 5 bytes
+            uint64_t AnswerUs = 0;
+            uint8_t Data[5] = {};
+
+            /**
+             * @brief Take an edge that the firmware writes.
+             *
+             * @param temperature the temperature in centidegrees at the time of the edge
+             */
+            void drive( int level, uint64_t us, int temperature );
+
+            /**
+             * @brief Return the level the device pulls the line to, 1 while it is released.
+             */
+            int sample( uint64_t us ) const;
+        };
+        std::map<uint8_t, SensorLine> Sensors;
+    };
+
+    /**
+     * @brief The settings of the simulation.
+     */
+    SimulatorOptions m_Options;
+
+    /**
+     * @brief The boards, the hal::Board of a board must not move while it runs.
+     */
+    std::vector<std::unique_ptr<VirtualBoard>> m_Boards;
+};
+
+#endif
@@ -0,0 +1,96 @@
+/**
+ * @file bootstats.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bootstats.h"
+
+/**
+ * @brief The names of the boot phases as shown by the boot-stats command.
+ */
+static const char *BOOT_PHASE_NAMES[BOOT_PHASE_COUNT] = {
+    "fs-mount",
+    "list-files",
+    "load-config",
+    "load-pins",
+    "serial-ready",
+    "wifi-connect",
+    "tcp-start",
+    "http-start"
+};
+
+/**
+ * @brief Construct a new Boot Stats object
+ */
+BootStats::BootStats()
+: m_Started( 0 )
+, m_Ended( 0 )
+{
+    memset( m_Start, 0, sizeof( m_Start ) );
+    memset( m_End, 0, sizeof( m_End ) );
+}
+
+/**
+ * @brief Record the start time of a phase.
+ * 
+ * @param phase the phase that started
+ */
+void BootStats::begin( const BootPhase &phase ){
+    if( m_Started & ( 1 << phase ) ) return;
+    m_Start[phase] = micros();
+    m_Started |= ( 1 << phase );
+}
+
+/**
+ * @brief Record the end time of a phase.
+ * 
+ * @param phase the phase that ended
+ */
+void BootStats::end( const BootPhase &phase ){
+    if( !( m_Started & ( 1 << phase ) ) || ( m_Ended & ( 1 << phase ) ) ) return;
+    m_End[phase] = micros();
+    m_Ended |= ( 1 << phase );
+}
+
+/**
+ * @brief Print the start time and duration of every phase.
+ * 
+ * @param out the output to print to
+ */
+void BootStats::print( Print &out ){
+    out.println( "BootStats: phase, start (ms), duration (ms)" );
+    for( uint i = 0; i < BOOT_PHASE_COUNT; i++ ){
+        if( !( m_Started & ( 1 << i ) ) ) {
+            out.printf( "\t%s: skipped\n", BOOT_PHASE_NAMES[i] );
+        } else if( !( m_Ended & ( 1 << i ) ) ) {
+            out.printf( "\t%s: %lu.%03lu, pending\n", BOOT_PHASE_NAMES[i], m_Start[i] / 1000, m_Start[i] % 1000 );
+        } else {
+            unsigned long duration = m_End[i] - m_Start[i];
+            out.printf( "\t%s: %lu.%03lu, %lu.%03lu\n", BOOT_PHASE_NAMES[i], 
+                m_Start[i] / 1000, m_Start[i] % 1000, duration / 1000, duration % 1000 );
+        }
+    }
+}
@@ -0,0 +1,324 @@
+/**
+ * @file bridgecontrol.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bridgecontrol.h"
+#include "logger.h"
+
+/**
+ * @brief The pins of the swapped UART (D7 RX, D8 TX) and of the log on Serial1 (D4 TX).
+ */
+static const PinId BRIDGE_PINS[] = { PIN_DIG4, PIN_DIG7, PIN_DIG8 };
+
+/**
+ * @brief Construct a new Bridge Control object
+ *
+ * @param configControl instance pointer to the cofiguration control of the flash memory
+ * @param ioControl instance pointer to the pin control that reserves the swapped UART pins
+ * @param serialLink instance pointer to the serial console that gives up the UART
+ * @param metrics instance pointer to the metrics counters
+ */
+BridgeControl::BridgeControl( ConfigControl *configControl, IOControl *ioControl, SerialLink *serialLink, Metrics *metrics )
+: m_ConfigControl( configControl )
+, m_IOControl( ioControl )
+, m_SerialLink( serialLink )
+, m_Metrics( metrics )
+, m_Server( nullptr )
+, m_Active( false )
+, m_Pending( false )
+, m_Swapped( false )
+, m_Reserved( false )
+, m_Connected( false )
+, m_FirstByte( 0 )
+, m_LastProgress( 0 )
+{}
+
+/**
+ * @brief Start the bridge of the flash memory configuration, in the first update().
+ */
+void BridgeControl::load(){
+    if( !m_ConfigControl->BridgePort ) return;
+    uint16 result = reservePins( m_ConfigControl->BridgeSwap );
+    if( result != SUCCESS ) {
+        LOG_ERROR( LOG_NODEMCU, "BridgeControl::load: Serial bridge can not be started: %04X", result );
+        return;
+    }
+    m_Pending = true;
+}
+
+/**
+ * @brief Execute the configuration command of the bridge: config bridge PORT|off [BAUD] [FRAMING] [swap].
+ * The UART changes in the next update(), after the reply to the command has been sent.
+ * On an error the previous configuration stays.
+ *
+ * @param port the TCP port, 0 or off to stop the bridge
+ * @param baud the baud rate, empty for CONFIG_BRIDGE_BAUD_DEFAULT
+ * @param format the framing like 8N1, empty for 8N1
+ * @param swap swap to use D7 and D8 as UART pins
+ * @return uint16 result code
+ */
+uint16 BridgeControl::configure( const String &port, const String &baud, const String &format, const String &swap ){
+    bool off = port.equalsIgnoreCase( "off" ) || port == "0";
+    long number = off ? 0 : port.toInt();
+    if( !off && ( number < 1 || number > 65535 ) ) return ERROR_CONFIG_BRIDGE;
+    if( number && ( number == m_ConfigControl->PortTCP || number == m_ConfigControl->PortHTTP ) ) return ERROR_CONFIG_BRIDGE;
+
+    long rate = baud.length() ? baud.toInt() : CONFIG_BRIDGE_BAUD_DEFAULT;
+    if( rate < 300 || rate > 4000000 ) return ERROR_CONFIG_BRIDGE;
+    int framing = format.length() ? parseSerialFormat( format ) : SERIAL_8N1;
+    if( framing < 0 ) return ERROR_CONFIG_BRIDGE;
+    if( swap.length() && !swap.equalsIgnoreCase( "swap" ) ) return ERROR_CONFIG_BRIDGE;
+
+    uint16 result = reservePins( number && swap.length() );
+    if( result != SUCCESS ) return result;
+
+    m_ConfigControl->BridgePort = number;
+    m_ConfigControl->BridgeBaud = rate;
+    m_ConfigControl->BridgeFormat = framing;
+    m_ConfigControl->BridgeSwap = swap.length();
+    m_ConfigControl->markUpdated();
+    m_Pending = true;
+    LOG_INFO( LOG_NODEMCU, "BridgeControl::configure: Serial bridge %s", number ? "on" : "off" );
+    return SUCCESS;
+}
+
+/**
+ * @brief Apply a pending configuration change and move the data in both directions.
+ * Every direction moves what is available without waiting, the client is only served while wifi is connected.
+ *
+ * @param connected true when wifi is connected and clients can be accepted
+ * @return uint16 result code
+ */
+uint16 BridgeControl::update( bool connected ){
+    if( m_Pending ) {
+        m_Pending = false;
+        stop();
+        if( m_ConfigControl->BridgePort ) start();
+    }
+    if( !m_Active ) return SUCCESS;
+
+    unsigned long now = millis();
+    if( connected ) accept();
+    if( m_Connected && !m_Client.connected() ) {
+        LOG_INFO( LOG_NODEMCU, "BridgeControl::update: Serial bridge client disconnected." );
+        m_Client.stop();
+        m_Connected = false;
+    }
+
+    receiveUart( now );
+    if( m_Connected ) {
+        sendClient( now );
+        receiveClient();
+    }
+    sendUart();
+    return SUCCESS;
+}
+
+/**
+ * @brief Take the UART from the serial console and listen on the port.
+ */
+void BridgeControl::start(){
+    LOG_INFO( LOG_NODEMCU, "BridgeControl::start: Serial bridge on port %u at %u baud %s%s.", m_ConfigControl->BridgePort,
+        m_ConfigControl->BridgeBaud, serialFormatName( m_ConfigControl->BridgeFormat ).c_str(), m_ConfigControl->BridgeSwap ? " on D7 and D8" : "" );
+
+    // The log and the replies of the console still belong to the old settings
+    Log.drain();
+    Serial.flush();
+    m_SerialLink->reset();
+    Serial.setRxBufferSize( BRIDGE_UART_BUFFER );
+    Serial.begin( m_ConfigControl->BridgeBaud, static_cast<SerialConfig>( m_ConfigControl->BridgeFormat ) );
+    m_Swapped = m_ConfigControl->BridgeSwap;
+    if( m_Swapped ) {
+        Serial.swap();
+        Serial1.begin( m_SerialLink->textBaud() );
+        Log.Output = &Serial1;
+    } else {
+        Log.Output = nullptr;
+    }
+
+    m_Server = new WiFiServer( m_ConfigControl->BridgePort );
+    m_Server->begin();
+    m_Server->setNoDelay( true );
+    m_UartToClient.clear();
+    m_ClientToUart.clear();
+    m_Active = true;
+}
+
+/**
+ * @brief Close the client and the port and give the UART back to the serial console.
+ */
+void BridgeControl::stop(){
+    if( !m_Active ) return;
+    m_Active = false;
+    m_Client.stop();
+    m_Connected = false;
+    m_Server->stop();
+    delete m_Server;
+    m_Server = nullptr;
+
+    Serial.flush();
+    if( m_Swapped ) {
+        Serial.swap();
+        Serial1.end();
+        for( PinId pin: BRIDGE_PINS ) pinMode( m_ConfigControl->pinData[pin].gpio, INPUT );
+        m_Swapped = false;
+    }
+    Serial.begin( m_SerialLink->textBaud() );
+    m_SerialLink->reset();
+    Log.Output = &Serial;
+    LOG_INFO( LOG_NODEMCU, "BridgeControl::stop: Serial bridge stopped, %u bytes from and %u bytes to the UART.",
+        m_Metrics->BridgeUartIn, m_Metrics->BridgeUartOut );
+}
+
+/**
+ * @brief Reserve the pins of the swapped UART and the log, or release them.
+ * The pins must not be configured as anything but an input.
+ *
+ * @param reserve true to reserve D4, D7 and D8
+ * @return uint16 result code
+ */
+uint16 BridgeControl::reservePins( bool reserve ){
+    if( reserve == m_Reserved ) return SUCCESS;
+    if( reserve ) {
+        for( PinId pin: BRIDGE_PINS ){
+            PinConfig mode = m_ConfigControl->pinData[pin].mode;
+            if( m_IOControl->reserved( pin ) || ( mode != PIN_NOT_SET && mode != PIN_INPUT ) ) return PIN_ERROR | pin;
+        }
+    }
+    for( PinId pin: BRIDGE_PINS ) m_IOControl->reserve( pin, reserve );
+    m_Reserved = reserve;
+    return SUCCESS;
+}
+
+/**
+ * @brief Accept a waiting connection, it replaces the current client.
+ * A client that went away without closing its connection would otherwise keep the bridge forever.
+ */
+void BridgeControl::accept(){
+    if( !m_Server->hasClient() ) return;
+    if( m_Connected ) {
+        LOG_INFO( LOG_NODEMCU, "BridgeControl::accept: New connection replaces the serial bridge client." );
+        m_Client.stop();
+    }
+    m_Client = m_Server->accept();
+    m_Connected = true;
+    m_Client.setNoDelay( true );
+    m_UartToClient.clear();
+    m_ClientToUart.clear();
+    m_LastProgress = millis();
+    m_Metrics->BridgeConnections++;
+    LOG_INFO( LOG_NODEMCU, "BridgeControl::accept: Serial bridge client %s connected.", m_Client.remoteIP().toString().c_str() );
+}
+
+/**
+ * @brief Read the bytes the UART has received into the ring, without a client they are dropped.
+ * When the client does not take data for ConfigControl::BridgeStall ms the ring is emptied,
+ * otherwise a full ring leaves the bytes in the UART driver.
+ */
+void BridgeControl::receiveUart( unsigned long now ){
+    uint32 stall = m_ConfigControl->BridgeStall;
+    if( m_UartToClient.room() ) {
+        m_LastProgress = now;
+    } else if( stall && now - m_LastProgress >= stall ) {
+        LOG_WARN( LOG_NODEMCU, "BridgeControl::receiveUart: Client takes no data, dropped %u bytes.", static_cast<uint>( m_UartToClient.used() ) );
+        m_Metrics->BridgeDropped += m_UartToClient.used();
+        m_UartToClient.clear();
+        m_LastProgress = now;
+    }
+
+    int available = Serial.available();
+    while( available > 0 ){
+        size_t length;
+        uint8 *span = m_UartToClient.writeSpan( length );
+        if( !length ) break;
+        if( !m_UartToClient.used() ) m_FirstByte = now;
+        size_t count = Serial.read( span, std::min<size_t>( length, available ) );
+        if( !count ) break;
+        m_UartToClient.commit( count );
+        m_Metrics->BridgeUartIn += count;
+        available -= count;
+    }
+
+    if( !m_Connected ) {
+        m_Metrics->BridgeDropped += m_UartToClient.used();
+        m_UartToClient.clear();
+    }
+}
+
+/**
+ * @brief Send the collected UART bytes to the client once enough are waiting or the oldest is old enough.
+ * Only what the socket takes without blocking is written, the rest stays for the next loop iteration.
+ */
+void BridgeControl::sendClient( unsigned long now ){
+    size_t used = m_UartToClient.used();
+    if( !used ) return;
+    if( used < BRIDGE_CHUNK_SIZE && now - m_FirstByte < m_ConfigControl->BridgeFlush ) return;
+
+    while( m_UartToClient.used() ){
+        int room = m_Client.availableForWrite();
+        if( room <= 0 ) break;
+        size_t length;
+        const uint8 *span = m_UartToClient.readSpan( length );
+        size_t count = m_Client.write( span, std::min<size_t>( length, room ) );
+        if( !count ) break;
+        m_UartToClient.consume( count );
+        m_LastProgress = now;
+    }
+}
+
+/**
+ * @brief Read the bytes of the client as far as the ring has room.
+ * What does not fit stays in the socket, the TCP window then slows the client down to the baud rate.
+ */
+void BridgeControl::receiveClient(){
+    int available = m_Client.available();
+    while( available > 0 ){
+        size_t length;
+        uint8 *span = m_ClientToUart.writeSpan( length );
+        if( !length ) break;
+        int count = m_Client.read( span, std::min<size_t>( length, available ) );
+        if( count <= 0 ) break;
+        m_ClientToUart.commit( count );
+        available -= count;
+    }
+}
+
+/**
+ * @brief Write the bytes of the client to the UART as far as its transmit buffer has room.
+ */
+void BridgeControl::sendUart(){
+    while( m_ClientToUart.used() ){
+        int room = Serial.availableForWrite();
+        if( room <= 0 ) break;
+        size_t length;
+        const uint8 *span = m_ClientToUart.readSpan( length );
+        size_t count = Serial.write( span, std::min<size_t>( length, room ) );
+        if( !count ) break;
+        m_ClientToUart.consume( count );
+        m_Metrics->BridgeUartOut += count;
+    }
+}
@@ -0,0 +1,325 @@
+/**
+ * @file buscontrol.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "buscontrol.h"
+#include "logger.h"
+
+/**
+ * @brief The pins of the I2C bus: SCL and SDA.
+ */
+static const PinId I2C_PINS[] = { PIN_DIG1, PIN_DIG2 };
+
+/**
+ * @brief The pins of the SPI bus: SCK, MISO and MOSI.
+ */
+static const PinId SPI_PINS[] = { PIN_DIG5, PIN_DIG6, PIN_DIG7 };
+
+/**
+ * @brief The SPI modes by number.
+ */
+static const uint8 SPI_MODES[] = { SPI_MODE0, SPI_MODE1, SPI_MODE2, SPI_MODE3 };
+
+/**
+ * @brief Construct a new Bus Control object, both buses are inactive until they are started.
+ */
+BusControl::BusControl( ConfigControl *configControl, IOControl *ioControl )
+: m_ConfigControl( configControl )
+, m_IOControl( ioControl )
+, m_I2cActive( false )
+, m_SpiActive( false )
+, m_I2cUsers( 0 )
+, m_SpiUsers( 0 )
+, m_Owned( 0 )
+, m_SpiSettings( BUS_SPI_CLOCK, MSBFIRST, SPI_MODE0 )
+{}
+
+/**
+ * @brief Execute an i2c command: begin [CLOCK], end, scan, write ADDR HEX, read ADDR COUNT or write-read ADDR HEX COUNT.
+ * A write-read sends the bytes without stop and reads with a repeated start, like a register read of most sensors.
+ * 
+ * @param command the i2c command and its arguments
+ * @param out the output the reply is printed to
+ * @return uint16 result code
+ */
+uint16 BusControl::i2c( const std::vector<String> &command, Print &out ){
+    if( command.size() < 2 ) return ERROR_I2C;
+    const String &action = command[1];
+
+    if( action.equalsIgnoreCase( "begin" ) ) {
+        long clock = BUS_I2C_CLOCK;
+        if( command.size() > 2 && !parseNumber( command[2], 1000, 1000000, clock ) ) return ERROR_I2C;
+        return beginI2c( clock );
+    }
+    if( action.equalsIgnoreCase( "end" ) ) {
+        if( m_I2cUsers ) return ERROR_I2C_BUSY;
+        if( m_I2cActive ) releasePins( I2C_PINS, 2 );
+        m_I2cActive = false;
+        return SUCCESS;
+    }
+    if( !m_I2cActive ) return ERROR_I2C_INACTIVE;
+
+    if( action.equalsIgnoreCase( "scan" ) ) {
+        // 0x00-0x07 and 0x78-0x7F are reserved addresses
+        for( uint8 address = 0x08; address < 0x78; address++ ){
+            Wire.beginTransmission( address );
+            if( Wire.endTransmission() == 0 ) out.printf( "0x%02X\n", address );
+        }
+        return SUCCESS;
+    }
+
+    bool write = action.equalsIgnoreCase( "write" );
+    bool read = action.equalsIgnoreCase( "read" );
+    bool writeRead = action.equalsIgnoreCase( "write-read" );
+    if( !write && !read && !writeRead ) return ERROR_I2C;
+
+    uint arguments = writeRead ? 5 : 4;
+    long address = 0;
+    long count = 0;
+    uint8 data[BUS_MAX_TRANSFER];
+    uint length = 0;
+    if( command.size() < arguments || !parseNumber( command[2], 0x00, 0x7F, address ) ) return ERROR_I2C;
+    if( !read && !parseHex( command[3], data, BUS_MAX_TRANSFER, length ) ) return ERROR_I2C;
+    if( !write && !parseNumber( command[arguments - 1], 1, BUS_MAX_TRANSFER, count ) ) return ERROR_I2C;
+
+    if( !read ) {
+        Wire.beginTransmission( address );
+        Wire.write( data, length );
+        uint8 error = Wire.endTransmission( write );
+        if( error ) return ERROR_I2C_NACK | error;
+    }
+    if( !write ) {
+        // The amount of received bytes is 0 when the address is not acknowledged
+        if( Wire.requestFrom( static_cast<uint8>( address ), static_cast<size_t>( count ), true ) != static_cast<size_t>( count ) ) return ERROR_I2C_NACK | 2;
+        for( long i = 0; i < count; i++ ) data[i] = Wire.read();
+        printHex( out, data, count );
+    }
+    LOG_DEBUG( LOG_IO, "BusControl::i2c: %s 0x%02lX, %u bytes written, %ld bytes read", action.c_str(), address, length, count );
+    return SUCCESS;
+}
+
+/**
+ * @brief Execute a spi command: begin [CLOCK] [MODE], end, transfer CS HEX, write CS HEX, read CS COUNT or write-read CS HEX COUNT.
+ * The chip select pin is low for the whole transaction. A transfer replies the bytes received while
+ * the bytes were sent, a read sends 0xFF for every byte.
+ * 
+ * @param command the spi command and its arguments
+ * @param out the output the reply is printed to
+ * @return uint16 result code
+ */
+uint16 BusControl::spi( const std::vector<String> &command, Print &out ){
+    if( command.size() < 2 ) return ERROR_SPI;
+    const String &action = command[1];
+
+    if( action.equalsIgnoreCase( "begin" ) ) {
+        long clock = BUS_SPI_CLOCK;
+        long mode = 0;
+        if( command.size() > 2 && !parseNumber( command[2], 1000, 80000000, clock ) ) return ERROR_SPI;
+        if( command.size() > 3 && !parseNumber( command[3], 0, 3, mode ) ) return ERROR_SPI;
+        uint16 result = beginSpi();
+        if( result != SUCCESS ) return result;
+        m_SpiSettings = SPISettings( clock, MSBFIRST, SPI_MODES[mode] );
+        LOG_INFO( LOG_IO, "BusControl::spi: started at %ld Hz, mode %ld", clock, mode );
+        return SUCCESS;
+    }
+    if( action.equalsIgnoreCase( "end" ) ) {
+        if( m_SpiUsers ) return ERROR_SPI_BUSY;
+        if( m_SpiActive ) {
+            SPI.end();
+            releasePins( SPI_PINS, 3 );
+        }
+        m_SpiActive = false;
+        return SUCCESS;
+    }
+    if( !m_SpiActive ) return ERROR_SPI_INACTIVE;
+
+    bool transfer = action.equalsIgnoreCase( "transfer" );
+    bool write = action.equalsIgnoreCase( "write" );
+    bool read = action.equalsIgnoreCase( "read" );
+    bool writeRead = action.equalsIgnoreCase( "write-read" );
+    if( !transfer && !write && !read && !writeRead ) return ERROR_SPI;
+
+    uint arguments = writeRead ? 5 : 4;
+    long count = 0;
+    uint8 data[BUS_MAX_TRANSFER];
+    uint length = 0;
+    uint8 gpio = 0;
+    if( command.size() < arguments ) return ERROR_SPI;
+    uint16 result = selectPin( command[2], gpio );
+    if( result != SUCCESS ) return result;
+    if( !read && !parseHex( command[3], data, BUS_MAX_TRANSFER, length ) ) return ERROR_SPI;
+    if( ( read || writeRead ) && !parseNumber( command[arguments - 1], 1, BUS_MAX_TRANSFER, count ) ) return ERROR_SPI;
+
+    SPI.beginTransaction( m_SpiSettings );
+    digitalWrite( gpio, LOW );
+    if( length ) SPI.transfer( data, length );
+    if( count ) {
+        memset( data, 0xFF, count );
+        SPI.transfer( data, count );
+    }
+    digitalWrite( gpio, HIGH );
+    SPI.endTransaction();
+
+    if( transfer ) printHex( out, data, length );
+    else if( count ) printHex( out, data, count );
+    LOG_DEBUG( LOG_IO, "BusControl::spi: %s CS GPIO%d, %u bytes written, %ld bytes read", action.c_str(), gpio, length, count );
+    return SUCCESS;
+}
+
+/**
+ * @brief Start the I2C bus for a driver, like a port expander. It stays started until every driver closed it.
+ * 
+ * @return uint16 result code
+ */
+uint16 BusControl::openI2c(){
+    if( !m_I2cActive ) {
+        uint16 result = beginI2c( BUS_I2C_CLOCK );
+        if( result != SUCCESS ) return result;
+    }
+    m_I2cUsers++;
+    return SUCCESS;
+}
+
+/**
+ * @brief Close the I2C bus of a driver.
+ */
+void BusControl::closeI2c(){
+    if( m_I2cUsers ) m_I2cUsers--;
+}
+
+/**
+ * @brief Start the SPI bus for a driver. It stays started until every driver closed it.
+ * 
+ * @return uint16 result code
+ */
+uint16 BusControl::openSpi(){
+    uint16 result = beginSpi();
+    if( result != SUCCESS ) return result;
+    m_SpiUsers++;
+    return SUCCESS;
+}
+
+/**
+ * @brief Close the SPI bus of a driver.
+ */
+void BusControl::closeSpi(){
+    if( m_SpiUsers ) m_SpiUsers--;
+}
+
+/**
+ * @brief Start the I2C bus if it is not started yet and set its clock.
+ * 
+ * @return uint16 result code
+ */
+uint16 BusControl::beginI2c( long clock ){
+    if( !m_I2cActive ) {
+        uint16 result = reservePins( I2C_PINS, 2, ERROR_I2C_PINS );
+        if( result != SUCCESS ) return result;
+        Wire.begin( m_ConfigControl->pinData[PIN_DIG2].gpio, m_ConfigControl->pinData[PIN_DIG1].gpio );
+        m_I2cActive = true;
+    }
+    Wire.setClock( clock );
+    LOG_INFO( LOG_IO, "BusControl::beginI2c: started at %ld Hz", clock );
+    return SUCCESS;
+}
+
+/**
+ * @brief Start the SPI bus if it is not started yet.
+ * 
+ * @return uint16 result code
+ */
+uint16 BusControl::beginSpi(){
+    if( m_SpiActive ) return SUCCESS;
+    uint16 result = reservePins( SPI_PINS, 3, ERROR_SPI_PINS );
+    if( result != SUCCESS ) return result;
+    SPI.begin();
+    m_SpiActive = true;
+    return SUCCESS;
+}
+
+/**
+ * @brief Reserve the pins of a bus, none of them when one is reserved by another driver
+ * (bridge, LED strip, sensor) or configured as output or pulse input.
+ * 
+ * @param pins the pins of the bus
+ * @param count the amount of pins
+ * @param error the result code of the bus for a pin that is in use
+ * @return uint16 result code, an error contains the PinId
+ */
+uint16 BusControl::reservePins( const PinId *pins, uint count, uint16 error ){
+    for( uint i = 0; i < count; i++ ){
+        PinConfig mode = m_ConfigControl->pinData[pins[i]].mode;
+        if( m_IOControl->reserved( pins[i] ) || ( mode != PIN_NOT_SET && mode != PIN_INPUT ) ) return error | pins[i];
+    }
+    for( uint i = 0; i < count; i++ ){
+        m_IOControl->reserve( pins[i], true );
+        m_Owned |= 1 << pins[i];
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Release the pins of a bus that the bus reserved, they return to inputs.
+ */
+void BusControl::releasePins( const PinId *pins, uint count ){
+    for( uint i = 0; i < count; i++ ){
+        if( !( m_Owned & ( 1 << pins[i] ) ) ) continue;
+        m_Owned &= ~( 1 << pins[i] );
+        pinMode( m_ConfigControl->pinData[pins[i]].gpio, INPUT );
+        m_IOControl->reserve( pins[i], false );
+    }
+}
+
+/**
+ * @brief Select the chip select pin of a SPI transaction, it has to be configured as output.
+ * 
+ * @param pin the argument with the pin
+ * @param gpio output buffer for the GPIO of the pin
+ * @return uint16 result code
+ */
+uint16 BusControl::selectPin( const String &pin, uint8 &gpio ){
+    PinId id = parsePinCommand( pin );
+    auto data = m_ConfigControl->pinData.find( id );
+    if( data == m_ConfigControl->pinData.end() ) return PIN_ERROR;
+    if( id == PIN_ANA0 || data->second.mode != PIN_OUTPUT || m_IOControl->reserved( id ) ) return ERROR_SPI_CS | id;
+    gpio = data->second.gpio;
+    return SUCCESS;
+}
+
+/**
+ * @brief Print bytes in hex notation on a single line.
+ */
+void BusControl::printHex( Print &out, const uint8 *data, uint length ){
+    static const char digits[] = "0123456789ABCDEF";
+    char line[BUS_MAX_TRANSFER * 2 + 1];
+    for( uint i = 0; i < length; i++ ){
+        line[i * 2] = digits[data[i] >> 4];
+        line[i * 2 + 1] = digits[data[i] & 0x0F];
+    }
+    line[length * 2] = '\0';
+    out.println( line );
+}
@@ -39,6 +39,16 @@ Command parseCommand(const String &command){
     if( command.equalsIgnoreCase( "config" ) ) return COMMAND_CONFIG;
     if( command.equalsIgnoreCase( "read" ) ) return COMMAND_READ;
     if( command.equalsIgnoreCase( "write" ) ) return COMMAND_WRITE;
+    if( command.equalsIgnoreCase( "boot-stats" ) ) return COMMAND_BOOT_STATS;
+    if( command.equalsIgnoreCase( "stats" ) ) return COMMAND_STATS;
+    if( command.equalsIgnoreCase( "metrics" ) ) return COMMAND_METRICS;
+    if( command.equalsIgnoreCase( "log" ) ) return COMMAND_LOG;
+    if( command.equalsIgnoreCase( "serial" ) ) return COMMAND_SERIAL;
+    if( command.equalsIgnoreCase( "clients" ) ) return COMMAND_CLIENTS;
+    if( command.equalsIgnoreCase( "i2c" ) ) return COMMAND_I2C;
+    if( command.equalsIgnoreCase( "spi" ) ) return COMMAND_SPI;
+    if( command.equalsIgnoreCase( "sensor" ) ) return COMMAND_SENSOR;
+    if( command.equalsIgnoreCase( "pixels" ) ) return COMMAND_PIXELS;
     return COMMAND_ERROR;
 }
 
@@ -62,6 +72,22 @@ ConfigCommand parseConfigCommand(const String &command){
     if( command.equalsIgnoreCase( "dns2" )) return CONFIG_DNS2;
     if( command.equalsIgnoreCase( "max-clients" )) return CONFIG_MAX_CLIENTS;
     if( command.equalsIgnoreCase( "timeout" )) return CONFIG_INACTIVE_TIMEOUT;
+    if( command.equalsIgnoreCase( "save-delay" )) return CONFIG_SAVE_DELAY;
+    if( command.equalsIgnoreCase( "fast-boot" )) return CONFIG_FAST_BOOT;
+    if( command.equalsIgnoreCase( "udp-port" )) return CONFIG_PORT_UDP;
+    if( command.equalsIgnoreCase( "multicast" )) return CONFIG_MULTICAST;
+    if( command.equalsIgnoreCase( "client-rate" )) return CONFIG_CLIENT_RATE;
+    if( command.equalsIgnoreCase( "client-bandwidth" )) return CONFIG_CLIENT_BANDWIDTH;
+    if( command.equalsIgnoreCase( "admission" )) return CONFIG_ADMISSION;
+    if( command.equalsIgnoreCase( "http-keep-alive" )) return CONFIG_HTTP_KEEP_ALIVE;
+    if( command.equalsIgnoreCase( "http-max-requests" )) return CONFIG_HTTP_MAX_REQUESTS;
+    if( command.equalsIgnoreCase( "expander" )) return CONFIG_EXPANDER;
+    if( command.equalsIgnoreCase( "expander-poll" )) return CONFIG_EXPANDER_POLL;
+    if( command.equalsIgnoreCase( "sensor" )) return CONFIG_SENSOR;
+    if( command.equalsIgnoreCase( "bridge" )) return CONFIG_BRIDGE;
+    if( command.equalsIgnoreCase( "bridge-flush" )) return CONFIG_BRIDGE_FLUSH;
+    if( command.equalsIgnoreCase( "bridge-stall" )) return CONFIG_BRIDGE_STALL;
+    if( command.equalsIgnoreCase( "pixels" )) return CONFIG_PIXELS;
     return CONFIG_ERROR;
 }
 
@@ -74,6 +100,9 @@ ConfigCommand parseConfigCommand(const String &command){
 PinConfig parsePinConfigCommand(const String &command){
     if( command.equalsIgnoreCase( "input" ) ) return PIN_INPUT;
     if( command.equalsIgnoreCase( "output" ) ) return PIN_OUTPUT;
+    if( command.equalsIgnoreCase( "counter" ) ) return PIN_COUNTER;
+    if( command.equalsIgnoreCase( "frequency" ) ) return PIN_FREQUENCY;
+    if( command.equalsIgnoreCase( "pulse-width" ) ) return PIN_PULSE_WIDTH;
     return PIN_NOT_SET;
 }
 
@@ -94,9 +123,81 @@ PinId parsePinCommand(const String &command){
     if( command.equalsIgnoreCase( "D6" ) ) return PIN_DIG6;
     if( command.equalsIgnoreCase( "D7" ) ) return PIN_DIG7;
     if( command.equalsIgnoreCase( "D8" ) ) return PIN_DIG8;
+
+    // The pins of the port expanders are E0 to E95, 16 per expander
+    if( command.length() >= 2 && command.length() <= 3 && ( command[0] == 'E' || command[0] == 'e' ) ) {
+        int number = 0;
+        for( uint i = 1; i < command.length(); i++ ){
+            if( command[i] < '0' || command[i] > '9' ) return PIN_ERROR;
+            number = number * 10 + command[i] - '0';
+        }
+        if( number <= PIN_EXP_LAST - PIN_EXP0 ) return static_cast<PinId>( PIN_EXP0 + number );
+    }
     return PIN_ERROR;
 }
 
+/**
+ * @brief This functon is called to convert a digital pin value (0, 1, low or high) into a number
+ * 
+ * @param value the provided value string
+ * @return the value or -1 if it is not a digital value
+ */
+int parsePinValue(const String &value){
+    if( value == "0" || value.equalsIgnoreCase( "low" ) ) return 0;
+    if( value == "1" || value.equalsIgnoreCase( "high" ) ) return 1;
+    return -1;
+}
+
+/**
+ * @brief This functon is called to convert a number in decimal, hex (0x) or octal (0) notation within a range.
+ * 
+ * @param text the provided number string
+ * @param min the smallest valid value
+ * @param max the largest valid value
+ * @param value output buffer for the number
+ * @return false if the text is no number or it is out of range
+ */
+bool parseNumber( const String &text, long min, long max, long &value ){
+    char *end = nullptr;
+    value = strtol( text.c_str(), &end, 0 );
+    return text.length() && *end == '\0' && value >= min && value <= max;
+}
+
+/**
+ * @brief Return the value of a hex digit, -1 if it is none.
+ */
+static int hexDigit( char digit ){
+    if( digit >= '0' && digit <= '9' ) return digit - '0';
+    if( digit >= 'a' && digit <= 'f' ) return digit - 'a' + 10;
+    if( digit >= 'A' && digit <= 'F' ) return digit - 'A' + 10;
+    return -1;
+}
+
+/**
+ * @brief This functon is called to convert bytes in hex notation, with an optional 0x prefix and two digits per byte.
+ * All digits are checked before the first byte is written, so on an error the buffer is unchanged.
+ * 
+ * @param text the provided hex string
+ * @param data output buffer for the bytes
+ * @param size the size of the output buffer
+ * @param length output buffer for the amount of bytes
+ * @return false if the text is no hex or longer than the buffer
+ */
+bool parseHex( const String &text, uint8 *data, uint size, uint &length ){
+    const char *hex = text.c_str();
+    if( hex[0] == '0' && ( hex[1] == 'x' || hex[1] == 'X' ) ) hex += 2;
+    size_t digits = strlen( hex );
+    if( digits == 0 || digits % 2 || digits / 2 > size ) return false;
+    for( size_t i = 0; i < digits; i++ ){
+        if( hexDigit( hex[i] ) < 0 ) return false;
+    }
+
+    for( length = 0; length < digits / 2; length++ ){
+        data[length] = hexDigit( hex[length * 2] ) << 4 | hexDigit( hex[length * 2 + 1] );
+    }
+    return true;
+}
+
 /**
  * @brief This functon is called to convert a string commands into an enumerator value
  * 
@@ -107,5 +208,162 @@ Protocol parseProtocolCommand(const String &command){
     if( command.equalsIgnoreCase( "http" ) ) return PROTOCOL_HTTP;
     if( command.equalsIgnoreCase( "tcp" ) ) return PROTOCOL_TCP;
     if( command.equalsIgnoreCase( "serial" ) ) return PROTOCOL_SERIAL;
+    if( command.equalsIgnoreCase( "udp" ) ) return PROTOCOL_UDP;
     return PROTOCOL_ERROR;
-}
\ No newline at end of file
+}
+/**
+ * @brief This functon is called to split a received command line into the command and its arguments.
+ * 
+ * @param input the received command line
+ * @param command output buffer for the command and arguments
+ */
+void splitCommand( String input, std::vector<String> &command ){
+    while( input.length() > 0 ) {
+        int spaceIndex = input.indexOf(' ');
+        if( spaceIndex == -1 ) {
+            input.trim();
+            command.push_back( input );
+            input = "";
+        } else {
+            command.push_back( input.substring( 0, spaceIndex ) );
+            input = input.substring( spaceIndex + 1 );
+        }
+    }
+}
+
+/**
+ * @brief This functon is called to convert a command enumerator value into its name.
+ * 
+ * @param command the command value
+ * @return the name of the command or "error"
+ */
+const char *commandName( const Command &command ){
+    switch( command ){
+    case COMMAND_RESET: return "reset";
+    case COMMAND_CONFIG: return "config";
+    case COMMAND_READ: return "read";
+    case COMMAND_WRITE: return "write";
+    case COMMAND_BOOT_STATS: return "boot-stats";
+    case COMMAND_STATS: return "stats";
+    case COMMAND_METRICS: return "metrics";
+    case COMMAND_LOG: return "log";
+    case COMMAND_SERIAL: return "serial";
+    case COMMAND_CLIENTS: return "clients";
+    case COMMAND_I2C: return "i2c";
+    case COMMAND_SPI: return "spi";
+    case COMMAND_SENSOR: return "sensor";
+    case COMMAND_PIXELS: return "pixels";
+    default: return "error";
+    }
+}
+
+/**
+ * @brief This functon is called to convert a protocol enumerator value into its name.
+ * 
+ * @param protocol the protocol value
+ * @return the name of the protocol or "error"
+ */
+const char *protocolName( const Protocol &protocol ){
+    switch( protocol ){
+    case PROTOCOL_HTTP: return "http";
+    case PROTOCOL_TCP: return "tcp";
+    case PROTOCOL_SERIAL: return "serial";
+    case PROTOCOL_UDP: return "udp";
+    default: return "error";
+    }
+}
+
+/**
+ * @brief This functon is called to convert a port expander chip name into an enumerator value
+ * 
+ * @param type the provided chip name
+ * @return an enum value of ExpanderType or EXPANDER_ERROR
+ */
+ExpanderType parseExpanderType( const String &type ){
+    if( type.equalsIgnoreCase( "none" ) ) return EXPANDER_NONE;
+    if( type.equalsIgnoreCase( "mcp23017" ) ) return EXPANDER_MCP23017;
+    if( type.equalsIgnoreCase( "pcf8574" ) ) return EXPANDER_PCF8574;
+    if( type.equalsIgnoreCase( "74hc595" ) ) return EXPANDER_74HC595;
+    return EXPANDER_ERROR;
+}
+
+/**
+ * @brief This functon is called to convert a port expander enumerator value into its chip name.
+ * 
+ * @param type the expander type
+ * @return the name of the chip or "none"
+ */
+const char *expanderName( const ExpanderType &type ){
+    switch( type ){
+    case EXPANDER_MCP23017: return "mcp23017";
+    case EXPANDER_PCF8574: return "pcf8574";
+    case EXPANDER_74HC595: return "74hc595";
+    default: return "none";
+    }
+}
+
+/**
+ * @brief This functon is called to convert a sensor chip name into an enumerator value
+ * 
+ * @param type the provided chip name
+ * @return an enum value of SensorType or SENSOR_ERROR
+ */
+SensorType parseSensorType( const String &type ){
+    if( type.equalsIgnoreCase( "none" ) ) return SENSOR_NONE;
+    if( type.equalsIgnoreCase( "ds18b20" ) ) return SENSOR_DS18B20;
+    if( type.equalsIgnoreCase( "dht11" ) ) return SENSOR_DHT11;
+    if( type.equalsIgnoreCase( "dht22" ) ) return SENSOR_DHT22;
+    return SENSOR_ERROR;
+}
+
+/**
+ * @brief This functon is called to convert a sensor enumerator value into its chip name.
+ * 
+ * @param type the sensor type
+ * @return the name of the chip or "none"
+ */
+const char *sensorName( const SensorType &type ){
+    switch( type ){
+    case SENSOR_DS18B20: return "ds18b20";
+    case SENSOR_DHT11: return "dht11";
+    case SENSOR_DHT22: return "dht22";
+    default: return "none";
+    }
+}
+
+/**
+ * @brief This functon is called to convert a UART framing like 8N1 or 7E2 into its SerialConfig value.
+ * The value has the ESP8266 UART register layout: data bits - 5 in bit 2-3, parity in bit 0-1 and stop bits in bit 4-5.
+ * 
+ * @param format the data bits (5-8), parity (N, E or O) and stop bits (1 or 2)
+ * @return the SerialConfig value or -1 if the framing is not valid
+ */
+int parseSerialFormat( const String &format ){
+    if( format.length() != 3 ) return -1;
+    char bits = format[0];
+    char parity = toupper( format[1] );
+    char stop = format[2];
+    if( bits < '5' || bits > '8' || ( stop != '1' && stop != '2' ) ) return -1;
+
+    int value = ( bits - '5' ) << 2 | ( stop == '1' ? 0x10 : 0x30 );
+    if( parity == 'E' ) value |= 0x02;
+    else if( parity == 'O' ) value |= 0x03;
+    else if( parity != 'N' ) return -1;
+    return value;
+}
+
+/**
+ * @brief This functon is called to convert a SerialConfig value into its framing like 8N1.
+ * 
+ * @param format the SerialConfig value
+ * @return the framing
+ */
+String serialFormatName( uint8 format ){
+    char name[4] = {
+        static_cast<char>( '5' + ( ( format >> 2 ) & 0x03 ) ),
+        ( format & 0x03 ) == 0x02 ? 'E' : ( format & 0x03 ) == 0x03 ? 'O' : 'N',
+        ( format & 0x30 ) == 0x30 ? '2' : '1',
+        0
+    };
+    return String( name );
+}
@@ -27,29 +27,58 @@
  * SOFTWARE.
  */
 #include "configcontrol.h"
+#include "logger.h"
 
 ConfigControl::ConfigControl(){
     LittleFS.begin();
-    pinData.emplace( PIN_ANA0, (IO_PIN){ "A0", A0, PIN_INPUT, 0 } );
-    pinData.emplace( PIN_DIG0, (IO_PIN){ "D0", D0, PIN_NOT_SET, 0 } );
-    pinData.emplace( PIN_DIG1, (IO_PIN){ "D1", D1, PIN_NOT_SET, 0 } );
-    pinData.emplace( PIN_DIG2, (IO_PIN){ "D2", D2, PIN_NOT_SET, 0 } );
-    pinData.emplace( PIN_DIG3, (IO_PIN){ "D3", D3, PIN_NOT_SET, 0 } );
-    pinData.emplace( PIN_DIG4, (IO_PIN){ "D4", D4, PIN_NOT_SET, 0 } );
-    pinData.emplace( PIN_DIG5, (IO_PIN){ "D5", D5, PIN_NOT_SET, 0 } );
-    pinData.emplace( PIN_DIG6, (IO_PIN){ "D6", D6, PIN_NOT_SET, 0 } );
-    pinData.emplace( PIN_DIG7, (IO_PIN){ "D7", D7, PIN_NOT_SET, 0 } );
-    pinData.emplace( PIN_DIG8, (IO_PIN){ "D8", D8, PIN_NOT_SET, 0 } );
+    pinData.emplace( PIN_ANA0, (IO_PIN){ "A0", A0, PIN_INPUT, 0, 0 } );
+    pinData.emplace( PIN_DIG0, (IO_PIN){ "D0", D0, PIN_NOT_SET, 0, 0 } );
+    pinData.emplace( PIN_DIG1, (IO_PIN){ "D1", D1, PIN_NOT_SET, 0, 0 } );
+    pinData.emplace( PIN_DIG2, (IO_PIN){ "D2", D2, PIN_NOT_SET, 0, 0 } );
+    pinData.emplace( PIN_DIG3, (IO_PIN){ "D3", D3, PIN_NOT_SET, 0, 0 } );
+    pinData.emplace( PIN_DIG4, (IO_PIN){ "D4", D4, PIN_NOT_SET, 0, 0 } );
+    pinData.emplace( PIN_DIG5, (IO_PIN){ "D5", D5, PIN_NOT_SET, 0, 0 } );
+    pinData.emplace( PIN_DIG6, (IO_PIN){ "D6", D6, PIN_NOT_SET, 0, 0 } );
+    pinData.emplace( PIN_DIG7, (IO_PIN){ "D7", D7, PIN_NOT_SET, 0, 0 } );
+    pinData.emplace( PIN_DIG8, (IO_PIN){ "D8", D8, PIN_NOT_SET, 0, 0 } );
     updated = false;
+    SaveDelay = CONFIG_SAVE_DELAY_DEFAULT;
+    WriteCount = 0;
+    FastBoot = false;
+    PortUDP = 0;
+    ClientRate = 0;
+    ClientBandwidth = 0;
+    Admission = ADMISSION_EVICT;
+    HttpKeepAlive = CONFIG_HTTP_KEEP_ALIVE_DEFAULT;
+    HttpMaxRequests = CONFIG_HTTP_MAX_REQUESTS_DEFAULT;
+    ExpanderPoll = CONFIG_EXPANDER_POLL_DEFAULT;
+    for( EXPANDER_CONFIG &expander: Expanders ) expander = (EXPANDER_CONFIG){ EXPANDER_NONE, 0, EXPANDER_NO_PIN, 0, 0 };
+    for( SENSOR_CONFIG &sensor: Sensors ) sensor = (SENSOR_CONFIG){ SENSOR_NONE, 0, 0 };
+    BridgePort = 0;
+    BridgeBaud = CONFIG_BRIDGE_BAUD_DEFAULT;
+    BridgeFormat = SERIAL_8N1;
+    BridgeSwap = false;
+    BridgeFlush = CONFIG_BRIDGE_FLUSH_DEFAULT;
+    BridgeStall = CONFIG_BRIDGE_STALL_DEFAULT;
+    PixelPin = 0;
+    PixelCount = 0;
+    m_FirstUpdate = 0;
+    m_LastUpdate = 0;
 }
 
 ConfigControl::~ConfigControl()
 {}
 
 void ConfigControl::loadConfig(){
+    // A left over temporary file is a save that was interrupted before it replaced the configuration file
+    if( LittleFS.exists( CONFIG_TEMP_FILE ) ) {
+        LOG_WARN( LOG_CONFIG, "ConfigControl::loadConfig: Removing incomplete configuration save." );
+        LittleFS.remove( CONFIG_TEMP_FILE );
+    }
+
     // check if the file exists, load default values if not available.
     if (!LittleFS.exists(CONFIG_FILE)) {
-        Serial.println("ConfigControl::loadConfig: Configuration file not found, using defaults.");
+        LOG_INFO( LOG_CONFIG, "ConfigControl::loadConfig: Configuration file not found, using defaults." );
         StaticIP.fromString( "192.168.0.222" );
         Subnet.fromString( "255.255.255.0" );
         Gateway.fromString( "192.168.0.1" );
@@ -59,6 +88,17 @@ void ConfigControl::loadConfig(){
         DnsSecundary.fromString( "8.8.4.4" );
         MaxClients = 12;
         InActiveTimeout = 1000*60*2;
+        SaveDelay = CONFIG_SAVE_DELAY_DEFAULT;
+        WriteCount = 0;
+        FastBoot = false;
+        PortUDP = 0;
+        MulticastGroup = IPAddress();
+        ClientRate = 0;
+        ClientBandwidth = 0;
+        Admission = ADMISSION_EVICT;
+        HttpKeepAlive = CONFIG_HTTP_KEEP_ALIVE_DEFAULT;
+        HttpMaxRequests = CONFIG_HTTP_MAX_REQUESTS_DEFAULT;
+        ExpanderPoll = CONFIG_EXPANDER_POLL_DEFAULT;
         loaded = true;
         return;
     }
@@ -66,7 +106,7 @@ void ConfigControl::loadConfig(){
     // Open the configuration file for reading
     File configFile = LittleFS.open(CONFIG_FILE, "r"); 
     if( !configFile ){
-        Serial.println("ConfigControl::loadConfig: Failed to open the configuraton file.");
+        LOG_ERROR( LOG_CONFIG, "ConfigControl::loadConfig: Failed to open the configuraton file." );
         return;
     }
 
@@ -107,25 +147,182 @@ void ConfigControl::loadConfig(){
     MaxClients = static_cast<uint>( configFile.parseInt() );
     InActiveTimeout = static_cast<uint32>( configFile.parseInt() );
 
+    // Files saved by older versions dont have the flash memory settings
+    SaveDelay = configFile.available() ? static_cast<uint32>( configFile.parseInt() ) : 0;
+    WriteCount = configFile.available() ? static_cast<uint32>( configFile.parseInt() ) : 0;
+    FastBoot = configFile.available() ? configFile.parseInt() != 0 : false;
+    PortUDP = configFile.available() ? static_cast<uint16>( configFile.parseInt() ) : 0;
+
+    MulticastGroup = IPAddress();
+    if( configFile.available() ) {
+        // consume last \n before reading string
+        configFile.read();
+        s = configFile.readStringUntil( '\n' ); s.trim();
+        MulticastGroup.fromString( s );
+    }
+    ClientRate = configFile.available() ? static_cast<uint32>( configFile.parseInt() ) : 0;
+    ClientBandwidth = configFile.available() ? static_cast<uint32>( configFile.parseInt() ) : 0;
+    Admission = configFile.available() ? static_cast<AdmissionPolicy>( configFile.parseInt() ) : ADMISSION_EVICT;
+    HttpKeepAlive = configFile.available() ? static_cast<uint32>( configFile.parseInt() ) : CONFIG_HTTP_KEEP_ALIVE_DEFAULT;
+    HttpMaxRequests = configFile.available() ? static_cast<uint32>( configFile.parseInt() ) : CONFIG_HTTP_MAX_REQUESTS_DEFAULT;
+    for( PinId pin: { PIN_DIG0, PIN_DIG1, PIN_DIG2, PIN_DIG3, PIN_DIG4, PIN_DIG5, PIN_DIG6, PIN_DIG7, PIN_DIG8 } ){
+        pinData[pin].filter = configFile.available() ? static_cast<uint32>( configFile.parseInt() ) : 0;
+    }
+    ExpanderPoll = configFile.available() ? static_cast<uint32>( configFile.parseInt() ) : CONFIG_EXPANDER_POLL_DEFAULT;
+    for( EXPANDER_CONFIG &expander: Expanders ){
+        if( !configFile.available() ) break;
+        expander.type = static_cast<ExpanderType>( configFile.parseInt() );
+        expander.address = static_cast<uint8>( configFile.parseInt() );
+        expander.interrupt = static_cast<uint8>( configFile.parseInt() );
+        expander.inputs = static_cast<uint16>( configFile.parseInt() );
+        expander.outputs = static_cast<uint16>( configFile.parseInt() );
+    }
+    for( SENSOR_CONFIG &sensor: Sensors ){
+        if( !configFile.available() ) break;
+        sensor.type = static_cast<SensorType>( configFile.parseInt() );
+        sensor.pin = static_cast<uint8>( configFile.parseInt() );
+        sensor.interval = static_cast<uint32>( configFile.parseInt() );
+    }
+    if( configFile.available() ) {
+        BridgePort = static_cast<uint16>( configFile.parseInt() );
+        BridgeBaud = static_cast<uint32>( configFile.parseInt() );
+        BridgeFormat = static_cast<uint8>( configFile.parseInt() );
+        BridgeSwap = configFile.parseInt() != 0;
+        BridgeFlush = static_cast<uint32>( configFile.parseInt() );
+        BridgeStall = static_cast<uint32>( configFile.parseInt() );
+    }
+    if( configFile.available() ) {
+        PixelPin = static_cast<uint8>( configFile.parseInt() );
+        PixelCount = static_cast<uint16>( configFile.parseInt() );
+    }
+    if( ExpanderPoll < 1 ) ExpanderPoll = CONFIG_EXPANDER_POLL_DEFAULT;
+    if( SaveDelay < 1 ) SaveDelay = CONFIG_SAVE_DELAY_DEFAULT;
+
     // Done close the configuration file.
     configFile.close();
     loaded = true;
-    Serial.println("ConfigControl::loadConfig: Configuration file has been loaded from flash memory.");
+    LOG_INFO( LOG_CONFIG, "ConfigControl::loadConfig: Configuration file has been loaded from flash memory." );
 }
 
 void ConfigControl::saveConfig(){
     // skip if no changes have been made
     if( !updated ) return;
 
-    // Open configuration file on flash memory to overwrite it
-    File configFile = LittleFS.open(CONFIG_FILE, "w"); 
+    // Wait until changes stop coming in, but dont defer a pending change forever
+    unsigned long now = millis();
+    if( ( now - m_LastUpdate < SaveDelay ) && ( now - m_FirstUpdate < SaveDelay * CONFIG_SAVE_MAX_DEFER ) ) return;
+    updated = false;
+
+    // Skip the flash write when the stored file already has the same content
+    char content[CONFIG_BUFFER_SIZE];
+    size_t length = serializeConfig( content, sizeof( content ), WriteCount );
+    if( !length ) {
+        // Keep the change pending, the next change may make it fit again
+        LOG_ERROR( LOG_CONFIG, "ConfigControl::saveConfig: Configuration does not fit in the save buffer, not saved." );
+        markUpdated();
+        return;
+    }
+    if( isStored( content, length ) ) {
+        LOG_DEBUG( LOG_CONFIG, "ConfigControl::saveConfig: Configuration unchanged, skipped flash write." );
+        return;
+    }
+    length = serializeConfig( content, sizeof( content ), WriteCount + 1 );
+
+    // Write to a temporary file first so a power loss can never leave a half written configuration file
+    File configFile = LittleFS.open(CONFIG_TEMP_FILE, "w"); 
     if( !configFile ) {
-        Serial.println("ConfigControl::saveConfig: Failed to open config file for writing.");
+        LOG_ERROR( LOG_CONFIG, "ConfigControl::saveConfig: Failed to open config file for writing." );
+        markUpdated();
+        return;
+    }
+    size_t written = configFile.write( reinterpret_cast<const uint8_t*>( content ), length );
+    configFile.close();
+    if( written != length ) {
+        LOG_ERROR( LOG_CONFIG, "ConfigControl::saveConfig: Failed to write config file." );
+        LittleFS.remove( CONFIG_TEMP_FILE );
+        markUpdated();
+        return;
+    }
+
+    // Replace the old configuration file in one atomic step
+    if( !LittleFS.rename( CONFIG_TEMP_FILE, CONFIG_FILE ) ) {
+        LOG_ERROR( LOG_CONFIG, "ConfigControl::saveConfig: Failed to replace config file." );
+        markUpdated();
         return;
     }
-    
-    // Safe io control data
-    configFile.printf( "%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n",
+    WriteCount++;
+    LOG_INFO( LOG_CONFIG, "ConfigControl::saveConfig: saved configuration to flash memory (write %u).", WriteCount );
+}
+
+/**
+ * @brief Flag the configuration as changed and restart the save quiet period.
+ */
+void ConfigControl::markUpdated(){
+    m_LastUpdate = millis();
+    if( !updated ) m_FirstUpdate = m_LastUpdate;
+    updated = true;
+}
+
+/**
+ * @brief Configure the flash memory settings.
+ * 
+ * @param command indicates which setting will be configured
+ * @param value the new value of the setting
+ * @return uint16 result code
+ */
+uint16 ConfigControl::configure( const ConfigCommand &command, const String &value ){
+    switch( command ){
+    case CONFIG_SAVE_DELAY:
+        if( value.toInt() < 1 ) return ERROR_CONFIG_SAVE_DELAY;
+        SaveDelay = value.toInt();
+        LOG_INFO( LOG_CONFIG, "ConfigControl::configure: Changed SaveDelay to: %u", SaveDelay );
+        break;
+    case CONFIG_EXPANDER_POLL:
+        if( value.toInt() < 1 ) return ERROR_CONFIG_EXPANDER_POLL;
+        ExpanderPoll = value.toInt();
+        LOG_INFO( LOG_CONFIG, "ConfigControl::configure: Changed ExpanderPoll to: %u", ExpanderPoll );
+        break;
+    case CONFIG_BRIDGE_FLUSH:
+        if( value.toInt() < 0 || value.toInt() > 1000 ) return ERROR_CONFIG_BRIDGE_FLUSH;
+        BridgeFlush = value.toInt();
+        LOG_INFO( LOG_CONFIG, "ConfigControl::configure: Changed BridgeFlush to: %u", BridgeFlush );
+        break;
+    case CONFIG_BRIDGE_STALL:
+        if( value.toInt() < 0 ) return ERROR_CONFIG_BRIDGE_STALL;
+        BridgeStall = value.toInt();
+        LOG_INFO( LOG_CONFIG, "ConfigControl::configure: Changed BridgeStall to: %u", BridgeStall );
+        break;
+    case CONFIG_FAST_BOOT:
+        if( value.equalsIgnoreCase( "on" ) || value == "1" ) FastBoot = true;
+        else if( value.equalsIgnoreCase( "off" ) || value == "0" ) FastBoot = false;
+        else return ERROR_CONFIG_FAST_BOOT;
+        LOG_INFO( LOG_CONFIG, "ConfigControl::configure: Changed FastBoot to: %s", FastBoot ? "on" : "off" );
+        break;
+    default:
+        return ERROR_CONFIG;
+    }
+    markUpdated();
+    return SUCCESS;
+}
+
+/**
+ * @brief Write the configuration file content into a buffer.
+ * 
+ * @param buffer output buffer for the file content
+ * @param size the size of the buffer
+ * @param writeCount the write counter value to store
+ * @return size_t length of the content, 0 if it didnt fit
+ */
+size_t ConfigControl::serializeConfig( char *buffer, size_t size, uint32 writeCount ){
+    int length = snprintf( buffer, size, 
+        "%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n"
+        "%s\n%s\n%s\n%s\n%s\n%d\n%d\n%s\n%s\n%d\n%d\n"
+        "%u\n%u\n%d\n"
+        "%d\n%s\n"
+        "%u\n%u\n%d\n"
+        "%u\n%u\n"
+        "%u\n%u\n%u\n%u\n%u\n%u\n%u\n%u\n%u\n",
+        // io control data
         pinData[PIN_DIG0].mode,
         pinData[PIN_DIG1].mode,
         pinData[PIN_DIG2].mode,
@@ -134,11 +331,8 @@ void ConfigControl::saveConfig(){
         pinData[PIN_DIG5].mode,
         pinData[PIN_DIG6].mode,
         pinData[PIN_DIG7].mode,
-        pinData[PIN_DIG8].mode 
-    );
-
-    // Safewifi control data
-    configFile.printf( "%s\n%s\n%s\n%s\n%s\n%d\n%d\n%s\n%s\n%d\n%d\n",
+        pinData[PIN_DIG8].mode,
+        // wifi control data
         SSID.c_str(),
         PWD.c_str(),
         StaticIP.toString().c_str(),
@@ -149,37 +343,97 @@ void ConfigControl::saveConfig(){
         DnsPrimary.toString().c_str(),
         DnsSecundary.toString().c_str(),
         MaxClients,
-        InActiveTimeout
+        InActiveTimeout,
+        // flash memory data
+        SaveDelay,
+        writeCount,
+        FastBoot,
+        // udp data
+        PortUDP,
+        MulticastGroup.toString().c_str(),
+        // tcp client limits
+        ClientRate,
+        ClientBandwidth,
+        // tcp admission policy
+        Admission,
+        // http connection reuse
+        HttpKeepAlive,
+        HttpMaxRequests,
+        // pulse input filters
+        pinData[PIN_DIG0].filter,
+        pinData[PIN_DIG1].filter,
+        pinData[PIN_DIG2].filter,
+        pinData[PIN_DIG3].filter,
+        pinData[PIN_DIG4].filter,
+        pinData[PIN_DIG5].filter,
+        pinData[PIN_DIG6].filter,
+        pinData[PIN_DIG7].filter,
+        pinData[PIN_DIG8].filter
     );
+    if( length < 0 || static_cast<size_t>( length ) >= size ) return 0;
 
-    // Done close the configuration file
-    configFile.close();
-    Serial.println("ConfigControl::saveConfig: saved configuration to flash memory.");
-    updated = false;
+    // port expanders
+    length += snprintf( buffer + length, size - length, "%u\n", ExpanderPoll );
+    for( EXPANDER_CONFIG &expander: Expanders ){
+        if( static_cast<size_t>( length ) >= size ) return 0;
+        length += snprintf( buffer + length, size - length, "%d %u %u %u %u\n",
+            expander.type, expander.address, expander.interrupt, expander.inputs, expander.outputs );
+    }
+
+    // sensors
+    for( SENSOR_CONFIG &sensor: Sensors ){
+        if( static_cast<size_t>( length ) >= size ) return 0;
+        length += snprintf( buffer + length, size - length, "%d %u %u\n", sensor.type, sensor.pin, sensor.interval );
+    }
+
+    // serial bridge
+    if( static_cast<size_t>( length ) >= size ) return 0;
+    length += snprintf( buffer + length, size - length, "%u %u %u %d\n%u %u\n",
+        BridgePort, BridgeBaud, BridgeFormat, BridgeSwap, BridgeFlush, BridgeStall );
+
+    // LED strip
+    if( static_cast<size_t>( length ) >= size ) return 0;
+    length += snprintf( buffer + length, size - length, "%u %u\n", PixelPin, PixelCount );
+    if( static_cast<size_t>( length ) >= size ) return 0;
+    return length;
 }
 
 /**
- * @brief Show the contents of the config file in the serial monitor
+ * @brief Compare content with the configuration file on the flash memory.
+ * 
+ * @param content the file content to compare
+ * @param length the length of the content
+ * @return true if the stored file is byte identical
  */
-void ConfigControl::printConfig(){
-    // check if the file exists, load default values if not available.
-    if (!LittleFS.exists(CONFIG_FILE)) {
-        Serial.println("ConfigControl::loadConfig: Configuration file not found.");
-        return;
-    }
-
-    // Open the configuration file for reading
+bool ConfigControl::isStored( const char *content, size_t length ){
     File configFile = LittleFS.open(CONFIG_FILE, "r"); 
-    if( !configFile ){
-        Serial.println("ConfigControl::loadConfig: Failed to open the configuraton file.");
+    if( !configFile ) return false;
+    if( configFile.size() != length ) {
         configFile.close();
-        return;
+        return false;
     }
 
-    Serial.println( configFile.readString() );
+    uint8_t chunk[64];
+    size_t offset = 0;
+    while( offset < length ) {
+        size_t count = configFile.read( chunk, sizeof( chunk ) );
+        if( !count || memcmp( chunk, content + offset, count ) != 0 ) break;
+        offset += count;
+    }
     configFile.close();
-    Serial.println("--------------------------------\nIn memory values:");
-    Serial.printf( "%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n",
+    return offset == length;
+}
+
+/**
+ * @brief Show the contents of the config file
+ * 
+ * @param out the output to print to
+ */
+void ConfigControl::printConfig( Print &out ){
+    if( !readConfig( out ) ) return;
+    out.println();
+    out.println("--------------------------------\nIn memory values:");
+    out.printf( "%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n",
         pinData[PIN_DIG0].mode,
         pinData[PIN_DIG1].mode,
         pinData[PIN_DIG2].mode,
@@ -192,7 +446,7 @@ void ConfigControl::printConfig(){
     );
 
     // Safewifi control data
-    Serial.printf( "%s\n%s\n%s\n%s\n%s\n%d\n%d\n%s\n%s\n%d\n%d\n",
+    out.printf( "%s\n%s\n%s\n%s\n%s\n%d\n%d\n%s\n%s\n%d\n%d\n",
         SSID.c_str(),
         PWD.c_str(),
         StaticIP.toString().c_str(),
@@ -205,27 +459,62 @@ void ConfigControl::printConfig(){
         MaxClients,
         InActiveTimeout
     );
+    out.printf( "Save delay: %u ms\nFlash writes: %u\nFast boot: %s\n", SaveDelay, WriteCount, FastBoot ? "on" : "off" );
+    out.printf( "UDP port: %u\nMulticast: %s\n", PortUDP, MulticastGroup.isSet() ? MulticastGroup.toString().c_str() : "off" );
+    out.printf( "Client rate: %u commands/s\nClient bandwidth: %u bytes/s\n", ClientRate, ClientBandwidth );
+    out.printf( "Admission: %s\n", Admission == ADMISSION_EVICT ? "evict" : "reject" );
+    out.printf( "HTTP keep-alive: %u ms\nHTTP max requests: %u\n", HttpKeepAlive, HttpMaxRequests );
+    for( PinId pin: { PIN_DIG0, PIN_DIG1, PIN_DIG2, PIN_DIG3, PIN_DIG4, PIN_DIG5, PIN_DIG6, PIN_DIG7, PIN_DIG8 } ){
+        if( pinData[pin].filter ) out.printf( "%s filter: %u us\n", pinData[pin].name.c_str(), pinData[pin].filter );
+    }
+    out.printf( "Expander poll: %u ms\n", ExpanderPoll );
+    for( uint i = 0; i < EXPANDER_COUNT; i++ ){
+        EXPANDER_CONFIG &expander = Expanders[i];
+        if( expander.type == EXPANDER_NONE ) continue;
+        out.printf( "Expander %u: %s ", i, expanderName( expander.type ) );
+        if( expander.type == EXPANDER_74HC595 ) out.printf( "latch %s", pinData[static_cast<PinId>( expander.address )].name.c_str() );
+        else out.printf( "0x%02X", expander.address );
+        if( expander.interrupt != EXPANDER_NO_PIN ) out.printf( " interrupt %s", pinData[static_cast<PinId>( expander.interrupt )].name.c_str() );
+        out.printf( ", inputs 0x%04X, outputs 0x%04X\n", expander.inputs, expander.outputs );
+    }
+    for( uint i = 0; i < SENSOR_COUNT; i++ ){
+        SENSOR_CONFIG &sensor = Sensors[i];
+        if( sensor.type == SENSOR_NONE ) continue;
+        out.printf( "Sensor %u: %s %s, interval %u ms\n", i, sensorName( sensor.type ), pinData[static_cast<PinId>( sensor.pin )].name.c_str(), sensor.interval );
+    }
+    if( BridgePort ) {
+        out.printf( "Bridge: port %u, %u baud %s%s\n", BridgePort, BridgeBaud, serialFormatName( BridgeFormat ).c_str(), BridgeSwap ? ", swapped" : "" );
+    } else {
+        out.println( "Bridge: off" );
+    }
+    out.printf( "Bridge flush: %u ms\nBridge stall: %u ms\n", BridgeFlush, BridgeStall );
+    if( PixelCount ) out.printf( "Pixels: %u on %s\n", PixelCount, pinData[static_cast<PinId>( PixelPin )].name.c_str() );
 }
 
 /**
- * @brief Read the contents of the config file as a string
+ * @brief Copy the contents of the config file to an output, a few bytes at a time.
+ * 
+ * @param out the output to print to
+ * @return true if the file has been copied, false if it could not be read
  */
-String ConfigControl::readConfig(){
+bool ConfigControl::readConfig( Print &out ){
     // check if the file exists, load default values if not available.
     if (!LittleFS.exists(CONFIG_FILE)) {
-        Serial.println("ConfigControl::loadConfig: Configuration file not found.");
-        return "Configuration file not found.";
+        LOG_WARN( LOG_CONFIG, "ConfigControl::readConfig: Configuration file not found." );
+        out.println( "Configuration file not found." );
+        return false;
     }
 
     // Open the configuration file for reading
     File configFile = LittleFS.open(CONFIG_FILE, "r"); 
     if( !configFile ){
-        Serial.println("ConfigControl::loadConfig: Failed to open the configuraton file.");
-        configFile.close();
-        return "Failed to open the configuraton file.";
+        LOG_ERROR( LOG_CONFIG, "ConfigControl::readConfig: Failed to open the configuraton file." );
+        out.println( "Failed to open the configuraton file." );
+        return false;
     }
 
-    String result = configFile.readString();
+    uint8_t buffer[64];
+    while( size_t length = configFile.read( buffer, sizeof( buffer ) ) ) out.write( buffer, length );
     configFile.close();
-    return result;
+    return true;
 }
\ No newline at end of file
@@ -0,0 +1,425 @@
+/**
+ * @file expandercontrol.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "expandercontrol.h"
+#include "logger.h"
+
+/**
+ * @brief The registers of the MCP23017 in bank 0, A and B are next to each other.
+ */
+#define MCP23017_IODIR 0x00
+#define MCP23017_GPIO 0x12
+#define MCP23017_OLAT 0x14
+
+/**
+ * @brief IOCON of the MCP23017: INTA and INTB mirrored, open drain interrupt output.
+ */
+#define MCP23017_IOCON 0x44
+
+/**
+ * @brief Construct a new Expander Control object
+ */
+ExpanderControl::ExpanderControl( ConfigControl *configControl, IOControl *ioControl, BusControl *busControl, Metrics *metrics )
+: m_ConfigControl( configControl )
+, m_IOControl( ioControl )
+, m_BusControl( busControl )
+, m_Metrics( metrics )
+{
+    for( Expander &expander: m_Expanders ) expander = (Expander){ false, false, false, 0, 0, 0 };
+}
+
+/**
+ * @brief Start the port expanders of the flash memory configuration.
+ * A chip that does not answer keeps its pins, update() tries to start it again.
+ */
+void ExpanderControl::load(){
+    for( uint slot = 0; slot < EXPANDER_COUNT; slot++ ){
+        if( m_ConfigControl->Expanders[slot].type == EXPANDER_NONE ) continue;
+        uint16 result = attach( slot );
+        if( result != SUCCESS ) {
+            LOG_ERROR( LOG_IO, "ExpanderControl::load: Expander %u can not be started: %04X", slot, result );
+            continue;
+        }
+        begin( slot );
+    }
+}
+
+/**
+ * @brief Execute a configuration command for a port expander: config expander SLOT TYPE [ADDRESS] [INTERRUPT_PIN].
+ * The pin directions are kept when the same chip is configured again. On an error the previous expander stays.
+ * 
+ * @param slot the number of the expander, 0 to EXPANDER_COUNT - 1
+ * @param type the chip, or none to remove the expander
+ * @param address the I2C address, or the latch pin of a 74HC595
+ * @param interrupt the pin of the interrupt line, empty for none
+ * @return uint16 result code
+ */
+uint16 ExpanderControl::configure( const String &slot, const String &type, const String &address, const String &interrupt ){
+    long number = slot.toInt();
+    if( number < 0 || number >= EXPANDER_COUNT || ( number == 0 && slot != "0" ) ) return ERROR_CONFIG_EXPANDER;
+    ExpanderType chip = parseExpanderType( type );
+    if( chip == EXPANDER_ERROR ) return ERROR_CONFIG_EXPANDER;
+
+    EXPANDER_CONFIG next = { chip, 0, EXPANDER_NO_PIN, 0, 0 };
+    if( chip == EXPANDER_74HC595 ) {
+        PinId latch = parsePinCommand( address );
+        if( latch > PIN_DIG8 || interrupt.length() ) return ERROR_CONFIG_EXPANDER;
+        next.address = latch;
+    } else if( chip != EXPANDER_NONE ) {
+        char *end = nullptr;
+        long value = address.length() ? strtol( address.c_str(), &end, 0 ) : 0x20;
+        if( ( end && *end ) || value < 0x08 || value > 0x77 ) return ERROR_CONFIG_EXPANDER;
+        next.address = value;
+        if( interrupt.length() ) {
+            PinId line = parsePinCommand( interrupt );
+            if( line > PIN_DIG8 ) return ERROR_CONFIG_EXPANDER;
+            next.interrupt = line;
+        }
+    }
+    for( uint i = 0; i < EXPANDER_COUNT; i++ ){
+        EXPANDER_CONFIG &other = m_ConfigControl->Expanders[i];
+        if( chip != EXPANDER_NONE && i != static_cast<uint>( number ) && other.type == chip && other.address == next.address ) return ERROR_CONFIG_EXPANDER;
+    }
+
+    EXPANDER_CONFIG previous = m_ConfigControl->Expanders[number];
+    if( previous.type == chip ) {
+        next.inputs = previous.inputs;
+        next.outputs = previous.outputs;
+    }
+    detach( number );
+    m_ConfigControl->Expanders[number] = next;
+    if( chip != EXPANDER_NONE ) {
+        uint16 result = attach( number );
+        if( result == SUCCESS ) result = begin( number );
+        if( result != SUCCESS ) {
+            detach( number );
+            m_ConfigControl->Expanders[number] = previous;
+            if( previous.type != EXPANDER_NONE && attach( number ) == SUCCESS ) begin( number );
+            return result;
+        }
+    }
+    m_ConfigControl->markUpdated();
+    LOG_INFO( LOG_IO, "ExpanderControl::configure: Expander %ld is %s 0x%02X", number, expanderName( chip ), next.address );
+    return SUCCESS;
+}
+
+/**
+ * @brief Configure a pin of a port expander as input or output, the directions are sent to the chip right away.
+ * 
+ * @param pin the pin to configure
+ * @param mode PIN_INPUT or PIN_OUTPUT, a 74HC595 only has outputs
+ * @return uint16 result code
+ */
+uint16 ExpanderControl::configurePin( const PinId &pin, const uint16 &mode ){
+    uint slot = ( pin - PIN_EXP0 ) / EXPANDER_PINS;
+    uint16 bit = 1 << ( ( pin - PIN_EXP0 ) % EXPANDER_PINS );
+    EXPANDER_CONFIG &config = m_ConfigControl->Expanders[slot];
+
+    if( mode == PIN_INPUT && config.type != EXPANDER_74HC595 ) {
+        config.inputs |= bit;
+        config.outputs &= ~bit;
+    } else if( mode == PIN_OUTPUT ) {
+        config.outputs |= bit;
+        config.inputs &= ~bit;
+    } else {
+        return PIN_ERROR | pin;
+    }
+    m_ConfigControl->pinData[pin].mode = static_cast<PinConfig>( mode );
+    m_ConfigControl->markUpdated();
+    if( m_Expanders[slot].active ) begin( slot );
+    LOG_DEBUG( LOG_IO, "ExpanderControl::configurePin: %s as %s", m_ConfigControl->pinData[pin].name.c_str(), mode == PIN_INPUT ? "INPUT" : "OUTPUT" );
+    return SUCCESS;
+}
+
+/**
+ * @brief Read a pin of a port expander from the cache, an output returns its written value.
+ * 
+ * @param pin the pin to read
+ * @param value output buffer for the value of the pin
+ * @return uint16 result code
+ */
+uint16 ExpanderControl::read( const PinId &pin, int &value ){
+    uint slot = ( pin - PIN_EXP0 ) / EXPANDER_PINS;
+    uint16 bit = 1 << ( ( pin - PIN_EXP0 ) % EXPANDER_PINS );
+    Expander &expander = m_Expanders[slot];
+
+    // The cache of a chip that does not answer is outdated
+    if( !expander.active ) return ERROR_READ | pin;
+    value = ( ( m_ConfigControl->Expanders[slot].outputs & bit ) ? expander.latch : expander.input ) & bit ? HIGH : LOW;
+    return SUCCESS;
+}
+
+/**
+ * @brief Check if a pin of a port expander is an output that can be written.
+ * 
+ * @return uint16 result code
+ */
+uint16 ExpanderControl::writable( const PinId &pin ){
+    if( m_ConfigControl->pinData[pin].mode != PIN_OUTPUT ) return ERROR_WRITE_MODE | pin;
+    return SUCCESS;
+}
+
+/**
+ * @brief Write an output pin of a port expander into the cache, update() sends it.
+ * 
+ * @param pin the pin to write, it has to be writable()
+ * @param value the digital value
+ */
+void ExpanderControl::write( const PinId &pin, int value ){
+    uint slot = ( pin - PIN_EXP0 ) / EXPANDER_PINS;
+    uint16 bit = 1 << ( ( pin - PIN_EXP0 ) % EXPANDER_PINS );
+    Expander &expander = m_Expanders[slot];
+    if( value ) expander.latch |= bit;
+    else expander.latch &= ~bit;
+    expander.dirty = true;
+}
+
+/**
+ * @brief Send the written outputs and refresh the inputs that are due, one bus transaction per chip each.
+ * A chip without interrupt line is read every ExpanderPoll ms, a chip with one only while the line is low.
+ * A chip that stopped answering is started again every EXPANDER_RETRY_INTERVAL ms.
+ * 
+ * @return uint16 result code
+ */
+uint16 ExpanderControl::update(){
+    uint16 result = SUCCESS;
+    unsigned long now = millis();
+    for( uint slot = 0; slot < EXPANDER_COUNT; slot++ ){
+        EXPANDER_CONFIG &config = m_ConfigControl->Expanders[slot];
+        Expander &expander = m_Expanders[slot];
+        if( !expander.attached ) continue;
+
+        if( !expander.active ) {
+            if( now - expander.lastPoll < EXPANDER_RETRY_INTERVAL ) continue;
+            expander.lastPoll = now;
+            uint16 started = begin( slot );
+            if( started != SUCCESS ) result = started;
+            continue;
+        }
+        if( expander.dirty ) {
+            uint16 flushed = flush( slot );
+            if( flushed != SUCCESS ) result = flushed;
+        }
+        if( !config.inputs || !expander.active ) continue;
+
+        bool due = config.interrupt != EXPANDER_NO_PIN
+            ? digitalRead( m_ConfigControl->pinData[static_cast<PinId>( config.interrupt )].gpio ) == LOW
+            : now - expander.lastPoll >= m_ConfigControl->ExpanderPoll;
+        if( !due ) continue;
+        expander.lastPoll = now;
+        uint16 refreshed = refresh( slot );
+        if( refreshed != SUCCESS ) result = refreshed;
+    }
+    return result;
+}
+
+/**
+ * @brief Open the bus of an expander, reserve its latch or interrupt pin and add its virtual pins.
+ * 
+ * @return uint16 result code
+ */
+uint16 ExpanderControl::attach( uint slot ){
+    EXPANDER_CONFIG &config = m_ConfigControl->Expanders[slot];
+    bool hasPin = config.type == EXPANDER_74HC595 || config.interrupt != EXPANDER_NO_PIN;
+    PinId pin = static_cast<PinId>( config.type == EXPANDER_74HC595 ? config.address : config.interrupt );
+    if( hasPin ) {
+        if( pin > PIN_DIG8 ) return ERROR_CONFIG_EXPANDER;
+        PinConfig mode = m_ConfigControl->pinData[pin].mode;
+        if( m_IOControl->reserved( pin ) || ( mode != PIN_NOT_SET && mode != PIN_INPUT ) ) return PIN_ERROR | pin;
+    }
+
+    uint16 result = config.type == EXPANDER_74HC595 ? m_BusControl->openSpi() : m_BusControl->openI2c();
+    if( result != SUCCESS ) return result;
+    if( hasPin ) {
+        uint8 gpio = m_ConfigControl->pinData[pin].gpio;
+        m_IOControl->reserve( pin, true );
+        if( config.type == EXPANDER_74HC595 ) {
+            pinMode( gpio, OUTPUT );
+            digitalWrite( gpio, LOW );
+        } else {
+            pinMode( gpio, INPUT_PULLUP );
+        }
+    }
+
+    for( uint i = 0; i < pinCount( config.type ); i++ ){
+        uint16 bit = 1 << i;
+        PinConfig mode = ( config.outputs & bit ) ? PIN_OUTPUT : ( config.inputs & bit ) ? PIN_INPUT : PIN_NOT_SET;
+        m_ConfigControl->pinData[static_cast<PinId>( PIN_EXP0 + slot * EXPANDER_PINS + i )] = (IO_PIN){ "E" + String( slot * EXPANDER_PINS + i ), static_cast<uint8_t>( i ), mode, 0, 0 };
+    }
+    m_Expanders[slot] = (Expander){ true, false, false, 0, 0, millis() };
+    return SUCCESS;
+}
+
+/**
+ * @brief Remove the virtual pins of an expander, release its pins and close its bus.
+ */
+void ExpanderControl::detach( uint slot ){
+    EXPANDER_CONFIG &config = m_ConfigControl->Expanders[slot];
+    Expander &expander = m_Expanders[slot];
+    if( !expander.attached ) return;
+
+    for( uint i = 0; i < EXPANDER_PINS; i++ ) m_ConfigControl->pinData.erase( static_cast<PinId>( PIN_EXP0 + slot * EXPANDER_PINS + i ) );
+    if( config.type == EXPANDER_74HC595 || config.interrupt != EXPANDER_NO_PIN ) {
+        PinId pin = static_cast<PinId>( config.type == EXPANDER_74HC595 ? config.address : config.interrupt );
+        pinMode( m_ConfigControl->pinData[pin].gpio, INPUT );
+        m_IOControl->reserve( pin, false );
+    }
+    if( config.type == EXPANDER_74HC595 ) m_BusControl->closeSpi();
+    else m_BusControl->closeI2c();
+    expander.attached = false;
+    expander.active = false;
+}
+
+/**
+ * @brief Configure the directions of the pins of a chip, write its outputs and read its inputs.
+ * An MCP23017 gets IODIR to IOCON and the pull-ups of the inputs in one transaction from register 0.
+ * 
+ * @return uint16 result code
+ */
+uint16 ExpanderControl::begin( uint slot ){
+    EXPANDER_CONFIG &config = m_ConfigControl->Expanders[slot];
+    Expander &expander = m_Expanders[slot];
+    expander.active = false;
+
+    uint16 result = SUCCESS;
+    if( config.type == EXPANDER_MCP23017 ) {
+        uint16 directions = ~config.outputs;
+        uint16 interrupts = config.interrupt != EXPANDER_NO_PIN ? config.inputs : 0;
+        const uint8 registers[] = {
+            MCP23017_IODIR,
+            static_cast<uint8>( directions ), static_cast<uint8>( directions >> 8 ),
+            0, 0,
+            static_cast<uint8>( interrupts ), static_cast<uint8>( interrupts >> 8 ),
+            0, 0,
+            0, 0,
+            MCP23017_IOCON, MCP23017_IOCON,
+            static_cast<uint8>( config.inputs ), static_cast<uint8>( config.inputs >> 8 )
+        };
+        result = transmit( config.address, registers, sizeof( registers ) );
+        if( result != SUCCESS ) m_Metrics->ExpanderErrors++;
+    }
+    if( result == SUCCESS ) result = flush( slot );
+    if( result == SUCCESS && config.type != EXPANDER_74HC595 ) result = refresh( slot );
+    if( result != SUCCESS ) {
+        LOG_DEBUG( LOG_IO, "ExpanderControl::begin: Expander %u does not answer: %04X", slot, result );
+        return result;
+    }
+    expander.active = true;
+    return SUCCESS;
+}
+
+/**
+ * @brief Send the outputs of a chip. The inputs of a PCF8574 are written high, so they can be pulled low.
+ * 
+ * @return uint16 result code
+ */
+uint16 ExpanderControl::flush( uint slot ){
+    EXPANDER_CONFIG &config = m_ConfigControl->Expanders[slot];
+    Expander &expander = m_Expanders[slot];
+    uint16 result = SUCCESS;
+
+    if( config.type == EXPANDER_MCP23017 ) {
+        const uint8 data[] = { MCP23017_OLAT, static_cast<uint8>( expander.latch ), static_cast<uint8>( expander.latch >> 8 ) };
+        result = transmit( config.address, data, sizeof( data ) );
+    } else if( config.type == EXPANDER_PCF8574 ) {
+        const uint8 data = ( expander.latch & config.outputs ) | ~config.outputs;
+        result = transmit( config.address, &data, 1 );
+    } else if( config.type == EXPANDER_74HC595 ) {
+        uint8 gpio = m_ConfigControl->pinData[static_cast<PinId>( config.address )].gpio;
+        SPI.beginTransaction( SPISettings( EXPANDER_SPI_CLOCK, MSBFIRST, SPI_MODE0 ) );
+        SPI.transfer( static_cast<uint8>( expander.latch ) );
+        SPI.endTransaction();
+        digitalWrite( gpio, HIGH );
+        digitalWrite( gpio, LOW );
+    }
+
+    if( result != SUCCESS ) {
+        m_Metrics->ExpanderErrors++;
+        if( expander.active ) LOG_WARN( LOG_IO, "ExpanderControl::flush: Expander %u does not answer: %04X", slot, result );
+        expander.active = false;
+        return result;
+    }
+    m_Metrics->ExpanderWrites++;
+    expander.dirty = false;
+    return SUCCESS;
+}
+
+/**
+ * @brief Read the inputs of a chip, an MCP23017 with a repeated start from GPIOA.
+ * 
+ * @return uint16 result code
+ */
+uint16 ExpanderControl::refresh( uint slot ){
+    EXPANDER_CONFIG &config = m_ConfigControl->Expanders[slot];
+    Expander &expander = m_Expanders[slot];
+    size_t length = config.type == EXPANDER_MCP23017 ? 2 : 1;
+    uint16 result = SUCCESS;
+
+    if( config.type == EXPANDER_MCP23017 ) {
+        Wire.beginTransmission( config.address );
+        Wire.write( MCP23017_GPIO );
+        uint8 error = Wire.endTransmission( false );
+        if( error ) result = ERROR_I2C_NACK | error;
+    }
+    if( result == SUCCESS && Wire.requestFrom( config.address, length, true ) != length ) result = ERROR_I2C_NACK | 2;
+
+    if( result != SUCCESS ) {
+        m_Metrics->ExpanderErrors++;
+        if( expander.active ) LOG_WARN( LOG_IO, "ExpanderControl::refresh: Expander %u does not answer: %04X", slot, result );
+        expander.active = false;
+        return result;
+    }
+    expander.input = Wire.read();
+    if( length == 2 ) expander.input |= Wire.read() << 8;
+    m_Metrics->ExpanderReads++;
+    return SUCCESS;
+}
+
+/**
+ * @brief Write bytes to an I2C chip in one transaction.
+ * 
+ * @return uint16 result code
+ */
+uint16 ExpanderControl::transmit( uint8 address, const uint8 *data, size_t length ){
+    Wire.beginTransmission( address );
+    Wire.write( data, length );
+    uint8 error = Wire.endTransmission();
+    return error ? ERROR_I2C_NACK | error : SUCCESS;
+}
+
+/**
+ * @brief Return the amount of pins of a chip.
+ */
+uint ExpanderControl::pinCount( ExpanderType type ){
+    switch( type ){
+    case EXPANDER_MCP23017: return 16;
+    case EXPANDER_PCF8574: return 8;
+    case EXPANDER_74HC595: return 8;
+    default: return 0;
+    }
+}
@@ -0,0 +1,466 @@
+/**
+ * @file httpserver.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "httpserver.h"
+#include "logger.h"
+
+/**
+ * @brief Return the reason phrase of a status code.
+ */
+static const char *reason( int code ){
+    switch( code ){
+    case 200: return "OK";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 413: return "Payload Too Large";
+    case 500: return "Internal Server Error";
+    default: return "";
+    }
+}
+
+/**
+ * @brief Return the value of a header line if it has the given name.
+ *
+ * @param line the header line, it ends with CRLF
+ * @param name the header name
+ * @return const char* the start of the value or nullptr if the name does not match
+ */
+static const char *headerValue( const char *line, const char *name ){
+    size_t length = strlen( name );
+    if( strncasecmp( line, name, length ) != 0 || line[length] != ':' ) return nullptr;
+    const char *value = line + length + 1;
+    while( *value == ' ' ) value++;
+    return value;
+}
+
+/**
+ * @brief Decode a form or query value, + is a space and %XX a reserved character.
+ */
+static String urlDecode( const char *text, size_t length ){
+    String decoded;
+    decoded.reserve( length );
+    for( size_t i = 0; i < length; i++ ){
+        if( text[i] == '+' ) {
+            decoded += ' ';
+        } else if( text[i] == '%' && i + 2 < length ) {
+            char hex[3] = { text[i + 1], text[i + 2], 0 };
+            decoded += static_cast<char>( strtol( hex, nullptr, 16 ) );
+            i += 2;
+        } else {
+            decoded += text[i];
+        }
+    }
+    return decoded;
+}
+
+/**
+ * @brief Construct a new Http Server object
+ *
+ * @param port the TCP port to listen on
+ * @param configControl instance pointer to the cofiguration control of the flash memory
+ * @param metrics instance pointer to the metrics counters
+ */
+HttpServer::HttpServer( uint16 port, ConfigControl *configControl, Metrics *metrics )
+: m_Server( port )
+, m_Current( nullptr )
+, m_Method( HTTP_METHOD_GET )
+, m_KeepAlive( false )
+, m_HeadersSent( false )
+, m_Chunked( false )
+, m_OutputLength( 0 )
+, m_Next( 0 )
+, m_ConfigControl( configControl )
+, m_Metrics( metrics )
+{
+    // The connections are never moved to a bigger buffer
+    m_Connections.reserve( HTTP_MAX_CONNECTIONS );
+}
+
+/**
+ * @brief Start listening.
+ */
+void HttpServer::begin(){
+    m_Server.begin();
+}
+
+/**
+ * @brief Register the handler of a path.
+ *
+ * @param uri the path without query
+ * @param method the method of the requests, HTTP_METHOD_ANY for all
+ * @param handler the handler that sends the response
+ */
+void HttpServer::on( const String &uri, HttpMethod method, Handler handler ){
+    m_Routes.push_back( { uri, method, handler } );
+}
+
+/**
+ * @brief Accept new connections, read the requests and handle the complete ones.
+ * The connections take turns, one request each, so a client that pipelines many requests does not hold up the others.
+ */
+void HttpServer::handleClient(){
+    if( m_Server.hasClient() ) accept();
+
+    // Collect the received data and remove the closed and timed out connections
+    for( size_t i = 0; i < m_Connections.size(); ){
+        if( receive( m_Connections[i] ) ) {
+            i++;
+            continue;
+        }
+        m_Connections[i].client.stop();
+        m_Connections.erase( m_Connections.begin() + i );
+    }
+
+    size_t count = m_Connections.size();
+    uint budget = HTTP_REQUESTS_PER_LOOP;
+    bool handled = true;
+    while( count && budget && handled ){
+        handled = false;
+        for( size_t n = 0; n < count && budget; n++ ){
+            Connection &connection = m_Connections[( m_Next + n ) % count];
+            if( connection.close ) continue;
+            size_t size = parseRequest( connection );
+            if( !size ) continue;
+
+            handleRequest( connection );
+            memmove( connection.buffer, connection.buffer + size, connection.length - size );
+            connection.length -= size;
+            connection.buffer[connection.length] = 0;
+            handled = true;
+            budget--;
+        }
+    }
+    if( count ) m_Next = ( m_Next + 1 ) % count;
+
+    // A connection is closed once its last response has been sent
+    for( size_t i = 0; i < m_Connections.size(); ){
+        if( !m_Connections[i].close ) {
+            i++;
+            continue;
+        }
+        m_Connections[i].client.stop();
+        m_Connections.erase( m_Connections.begin() + i );
+    }
+}
+
+/**
+ * @brief Accept a waiting connection, close the connection that has been idle the longest when all are in use.
+ * A connection that waits for its first request or has a request in progress is not closed,
+ * the new connection then waits in the backlog until a connection is free.
+ */
+void HttpServer::accept(){
+    if( m_Connections.size() >= HTTP_MAX_CONNECTIONS ) {
+        unsigned long now = millis();
+        auto idle = m_Connections.end();
+        for( auto connection = m_Connections.begin(); connection != m_Connections.end(); connection++ ){
+            if( connection->length || !connection->requests ) continue;
+            if( idle == m_Connections.end() || now - connection->lastActive > now - idle->lastActive ) idle = connection;
+        }
+        if( idle == m_Connections.end() ) return;
+        LOG_DEBUG( LOG_WIFI, "HttpServer::accept: Closing idle connection for a new one." );
+        idle->client.stop();
+        m_Connections.erase( idle );
+    }
+
+    m_Connections.emplace_back();
+    Connection &connection = m_Connections.back();
+    connection.client = m_Server.accept();
+    // The responses are buffered, pipelined responses must not wait for the acknowledgement of the previous one
+    connection.client.setNoDelay( true );
+    connection.connectTime = millis();
+    connection.lastActive = connection.connectTime;
+    m_Metrics->HttpConnections++;
+}
+
+/**
+ * @brief Read the data that has arrived without waiting, as far as the request buffer has room.
+ * A connection may wait HTTP_REQUEST_TIMEOUT for (the rest of) a request and
+ * ConfigControl::HttpKeepAlive for the next request once it has been answered.
+ *
+ * @return false if the connection is closed or timed out
+ */
+bool HttpServer::receive( Connection &connection ){
+    int available = connection.client.available();
+    if( available > 0 && connection.length < HTTP_REQUEST_SIZE ) {
+        int received = connection.client.read( reinterpret_cast<uint8_t*>( connection.buffer ) + connection.length,
+            std::min<size_t>( available, HTTP_REQUEST_SIZE - connection.length ) );
+        if( received > 0 ) {
+            connection.length += received;
+            connection.buffer[connection.length] = 0;
+            connection.lastActive = millis();
+            m_Metrics->countBytesIn( PROTOCOL_HTTP, received );
+        }
+    }
+    if( !connection.length && !connection.client.available() && !connection.client.connected() ) return false;
+
+    unsigned long idle = millis() - connection.lastActive;
+    if( connection.length || !connection.requests ) return idle < HTTP_REQUEST_TIMEOUT;
+    return idle < m_ConfigControl->HttpKeepAlive;
+}
+
+/**
+ * @brief Parse the request at the start of the buffer.
+ * A request that does not fit in the buffer or can not be parsed is answered with an error and closes the connection.
+ *
+ * @return size_t the size of the request, 0 if it is not complete yet
+ */
+size_t HttpServer::parseRequest( Connection &connection ){
+    char *end = strstr( connection.buffer, "\r\n\r\n" );
+    int error = 0;
+    if( !end && connection.length == HTTP_REQUEST_SIZE ) error = 413;
+    if( !end && !error ) return 0;
+
+    // GET /read?pin=D1 HTTP/1.1
+    char *lineEnd = end ? strstr( connection.buffer, "\r\n" ) : nullptr;
+    char *space = lineEnd ? static_cast<char*>( memchr( connection.buffer, ' ', lineEnd - connection.buffer ) ) : nullptr;
+    char *secondSpace = space ? static_cast<char*>( memchr( space + 1, ' ', lineEnd - space - 1 ) ) : nullptr;
+    if( !secondSpace && !error ) error = 400;
+
+    size_t contentLength = 0;
+    bool form = false;
+    bool close = false;
+    bool keepAlive = false;
+    for( char *line = lineEnd ? lineEnd + 2 : end; !error && line < end; ){
+        char *next = strstr( line, "\r\n" );
+        const char *value;
+        if( ( value = headerValue( line, "Content-Length" ) ) ) contentLength = strtoul( value, nullptr, 10 );
+        else if( ( value = headerValue( line, "Content-Type" ) ) ) form = strncasecmp( value, "application/x-www-form-urlencoded", 33 ) == 0;
+        else if( ( value = headerValue( line, "Connection" ) ) ) {
+            close = strncasecmp( value, "close", 5 ) == 0;
+            keepAlive = strncasecmp( value, "keep-alive", 10 ) == 0;
+        }
+        line = next + 2;
+    }
+
+    size_t headerSize = end ? end + 4 - connection.buffer : 0;
+    if( !error && headerSize + contentLength > HTTP_REQUEST_SIZE ) error = 413;
+    if( error ) {
+        LOG_WARN( LOG_WIFI, "HttpServer::parseRequest: Invalid request, answered with %d.", error );
+        m_Current = &connection;
+        m_KeepAlive = false;
+        m_HeadersSent = false;
+        send( error, "text/plain", 0 );
+        flushOutput();
+        m_Current = nullptr;
+        connection.close = true;
+        return 0;
+    }
+    if( connection.length < headerSize + contentLength ) return 0;
+
+    size_t methodLength = space - connection.buffer;
+    if( methodLength == 3 && strncmp( connection.buffer, "GET", 3 ) == 0 ) m_Method = HTTP_METHOD_GET;
+    else if( methodLength == 4 && strncmp( connection.buffer, "POST", 4 ) == 0 ) m_Method = HTTP_METHOD_POST;
+    else m_Method = HTTP_METHOD_OTHER;
+
+    char *target = space + 1;
+    char *query = static_cast<char*>( memchr( target, '?', secondSpace - target ) );
+    m_Uri = String();
+    m_Uri.concat( target, ( query ? query : secondSpace ) - target );
+    m_Args.clear();
+    if( query ) parseArguments( query + 1, secondSpace - query - 1 );
+    if( contentLength && form ) parseArguments( end + 4, contentLength );
+    else if( contentLength ) {
+        // A body that is not a form is passed as it is, like ESP8266WebServer does
+        m_Args.emplace_back( String( "plain" ), String() );
+        m_Args.back().second.concat( end + 4, contentLength );
+    }
+
+    // HTTP/1.1 keeps the connection unless the client closes it, HTTP/1.0 only when the client asks for it
+    bool http11 = strncmp( secondSpace + 1, "HTTP/1.1", 8 ) == 0;
+    m_KeepAlive = ( http11 ? !close : keepAlive ) && m_ConfigControl->HttpKeepAlive
+        && ( !m_ConfigControl->HttpMaxRequests || connection.requests + 1 < m_ConfigControl->HttpMaxRequests );
+    return headerSize + contentLength;
+}
+
+/**
+ * @brief Run the handler of the parsed request and end its response.
+ */
+void HttpServer::handleRequest( Connection &connection ){
+    m_Current = &connection;
+    m_HeadersSent = false;
+    m_Chunked = false;
+
+    Handler handler = m_NotFound;
+    for( const Route &route: m_Routes ){
+        if( route.uri == m_Uri && ( route.method == HTTP_METHOD_ANY || route.method == m_Method ) ) {
+            handler = route.handler;
+            break;
+        }
+    }
+    if( handler ) handler();
+
+    // Every request gets a response, otherwise the pipelined responses after it would not match their requests
+    if( !m_HeadersSent ) send( 500, "text/plain", 0 );
+    if( m_Chunked ) write( "0\r\n\r\n", 5 );
+    flushOutput();
+
+    connection.requests++;
+    connection.lastActive = millis();
+    if( !m_KeepAlive ) connection.close = true;
+    m_Metrics->HttpRequests++;
+    m_Current = nullptr;
+}
+
+/**
+ * @brief Parse the arguments of a query string or form body.
+ */
+void HttpServer::parseArguments( const char *text, size_t length ){
+    size_t start = 0;
+    while( start < length ){
+        const char *pair = text + start;
+        const char *separator = static_cast<const char*>( memchr( pair, '&', length - start ) );
+        size_t size = separator ? separator - pair : length - start;
+        const char *equals = static_cast<const char*>( memchr( pair, '=', size ) );
+        if( size ) {
+            if( equals ) m_Args.emplace_back( urlDecode( pair, equals - pair ), urlDecode( equals + 1, size - ( equals - pair ) - 1 ) );
+            else m_Args.emplace_back( urlDecode( pair, size ), String() );
+        }
+        start += size + 1;
+    }
+}
+
+String HttpServer::arg( int index ) const {
+    return index >= 0 && index < args() ? m_Args[index].second : String();
+}
+
+String HttpServer::argName( int index ) const {
+    return index >= 0 && index < args() ? m_Args[index].first : String();
+}
+
+String HttpServer::arg( const String &name ) const {
+    for( const auto &arg: m_Args ) if( arg.first == name ) return arg.second;
+    return String();
+}
+
+bool HttpServer::hasArg( const String &name ) const {
+    for( const auto &arg: m_Args ) if( arg.first == name ) return true;
+    return false;
+}
+
+/**
+ * @brief Send the status line and the headers of the response to the current request.
+ *
+ * @param code the HTTP status code
+ * @param contentType the content type of the response
+ * @param length the length of the content or HTTP_CONTENT_CHUNKED
+ */
+void HttpServer::send( int code, const char *contentType, size_t length ){
+    if( !m_Current || m_HeadersSent ) return;
+    m_Chunked = length == HTTP_CONTENT_CHUNKED;
+
+    char headers[256];
+    int size = snprintf( headers, sizeof( headers ), "HTTP/1.1 %d %s\r\nContent-Type: %s\r\n", code, reason( code ), contentType );
+    if( m_Chunked ) size += snprintf( headers + size, sizeof( headers ) - size, "Transfer-Encoding: chunked\r\n" );
+    else size += snprintf( headers + size, sizeof( headers ) - size, "Content-Length: %u\r\n", static_cast<uint>( length ) );
+    if( !m_KeepAlive ) {
+        size += snprintf( headers + size, sizeof( headers ) - size, "Connection: close\r\n\r\n" );
+    } else if( m_ConfigControl->HttpMaxRequests ) {
+        size += snprintf( headers + size, sizeof( headers ) - size, "Connection: keep-alive\r\nKeep-Alive: timeout=%u, max=%u\r\n\r\n",
+            m_ConfigControl->HttpKeepAlive / 1000, m_ConfigControl->HttpMaxRequests - m_Current->requests - 1 );
+    } else {
+        size += snprintf( headers + size, sizeof( headers ) - size, "Connection: keep-alive\r\nKeep-Alive: timeout=%u\r\n\r\n",
+            m_ConfigControl->HttpKeepAlive / 1000 );
+    }
+    write( headers, size );
+    m_HeadersSent = true;
+}
+
+/**
+ * @brief Send content of the response to the current request, as a chunk of a chunked response.
+ */
+void HttpServer::sendContent( const char *content, size_t size ){
+    if( !m_Current || !size ) return;
+    if( m_Chunked ) {
+        char length[12];
+        write( length, snprintf( length, sizeof( length ), "%X\r\n", static_cast<uint>( size ) ) );
+        write( content, size );
+        write( "\r\n", 2 );
+        return;
+    }
+    write( content, size );
+}
+
+/**
+ * @brief Write to the current connection through the output buffer,
+ * so the headers, the chunk framing and small contents go out in as few segments as possible.
+ */
+void HttpServer::write( const char *data, size_t size ){
+    if( m_OutputLength + size > sizeof( m_Output ) ) flushOutput();
+    if( size >= sizeof( m_Output ) ) {
+        m_Current->client.write( reinterpret_cast<const uint8_t*>( data ), size );
+        m_Metrics->countBytesOut( PROTOCOL_HTTP, size );
+        return;
+    }
+    memcpy( m_Output + m_OutputLength, data, size );
+    m_OutputLength += size;
+}
+
+/**
+ * @brief Send the content of the output buffer.
+ */
+void HttpServer::flushOutput(){
+    if( !m_OutputLength ) return;
+    m_Current->client.write( reinterpret_cast<const uint8_t*>( m_Output ), m_OutputLength );
+    m_Metrics->countBytesOut( PROTOCOL_HTTP, m_OutputLength );
+    m_OutputLength = 0;
+}
+
+/**
+ * @brief Send a file as response to the current request.
+ *
+ * @return size_t the amount of sent file bytes
+ */
+size_t HttpServer::streamFile( File &file, const char *contentType ){
+    send( 200, contentType, file.size() );
+    char buffer[256];
+    size_t sent = 0;
+    while( size_t length = file.read( reinterpret_cast<uint8_t*>( buffer ), sizeof( buffer ) ) ){
+        sendContent( buffer, length );
+        sent += length;
+    }
+    return sent;
+}
+
+/**
+ * @brief Print the open connections and the keep-alive settings.
+ *
+ * @param out the output to print to
+ */
+void HttpServer::printConnections( Print &out ){
+    uint32 connections = m_Metrics->HttpConnections;
+    out.printf( "HTTP connections: %u of %u, keep-alive: %u ms, max requests: %u, %u requests on %u connections (%u.%02u per connection)\n",
+        static_cast<uint>( m_Connections.size() ), HTTP_MAX_CONNECTIONS, m_ConfigControl->HttpKeepAlive, m_ConfigControl->HttpMaxRequests,
+        m_Metrics->HttpRequests, connections, connections ? m_Metrics->HttpRequests / connections : 0,
+        connections ? static_cast<uint>( ( m_Metrics->HttpRequests % connections ) * 100 / connections ) : 0 );
+    unsigned long now = millis();
+    for( Connection &connection: m_Connections ){
+        out.printf( "%s:%u connected %lu s, idle %lu ms, requests %u, queued %u B\n",
+            connection.client.remoteIP().toString().c_str(), connection.client.remotePort(), ( now - connection.connectTime ) / 1000,
+            now - connection.lastActive, connection.requests, static_cast<uint>( connection.length ) );
+    }
+}
@@ -27,12 +27,16 @@
  * SOFTWARE.
  */
 #include "iocontrol.h"
+#include "expandercontrol.h"
+#include "logger.h"
 
 /**
  * @brief Construct a new NodeMCU object
  */
 IOControl::IOControl( ConfigControl *configControl )
 : m_ConfigControl(configControl)
+, m_Reserved(0)
+, m_Expanders(nullptr)
 {
     
 }
@@ -48,45 +52,62 @@ void IOControl::reset(){
  * @brief Load the pin mode from the flash memory confiuration
  */
 void IOControl::load(){
-    configurePin( PIN_ANA0, m_ConfigControl->pinData[PIN_ANA0].mode );
-    configurePin( PIN_DIG0, m_ConfigControl->pinData[PIN_DIG0].mode );
-    configurePin( PIN_DIG1, m_ConfigControl->pinData[PIN_DIG1].mode );
-    configurePin( PIN_DIG2, m_ConfigControl->pinData[PIN_DIG2].mode );
-    configurePin( PIN_DIG3, m_ConfigControl->pinData[PIN_DIG3].mode );
-    configurePin( PIN_DIG4, m_ConfigControl->pinData[PIN_DIG4].mode );
-    configurePin( PIN_DIG5, m_ConfigControl->pinData[PIN_DIG5].mode );
-    configurePin( PIN_DIG6, m_ConfigControl->pinData[PIN_DIG6].mode );
-    configurePin( PIN_DIG7, m_ConfigControl->pinData[PIN_DIG7].mode );
-    configurePin( PIN_DIG8, m_ConfigControl->pinData[PIN_DIG8].mode );
+    configurePin( PIN_ANA0, m_ConfigControl->pinData[PIN_ANA0].mode, m_ConfigControl->pinData[PIN_ANA0].filter );
+    configurePin( PIN_DIG0, m_ConfigControl->pinData[PIN_DIG0].mode, m_ConfigControl->pinData[PIN_DIG0].filter );
+    configurePin( PIN_DIG1, m_ConfigControl->pinData[PIN_DIG1].mode, m_ConfigControl->pinData[PIN_DIG1].filter );
+    configurePin( PIN_DIG2, m_ConfigControl->pinData[PIN_DIG2].mode, m_ConfigControl->pinData[PIN_DIG2].filter );
+    configurePin( PIN_DIG3, m_ConfigControl->pinData[PIN_DIG3].mode, m_ConfigControl->pinData[PIN_DIG3].filter );
+    configurePin( PIN_DIG4, m_ConfigControl->pinData[PIN_DIG4].mode, m_ConfigControl->pinData[PIN_DIG4].filter );
+    configurePin( PIN_DIG5, m_ConfigControl->pinData[PIN_DIG5].mode, m_ConfigControl->pinData[PIN_DIG5].filter );
+    configurePin( PIN_DIG6, m_ConfigControl->pinData[PIN_DIG6].mode, m_ConfigControl->pinData[PIN_DIG6].filter );
+    configurePin( PIN_DIG7, m_ConfigControl->pinData[PIN_DIG7].mode, m_ConfigControl->pinData[PIN_DIG7].filter );
+    configurePin( PIN_DIG8, m_ConfigControl->pinData[PIN_DIG8].mode, m_ConfigControl->pinData[PIN_DIG8].filter );
     m_ConfigControl->updated = false;
 }
 
 /**
  * @brief Execute a configuration command for a pin on the board.
  * 
- * @param mode the direction of the pin
+ * @param mode the direction of the pin, or the measurement of a pulse input
  * @param pin the pin to configure
+ * @param filter the minimum time (in us) between two edges of a pulse input
  * @return result code 
  */
-uint16 IOControl::configurePin(const PinId &pin, const uint16 &mode){
+uint16 IOControl::configurePin(const PinId &pin, const uint16 &mode, uint32 filter){
     if( m_ConfigControl->pinData.count( pin ) == 0 ) return PIN_ERROR;
+    if( reserved( pin ) ) return PIN_ERROR | pin;
+    if( pin >= PIN_EXP0 ) return m_Expanders->configurePin( pin, mode );
+
+    // A pulse input needs an edge interrupt, A0 and D0 (GPIO16) have none
+    bool pulse = mode == PIN_COUNTER || mode == PIN_FREQUENCY || mode == PIN_PULSE_WIDTH;
+    if( pulse && ( pin == PIN_ANA0 || pin == PIN_DIG0 ) ) return PIN_ERROR | pin;
+    if( pin != PIN_ANA0 && mode != PIN_NOT_SET ) m_PulseInputs[pin].end();
 
     switch( mode ){
+    case PIN_COUNTER:
+    case PIN_FREQUENCY:
+    case PIN_PULSE_WIDTH:
+        pinMode( m_ConfigControl->pinData[pin].gpio, INPUT );
+        m_PulseInputs[pin].begin( m_ConfigControl->pinData[pin].gpio, static_cast<PinConfig>( mode ), filter );
+        m_ConfigControl->pinData[pin].mode = static_cast<PinConfig>( mode );
+        m_ConfigControl->pinData[pin].filter = filter;
+        LOG_DEBUG( LOG_IO, "IOControl::configurePin: %s (GPIO%d) as pulse input 0x%04X, filter %u us", m_ConfigControl->pinData[pin].name.c_str(), m_ConfigControl->pinData[pin].gpio, mode, filter );
+        break;
     case PIN_INPUT:
         pinMode( m_ConfigControl->pinData[pin].gpio, INPUT );
         m_ConfigControl->pinData[pin].mode = PIN_INPUT;
-        Serial.printf( "IOControl::configurePin: %s (GPIO%d) as INPUT\n", m_ConfigControl->pinData[pin].name.c_str(), m_ConfigControl->pinData[pin].gpio) ;
+        LOG_DEBUG( LOG_IO, "IOControl::configurePin: %s (GPIO%d) as INPUT", m_ConfigControl->pinData[pin].name.c_str(), m_ConfigControl->pinData[pin].gpio );
         break;
     case PIN_OUTPUT:
         pinMode( m_ConfigControl->pinData[pin].gpio, OUTPUT );
         m_ConfigControl->pinData[pin].mode = PIN_OUTPUT;
-        Serial.printf( "IOControl::configurePin: %s (GPIO%d) as OUTPUT\n", m_ConfigControl->pinData[pin].name.c_str(), m_ConfigControl->pinData[pin].gpio );
+        LOG_DEBUG( LOG_IO, "IOControl::configurePin: %s (GPIO%d) as OUTPUT", m_ConfigControl->pinData[pin].name.c_str(), m_ConfigControl->pinData[pin].gpio );
         break;
     case PIN_NOT_SET:
         return PIN_ERROR;
         break;
     }
-    m_ConfigControl->updated = true;
+    m_ConfigControl->markUpdated();
     return COMMAND_SUCCESS;
 }
 
@@ -95,14 +116,21 @@ uint16 IOControl::configurePin(const PinId &pin, const uint16 &mode){
  * 
  * @param pin th pin to read the value of
  * @param value output buffer for the value of the pin
+ * @param reset true to clear the counter of a pulse input in the same step
  * @return uint16 result code
  */
-uint16 IOControl::read(const PinId &pin, int &value){
+uint16 IOControl::read(const PinId &pin, int &value, bool reset){
     if( m_ConfigControl->pinData.count( pin ) == 0 ) return PIN_ERROR;
+    if( reserved( pin ) ) return ERROR_READ | pin;
 
-    value = pin == PIN_ANA0 ? analogRead( m_ConfigControl->pinData[pin].gpio ) : digitalRead( m_ConfigControl->pinData[pin].gpio );
+    if( pin >= PIN_EXP0 ) {
+        uint16 result = m_Expanders->read( pin, value );
+        if( result != SUCCESS ) return result;
+    }
+    else if( pin != PIN_ANA0 && m_PulseInputs[pin].active() ) value = m_PulseInputs[pin].read( reset );
+    else value = pin == PIN_ANA0 ? analogRead( m_ConfigControl->pinData[pin].gpio ) : digitalRead( m_ConfigControl->pinData[pin].gpio );
     m_ConfigControl->pinData[pin].value = value;
-    Serial.printf("IOControl::Read: %s (GPIO%d) = %d\n", m_ConfigControl->pinData[pin].name.c_str(), m_ConfigControl->pinData[pin].gpio, value);
+    LOG_DEBUG( LOG_IO, "IOControl::Read: %s (GPIO%d) = %d", m_ConfigControl->pinData[pin].name.c_str(), m_ConfigControl->pinData[pin].gpio, value );
     return COMMAND_SUCCESS;
 }
 
@@ -116,8 +144,83 @@ uint16 IOControl::read(const PinId &pin, int &value){
 uint16 IOControl::write(const PinId &pin, int value){
     if( m_ConfigControl->pinData.count( pin ) == 0 ) return PIN_ERROR;
     if( pin == PIN_ANA0 ) return PIN_ERROR | PIN_ANA0;
+    if( pin >= PIN_EXP0 ) {
+        uint16 result = m_Expanders->writable( pin );
+        if( result != SUCCESS ) return result;
+        m_Expanders->write( pin, value );
+        LOG_DEBUG( LOG_IO, "IOControl::Write: %s = %d", m_ConfigControl->pinData[pin].name.c_str(), value );
+        return COMMAND_SUCCESS;
+    }
+    if( m_PulseInputs[pin].active() || reserved( pin ) ) return ERROR_WRITE_MODE | pin;
 
     digitalWrite( m_ConfigControl->pinData[pin].gpio, value );
-    Serial.printf("IOControl::Write: %s (GPIO%d) = %d\n", m_ConfigControl->pinData[pin].name.c_str(), m_ConfigControl->pinData[pin].gpio, value);
+    LOG_DEBUG( LOG_IO, "IOControl::Write: %s (GPIO%d) = %d", m_ConfigControl->pinData[pin].name.c_str(), m_ConfigControl->pinData[pin].gpio, value );
     return COMMAND_SUCCESS;
+}
+
+/**
+ * @brief Execute a write command for several output pins at once, all of them or none.
+ * Every pin is checked against its configuration first, then GPIO0-15 are set with a single
+ * write of the GPIO output register and GPIO16 (D0) right after it, from its own register.
+ * 
+ * @param pins the pins to write the values to
+ * @param values the digital values to be written, one for every pin
+ * @return uint16 result code, errors of a pin contain its PinId
+ */
+uint16 IOControl::write(const std::vector<PinId> &pins, const std::vector<int> &values){
+    if( pins.empty() || pins.size() != values.size() ) return ERROR_WRITE;
+
+    // Validate every pin before anything is changed
+    uint32 mask = 0;
+    uint32 bits = 0;
+    int gpio16 = -1;
+    uint16 expanderMasks[EXPANDER_COUNT] = {};
+    for( uint i = 0; i < pins.size(); i++ ){
+        auto pin = m_ConfigControl->pinData.find( pins[i] );
+        if( pin == m_ConfigControl->pinData.end() ) return PIN_ERROR;
+        if( pins[i] == PIN_ANA0 ) return PIN_ERROR | PIN_ANA0;
+        if( pin->second.mode != PIN_OUTPUT || reserved( pins[i] ) ) return ERROR_WRITE_MODE | pins[i];
+        if( values[i] != LOW && values[i] != HIGH ) return ERROR_WRITE_VALUE | pins[i];
+
+        if( pins[i] >= PIN_EXP0 ) {
+            uint16 &expanderMask = expanderMasks[( pins[i] - PIN_EXP0 ) / EXPANDER_PINS];
+            uint16 bit = 1 << ( ( pins[i] - PIN_EXP0 ) % EXPANDER_PINS );
+            if( expanderMask & bit ) return ERROR_WRITE | pins[i];
+            expanderMask |= bit;
+            continue;
+        }
+        uint8 gpio = pin->second.gpio;
+        if( gpio == 16 ) {
+            if( gpio16 >= 0 ) return ERROR_WRITE | pins[i];
+            gpio16 = values[i];
+        } else {
+            if( mask & ( 1 << gpio ) ) return ERROR_WRITE | pins[i];
+            mask |= 1 << gpio;
+            if( values[i] ) bits |= 1 << gpio;
+        }
+    }
+
+    // Commit, the waveform and pulse interrupts change other bits of the registers and must not run in between
+    noInterrupts();
+    if( mask ) GPO = ( GPO & ~mask ) | bits;
+    if( gpio16 >= 0 ) GP16O = ( GP16O & ~1 ) | gpio16;
+    interrupts();
+    for( uint i = 0; i < pins.size(); i++ ){
+        if( pins[i] >= PIN_EXP0 ) m_Expanders->write( pins[i], values[i] );
+    }
+    LOG_DEBUG( LOG_IO, "IOControl::Write: %u pins, GPIO mask 0x%05X = 0x%05X", static_cast<uint>( pins.size() ), mask | ( gpio16 >= 0 ? 1 << 16 : 0 ), bits | ( gpio16 > 0 ? 1 << 16 : 0 ) );
+    return COMMAND_SUCCESS;
+}
+
+/**
+ * @brief Reserve a pin for a bus or release it, a reserved pin can not be configured, read or written.
+ * 
+ * @param pin the pin the bus uses
+ * @param reserved true to reserve the pin, false to release it
+ */
+void IOControl::reserve(const PinId &pin, bool reserved){
+    if( pin > PIN_DIG8 ) return;
+    if( reserved ) m_Reserved |= 1 << pin;
+    else m_Reserved &= ~( 1 << pin );
+    LOG_DEBUG( LOG_IO, "IOControl::reserve: %s %s", m_ConfigControl->pinData[pin].name.c_str(), reserved ? "reserved" : "released" );
 }
\ No newline at end of file
@@ -0,0 +1,200 @@
+/**
+ * @file logger.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "logger.h"
+#include <stdarg.h>
+
+/**
+ * @brief The names of the log modules as used by the log command.
+ */
+static const char *LOG_MODULE_NAMES[LOG_MODULE_COUNT] = {
+    "nodemcu",
+    "config",
+    "io",
+    "wifi",
+    "tcp"
+};
+
+/**
+ * @brief The names of the log levels as used by the log command.
+ */
+static const char *LOG_LEVEL_NAMES[LOG_LEVEL_DEBUG + 1] = {
+    "none",
+    "error",
+    "warn",
+    "info",
+    "debug"
+};
+
+/**
+ * @brief The prefix of a message of each log level.
+ */
+static const char *LOG_LEVEL_PREFIX[LOG_LEVEL_DEBUG + 1] = {
+    "",
+    "[E] ",
+    "[W] ",
+    "[I] ",
+    "[D] "
+};
+
+Logger Log;
+
+/**
+ * @brief Construct a new Logger object
+ */
+Logger::Logger()
+: Written( 0 )
+, Dropped( 0 )
+, Framed( false )
+, Output( &Serial )
+, m_Head( 0 )
+, m_Tail( 0 )
+{
+    for( uint i = 0; i < LOG_MODULE_COUNT; i++ ) m_Levels[i] = LOG_LEVEL;
+}
+
+/**
+ * @brief Format a message and add it to the ring buffer, a newline is appended.
+ * 
+ * @param level the level of the message
+ * @param format printf style format string
+ */
+void Logger::write( uint8 level, const char *format, ... ){
+    char line[LOG_LINE_SIZE];
+    size_t prefix = strlen( LOG_LEVEL_PREFIX[level] );
+    memcpy( line, LOG_LEVEL_PREFIX[level], prefix );
+
+    va_list args;
+    va_start( args, format );
+    int length = vsnprintf( line + prefix, sizeof( line ) - prefix - 1, format, args );
+    va_end( args );
+    if( length < 0 ) return;
+
+    // Truncated messages keep the room for the newline
+    size_t size = prefix + ( static_cast<size_t>( length ) < sizeof( line ) - prefix - 1 ? length : sizeof( line ) - prefix - 2 );
+    line[size++] = '\n';
+
+    // Drop the message when it doesnt fit, one byte is kept free to tell a full buffer from an empty one
+    size_t used = ( m_Head + LOG_BUFFER_SIZE - m_Tail ) % LOG_BUFFER_SIZE;
+    if( size > LOG_BUFFER_SIZE - 1 - used ) {
+        Dropped++;
+        return;
+    }
+
+    size_t first = LOG_BUFFER_SIZE - m_Head < size ? LOG_BUFFER_SIZE - m_Head : size;
+    memcpy( m_Buffer + m_Head, line, first );
+    memcpy( m_Buffer, line + first, size - first );
+    m_Head = ( m_Head + size ) % LOG_BUFFER_SIZE;
+    Written++;
+}
+
+/**
+ * @brief Send as much of the ring buffer to the serial port as fits without blocking.
+ * Without output the messages are dropped.
+ */
+void Logger::flush(){
+    if( Framed ) return;
+    if( !Output ) {
+        m_Tail = m_Head;
+        return;
+    }
+    int room = Output->availableForWrite();
+    while( room > 0 && m_Tail != m_Head ){
+        size_t available = m_Head > m_Tail ? m_Head - m_Tail : LOG_BUFFER_SIZE - m_Tail;
+        size_t count = available < static_cast<size_t>( room ) ? available : room;
+        Output->write( reinterpret_cast<const uint8_t*>( m_Buffer + m_Tail ), count );
+        m_Tail = ( m_Tail + count ) % LOG_BUFFER_SIZE;
+        room -= count;
+    }
+}
+
+/**
+ * @brief Send the complete ring buffer to the serial port, blocking until it is empty.
+ */
+void Logger::drain(){
+    while( !Framed && m_Tail != m_Head ){
+        flush();
+        yield();
+    }
+}
+
+/**
+ * @brief Take pending bytes out of the ring buffer, for outputs that frame the log themselves.
+ * 
+ * @param buffer output buffer for the bytes
+ * @param size the size of the buffer
+ * @return size_t amount of bytes taken
+ */
+size_t Logger::read( char *buffer, size_t size ){
+    size_t count = 0;
+    while( count < size && m_Tail != m_Head ){
+        size_t available = m_Head > m_Tail ? m_Head - m_Tail : LOG_BUFFER_SIZE - m_Tail;
+        size_t chunk = available < size - count ? available : size - count;
+        memcpy( buffer + count, m_Buffer + m_Tail, chunk );
+        m_Tail = ( m_Tail + chunk ) % LOG_BUFFER_SIZE;
+        count += chunk;
+    }
+    return count;
+}
+
+/**
+ * @brief Configure the log level of a module.
+ * 
+ * @param module the module name or "all"
+ * @param level the level name (none, error, warn, info, debug)
+ * @return true if the module and level are known
+ */
+bool Logger::configure( const String &module, const String &level ){
+    int value = -1;
+    for( uint i = 0; i <= LOG_LEVEL_DEBUG; i++ ){
+        if( level.equalsIgnoreCase( LOG_LEVEL_NAMES[i] ) ) value = i;
+    }
+    if( value < 0 ) return false;
+
+    bool found = false;
+    for( uint i = 0; i < LOG_MODULE_COUNT; i++ ){
+        if( module.equalsIgnoreCase( "all" ) || module.equalsIgnoreCase( LOG_MODULE_NAMES[i] ) ) {
+            m_Levels[i] = value;
+            found = true;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Print the level of every module and the message counters.
+ * 
+ * @param out the output to print to
+ */
+void Logger::print( Print &out ){
+    out.printf( "Logger: compiled level %s, %u written, %u dropped, %u bytes pending\n", LOG_LEVEL_NAMES[LOG_LEVEL],
+        Written, Dropped, static_cast<uint32>( ( m_Head + LOG_BUFFER_SIZE - m_Tail ) % LOG_BUFFER_SIZE ) );
+    for( uint i = 0; i < LOG_MODULE_COUNT; i++ ){
+        out.printf( "\t%s: %s\n", LOG_MODULE_NAMES[i], LOG_LEVEL_NAMES[m_Levels[i]] );
+    }
+}
@@ -0,0 +1,137 @@
+/**
+ * @file loopstats.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "loopstats.h"
+
+/**
+ * @brief The names of the loop stages as shown by the stats command.
+ */
+static const char *LOOP_STAGE_NAMES[STAGE_COUNT] = {
+    "serial",
+    "wifi",
+    "tcp",
+    "udp",
+    "http",
+    "expander",
+    "sensor",
+    "bridge",
+    "pixels",
+    "save",
+    "sampler",
+    "log"
+};
+
+/**
+ * @brief Construct a new Loop Stats object
+ */
+LoopStats::LoopStats(){
+    reset();
+}
+
+/**
+ * @brief Mark the start of a loop iteration.
+ * 
+ * @return uint32 the cycle count at the start, to pass to the first record call
+ */
+uint32 LoopStats::beginLoop(){
+    m_LoopStart = ESP.getCycleCount();
+    return m_LoopStart;
+}
+
+/**
+ * @brief Record the duration of a stage.
+ * 
+ * @param stage the stage that just finished
+ * @param start the cycle count at the start of the stage
+ * @return uint32 the current cycle count, which is the start of the next stage
+ */
+uint32 LoopStats::record( const LoopStage &stage, uint32 start ){
+    uint32 now = ESP.getCycleCount();
+    uint32 cycles = now - start;
+    uint32 us = cycles / ESP.getCpuFreqMHz();
+    uint bucket = us ? 32 - __builtin_clz( us ) : 0;
+    if( bucket >= LOOP_STATS_BUCKETS ) bucket = LOOP_STATS_BUCKETS - 1;
+
+    STAGE_STATS &stats = m_Stages[stage];
+    stats.count++;
+    stats.totalCycles += cycles;
+    if( cycles > stats.maxCycles ) stats.maxCycles = cycles;
+    stats.buckets[bucket]++;
+    return now;
+}
+
+/**
+ * @brief Mark the end of a loop iteration.
+ */
+void LoopStats::endLoop(){
+    uint32 cycles = ESP.getCycleCount() - m_LoopStart;
+    if( cycles > m_MaxLoopCycles ) m_MaxLoopCycles = cycles;
+    m_Loops++;
+}
+
+/**
+ * @brief Clear all the collected timing data.
+ */
+void LoopStats::reset(){
+    memset( m_Stages, 0, sizeof( m_Stages ) );
+    m_Loops = 0;
+    m_LoopStart = ESP.getCycleCount();
+    m_MaxLoopCycles = 0;
+    m_ResetTime = millis();
+}
+
+/**
+ * @brief Return the name of a stage as shown by the stats command.
+ */
+const char *LoopStats::stageName( const LoopStage &stage ){
+    return LOOP_STAGE_NAMES[stage];
+}
+
+/**
+ * @brief Print the loop frequency and the histogram of every stage.
+ * 
+ * @param out the output to print to
+ */
+void LoopStats::print( Print &out ){
+    uint32 mhz = ESP.getCpuFreqMHz();
+    unsigned long elapsed = millis() - m_ResetTime;
+    out.printf( "LoopStats: %u loops in %lu ms, %lu loops/s, max loop %u us\n",
+        m_Loops, elapsed, elapsed ? (unsigned long)( ( (uint64_t)m_Loops * 1000 ) / elapsed ) : 0, m_MaxLoopCycles / mhz );
+
+    for( uint i = 0; i < STAGE_COUNT; i++ ){
+        STAGE_STATS &stats = m_Stages[i];
+        out.printf( "\t%s: count %u, avg %u us, max %u us\n\t\t", LOOP_STAGE_NAMES[i], stats.count,
+            stats.count ? (uint32)( stats.totalCycles / stats.count / mhz ) : 0, stats.maxCycles / mhz );
+        for( uint b = 0; b < LOOP_STATS_BUCKETS; b++ ){
+            if( !stats.buckets[b] ) continue;
+            if( b == LOOP_STATS_BUCKETS - 1 ) out.printf( ">=%luus:%u ", 1UL << ( b - 1 ), stats.buckets[b] );
+            else out.printf( "<%luus:%u ", 1UL << b, stats.buckets[b] );
+        }
+        out.println();
+    }
+}
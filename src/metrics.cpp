@@ -0,0 +1,254 @@
+/**
+ * @file metrics.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "metrics.h"
+#include "logger.h"
+#include "sensorcontrol.h"
+
+/**
+ * @brief The protocol of each transport index.
+ */
+static const Protocol TRANSPORT_PROTOCOLS[TRANSPORT_COUNT] = {
+    PROTOCOL_SERIAL,
+    PROTOCOL_TCP,
+    PROTOCOL_HTTP,
+    PROTOCOL_UDP
+};
+
+/**
+ * @brief Construct a new Metrics object
+ * 
+ * @param configControl instance pointer to the cofiguration control of the flash memory
+ */
+Metrics::Metrics( ConfigControl *configControl )
+: TcpAccepted( 0 )
+, TcpTimeouts( 0 )
+, TcpRejected( 0 )
+, TcpEvicted( 0 )
+, HttpConnections( 0 )
+, HttpRequests( 0 )
+, TcpThrottled( 0 )
+, TcpDeferred( 0 )
+, TcpClients( 0 )
+, UdpPackets( 0 )
+, UdpDuplicates( 0 )
+, UdpInvalid( 0 )
+, ExpanderReads( 0 )
+, ExpanderWrites( 0 )
+, ExpanderErrors( 0 )
+, SensorReads( 0 )
+, SensorErrors( 0 )
+, BridgeUartIn( 0 )
+, BridgeUartOut( 0 )
+, BridgeDropped( 0 )
+, BridgeConnections( 0 )
+, PixelFrames( 0 )
+, PixelSkipped( 0 )
+, m_ConfigControl( configControl )
+, m_MinFreeHeap( ESP.getFreeHeap() )
+, m_Sensors( nullptr )
+{
+    memset( m_BytesIn, 0, sizeof( m_BytesIn ) );
+    memset( m_BytesOut, 0, sizeof( m_BytesOut ) );
+}
+
+/**
+ * @brief Count an executed command.
+ * 
+ * @param command the command that was executed
+ * @param protocol the protocol the command was received on
+ */
+void Metrics::countCommand( const Command &command, const Protocol &protocol ){
+    m_Commands[transport( protocol )][command]++;
+}
+
+/**
+ * @brief Count a result code.
+ * 
+ * @param code the result code
+ */
+void Metrics::countResult( uint16 code ){
+    m_Results[code]++;
+}
+
+/**
+ * @brief Count bytes received on a transport.
+ * 
+ * @param protocol the protocol the bytes were received on
+ * @param bytes amount of bytes
+ */
+void Metrics::countBytesIn( const Protocol &protocol, size_t bytes ){
+    m_BytesIn[transport( protocol )] += bytes;
+}
+
+/**
+ * @brief Count bytes sent on a transport.
+ * 
+ * @param protocol the protocol the bytes were sent on
+ * @param bytes amount of bytes
+ */
+void Metrics::countBytesOut( const Protocol &protocol, size_t bytes ){
+    m_BytesOut[transport( protocol )] += bytes;
+}
+
+/**
+ * @brief Sample the free heap to keep track of the lowest value.
+ */
+void Metrics::sampleHeap(){
+    uint32 freeHeap = ESP.getFreeHeap();
+    if( freeHeap < m_MinFreeHeap ) m_MinFreeHeap = freeHeap;
+}
+
+/**
+ * @brief Print all metrics in the Prometheus text exposition format.
+ * 
+ * @param out the output to print to
+ */
+void Metrics::printPrometheus( Print &out ){
+    out.println( "# TYPE nodemcu_commands_total counter" );
+    for( uint t = 0; t < TRANSPORT_COUNT; t++ ){
+        for( auto &entry: m_Commands[t] ){
+            out.printf( "nodemcu_commands_total{command=\"%s\",protocol=\"%s\"} %u\n",
+                commandName( static_cast<Command>( entry.first ) ), protocolName( TRANSPORT_PROTOCOLS[t] ), entry.second );
+        }
+    }
+
+    out.println( "# TYPE nodemcu_results_total counter" );
+    for( auto &entry: m_Results ){
+        out.printf( "nodemcu_results_total{code=\"0x%04X\"} %u\n", entry.first, entry.second );
+    }
+
+    out.println( "# TYPE nodemcu_received_bytes_total counter" );
+    for( uint t = 0; t < TRANSPORT_COUNT; t++ ){
+        out.printf( "nodemcu_received_bytes_total{protocol=\"%s\"} %u\n", protocolName( TRANSPORT_PROTOCOLS[t] ), m_BytesIn[t] );
+    }
+    out.println( "# TYPE nodemcu_sent_bytes_total counter" );
+    for( uint t = 0; t < TRANSPORT_COUNT; t++ ){
+        out.printf( "nodemcu_sent_bytes_total{protocol=\"%s\"} %u\n", protocolName( TRANSPORT_PROTOCOLS[t] ), m_BytesOut[t] );
+    }
+
+    out.printf( "# TYPE nodemcu_tcp_accepted_total counter\nnodemcu_tcp_accepted_total %u\n", TcpAccepted );
+    out.printf( "# TYPE nodemcu_tcp_timeouts_total counter\nnodemcu_tcp_timeouts_total %u\n", TcpTimeouts );
+    out.printf( "# TYPE nodemcu_tcp_rejected_total counter\nnodemcu_tcp_rejected_total %u\n", TcpRejected );
+    out.printf( "# TYPE nodemcu_tcp_evicted_total counter\nnodemcu_tcp_evicted_total %u\n", TcpEvicted );
+    out.printf( "# TYPE nodemcu_http_connections_total counter\nnodemcu_http_connections_total %u\n", HttpConnections );
+    out.printf( "# TYPE nodemcu_http_requests_total counter\nnodemcu_http_requests_total %u\n", HttpRequests );
+    out.printf( "# TYPE nodemcu_http_requests_per_connection gauge\nnodemcu_http_requests_per_connection %u.%02u\n",
+        HttpConnections ? HttpRequests / HttpConnections : 0, HttpConnections ? ( HttpRequests % HttpConnections ) * 100 / HttpConnections : 0 );
+    out.printf( "# TYPE nodemcu_tcp_throttled_total counter\nnodemcu_tcp_throttled_total %u\n", TcpThrottled );
+    out.printf( "# TYPE nodemcu_tcp_deferred_total counter\nnodemcu_tcp_deferred_total %u\n", TcpDeferred );
+    out.printf( "# TYPE nodemcu_tcp_clients gauge\nnodemcu_tcp_clients %u\n", TcpClients );
+    out.printf( "# TYPE nodemcu_udp_packets_total counter\nnodemcu_udp_packets_total %u\n", UdpPackets );
+    out.printf( "# TYPE nodemcu_udp_duplicates_total counter\nnodemcu_udp_duplicates_total %u\n", UdpDuplicates );
+    out.printf( "# TYPE nodemcu_udp_invalid_total counter\nnodemcu_udp_invalid_total %u\n", UdpInvalid );
+    out.printf( "# TYPE nodemcu_expander_reads_total counter\nnodemcu_expander_reads_total %u\n", ExpanderReads );
+    out.printf( "# TYPE nodemcu_expander_writes_total counter\nnodemcu_expander_writes_total %u\n", ExpanderWrites );
+    out.printf( "# TYPE nodemcu_expander_errors_total counter\nnodemcu_expander_errors_total %u\n", ExpanderErrors );
+    out.printf( "# TYPE nodemcu_sensor_reads_total counter\nnodemcu_sensor_reads_total %u\n", SensorReads );
+    out.printf( "# TYPE nodemcu_sensor_errors_total counter\nnodemcu_sensor_errors_total %u\n", SensorErrors );
+    if( m_Sensors ) m_Sensors->printPrometheus( out );
+    out.printf( "# TYPE nodemcu_bridge_uart_in_bytes_total counter\nnodemcu_bridge_uart_in_bytes_total %u\n", BridgeUartIn );
+    out.printf( "# TYPE nodemcu_bridge_uart_out_bytes_total counter\nnodemcu_bridge_uart_out_bytes_total %u\n", BridgeUartOut );
+    out.printf( "# TYPE nodemcu_bridge_dropped_bytes_total counter\nnodemcu_bridge_dropped_bytes_total %u\n", BridgeDropped );
+    out.printf( "# TYPE nodemcu_bridge_connections_total counter\nnodemcu_bridge_connections_total %u\n", BridgeConnections );
+    out.printf( "# TYPE nodemcu_pixel_frames_total counter\nnodemcu_pixel_frames_total %u\n", PixelFrames );
+    out.printf( "# TYPE nodemcu_pixel_skipped_total counter\nnodemcu_pixel_skipped_total %u\n", PixelSkipped );
+    out.printf( "# TYPE nodemcu_heap_free_bytes gauge\nnodemcu_heap_free_bytes %u\n", ESP.getFreeHeap() );
+    out.printf( "# TYPE nodemcu_heap_free_min_bytes gauge\nnodemcu_heap_free_min_bytes %u\n", m_MinFreeHeap );
+    out.printf( "# TYPE nodemcu_heap_max_block_bytes gauge\nnodemcu_heap_max_block_bytes %u\n", ESP.getMaxFreeBlockSize() );
+    out.printf( "# TYPE nodemcu_heap_fragmentation_percent gauge\nnodemcu_heap_fragmentation_percent %u\n", ESP.getHeapFragmentation() );
+    out.printf( "# TYPE nodemcu_config_writes_total counter\nnodemcu_config_writes_total %u\n", m_ConfigControl->WriteCount );
+    out.printf( "# TYPE nodemcu_log_dropped_total counter\nnodemcu_log_dropped_total %u\n", Log.Dropped );
+    out.printf( "# TYPE nodemcu_uptime_seconds counter\nnodemcu_uptime_seconds %lu\n", millis() / 1000 );
+}
+
+/**
+ * @brief Print all metrics as a single line of space separated key=value pairs.
+ * 
+ * @param out the output to print to
+ */
+void Metrics::printCompact( Print &out ){
+    for( uint t = 0; t < TRANSPORT_COUNT; t++ ){
+        for( auto &entry: m_Commands[t] ){
+            out.printf( "cmd.%s.%s=%u ", commandName( static_cast<Command>( entry.first ) ), protocolName( TRANSPORT_PROTOCOLS[t] ), entry.second );
+        }
+    }
+    for( auto &entry: m_Results ){
+        out.printf( "res.%04X=%u ", entry.first, entry.second );
+    }
+    for( uint t = 0; t < TRANSPORT_COUNT; t++ ){
+        out.printf( "rx.%s=%u tx.%s=%u ", protocolName( TRANSPORT_PROTOCOLS[t] ), m_BytesIn[t], protocolName( TRANSPORT_PROTOCOLS[t] ), m_BytesOut[t] );
+    }
+    if( m_Sensors ) m_Sensors->printCompact( out );
+    out.printf( "tcp.accepted=%u tcp.timeouts=%u tcp.rejected=%u tcp.evicted=%u http.connections=%u http.requests=%u tcp.throttled=%u tcp.deferred=%u tcp.clients=%u udp.packets=%u udp.duplicates=%u udp.invalid=%u expander.reads=%u expander.writes=%u expander.errors=%u sensor.reads=%u sensor.errors=%u bridge.uart_in=%u bridge.uart_out=%u bridge.dropped=%u bridge.connections=%u pixel.frames=%u pixel.skipped=%u heap.free=%u heap.min=%u heap.block=%u heap.frag=%u config.writes=%u log.dropped=%u uptime=%lu\n",
+        TcpAccepted, TcpTimeouts, TcpRejected, TcpEvicted, HttpConnections, HttpRequests, TcpThrottled, TcpDeferred, TcpClients, UdpPackets, UdpDuplicates, UdpInvalid, ExpanderReads, ExpanderWrites, ExpanderErrors, SensorReads, SensorErrors, BridgeUartIn, BridgeUartOut, BridgeDropped, BridgeConnections, PixelFrames, PixelSkipped, ESP.getFreeHeap(), m_MinFreeHeap, ESP.getMaxFreeBlockSize(), ESP.getHeapFragmentation(),
+        m_ConfigControl->WriteCount, Log.Dropped, millis() / 1000 );
+}
+
+/**
+ * @brief Convert a protocol to its transport index.
+ * 
+ * @param protocol the protocol
+ * @return Transport the index in the per transport counters
+ */
+Transport Metrics::transport( const Protocol &protocol ){
+    switch( protocol ){
+    case PROTOCOL_TCP: return TRANSPORT_TCP;
+    case PROTOCOL_HTTP: return TRANSPORT_HTTP;
+    case PROTOCOL_UDP: return TRANSPORT_UDP;
+    default: return TRANSPORT_SERIAL;
+    }
+}
+
+/**
+ * @brief Construct a new Metered Print object
+ * 
+ * @param out the output to forward to
+ * @param metrics the metrics to count the bytes in
+ * @param protocol the protocol the output belongs to
+ */
+MeteredPrint::MeteredPrint( Print &out, Metrics *metrics, const Protocol &protocol )
+: m_Out( out )
+, m_Metrics( metrics )
+, m_Protocol( protocol )
+, m_Written( 0 )
+{}
+
+size_t MeteredPrint::write( uint8_t c ){
+    size_t written = m_Out.write( c );
+    m_Metrics->countBytesOut( m_Protocol, written );
+    m_Written += written;
+    return written;
+}
+
+size_t MeteredPrint::write( const uint8_t *buffer, size_t size ){
+    size_t written = m_Out.write( buffer, size );
+    m_Metrics->countBytesOut( m_Protocol, written );
+    m_Written += written;
+    return written;
+}
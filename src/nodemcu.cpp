@@ -27,17 +27,36 @@
  * SOFTWARE.
  */
 #include "nodemcu.h"
+#if __has_include( "config.h" )
 #include "config.h"
+#endif
+#include "logger.h"
 #include <vector>
 
 /**
  * @brief Construct a new NodeMCU object.
  */
 NodeMCU::NodeMCU( const uint &baudRate ){
+    // Serial ready runs from power up to the first handled serial loop
+    m_BootStats.begin( BOOT_SERIAL_READY );
     Serial.begin(baudRate);
+    m_BootStats.begin( BOOT_FS_MOUNT );
     m_ConfigControl = new ConfigControl();
+    m_BootStats.end( BOOT_FS_MOUNT );
     m_IOControl = new IOControl( m_ConfigControl );
-    m_Server = new WifiControl( this, m_ConfigControl );
+    m_BusControl = new BusControl( m_ConfigControl, m_IOControl );
+    m_Metrics = new Metrics( m_ConfigControl );
+    m_ExpanderControl = new ExpanderControl( m_ConfigControl, m_IOControl, m_BusControl, m_Metrics );
+    m_IOControl->setExpanders( m_ExpanderControl );
+    m_SensorControl = new SensorControl( m_ConfigControl, m_IOControl, m_Metrics );
+    m_Metrics->setSensors( m_SensorControl );
+    m_PixelControl = new PixelControl( m_ConfigControl, m_IOControl, m_Metrics );
+    m_Server = new WifiControl( this, m_ConfigControl, m_Metrics );
+    m_SerialLink = new SerialLink( this, m_Metrics, baudRate );
+    m_BridgeControl = new BridgeControl( m_ConfigControl, m_IOControl, m_SerialLink, m_Metrics );
+    m_Scheduler = new Scheduler( &m_LoopStats, m_Metrics );
+    m_WifiConnected = false;
+    setup_tasks();
 }
 
 /**
@@ -51,74 +70,148 @@ NodeMCU::~NodeMCU(){}
 void NodeMCU::run(){
     // Load configuration en setup pins
     if( !m_ConfigControl->loaded ){
+        // Load config first, it tells if this is a fast boot
+        m_BootStats.begin( BOOT_LOAD_CONFIG );
+        m_ConfigControl->loadConfig();
+        m_BootStats.end( BOOT_LOAD_CONFIG );
+
         // Print the files that are loaded into the flash memory to check if upload was succesfull. 
-        Serial.println("\nNodeMCU::run: Listing files in flash memory:");
-        Dir dir = LittleFS.openDir("/");
-        while (dir.next()) {
-            Serial.print("\tFile: ");
-            Serial.println(dir.fileName());
+        if( !m_ConfigControl->FastBoot ){
+            m_BootStats.begin( BOOT_LIST_FILES );
+            LOG_INFO( LOG_NODEMCU, "NodeMCU::run: Listing files in flash memory:" );
+            Dir dir = LittleFS.openDir("/");
+            while (dir.next()) {
+                LOG_INFO( LOG_NODEMCU, "\tFile: %s", dir.fileName().c_str() );
+            }
+            m_BootStats.end( BOOT_LIST_FILES );
         }
 
-        // Load config and pins
-        m_ConfigControl->loadConfig();
+        // Setup pins
+        m_BootStats.begin( BOOT_LOAD_PINS );
         m_IOControl->load();
+        m_ExpanderControl->load();
+        m_SensorControl->load();
+        m_BridgeControl->load();
+        m_PixelControl->load();
+        m_BootStats.end( BOOT_LOAD_PINS );
     } 
 
-    // Execute serial communication
-    uint16 result = handle_serial();
-    handle_error( result );    
-
-    result = m_Server->connect();
-    handle_error( result );
-
-    // Only handle TCP and HTTP when connected to wifi
-    if( result == SUCCESS ){
-        // Execute TCP communication
-        result = m_Server->updateTcpServer();
-        handle_error( result );
-        
-        // Execute HTTP communication and control panel
-        result = m_Server->updateHttpSerer();
-        handle_error( result );
-    }
-
-    // Save configuration if an update has occured
-    m_ConfigControl->saveConfig();
+    m_Scheduler->run();
 }
 
 /**
- * @brief The main error handling method
+ * @brief Register the tasks of the main loop.
+ * Serial, TCP, UDP and the serial bridge are urgent and run in every loop iteration. The wifi connection is checked
+ * periodically, TCP, UDP and HTTP are only handled while it is connected. Saving the configuration,
+ * sampling the heap and sending the log run in the background.
  */
-void NodeMCU::handle_error(uint16 errorCode){
+void NodeMCU::setup_tasks(){
+    // Execute serial communication
+    m_Scheduler->add( STAGE_SERIAL, PRIORITY_URGENT, 0, 500, [ this ]() -> uint16 { return handle_serial(); } );
+
+    // Execute TCP communication
+    m_Scheduler->add( STAGE_TCP, PRIORITY_URGENT, 0, 2000, [ this ]() -> uint16 {
+        if( !m_WifiConnected ) return SUCCESS;
+        m_BootStats.begin( BOOT_TCP_START );
+        uint16 result = m_Server->updateTcpServer();
+        m_BootStats.end( BOOT_TCP_START );
+        return result;
+    });
+
+    // Execute the UDP fast path
+    m_Scheduler->add( STAGE_UDP, PRIORITY_URGENT, 0, 1000, [ this ]() -> uint16 {
+        if( !m_WifiConnected ) return SUCCESS;
+        return m_Server->updateUdpServer();
+    });
+
+    // Move the bytes of the serial bridge, a serial command that switches the bridge has sent its reply by now
+    m_Scheduler->add( STAGE_BRIDGE, PRIORITY_URGENT, 0, 1000, [ this ]() -> uint16 {
+        return m_BridgeControl->update( m_WifiConnected );
+    });
+
+    // Only handle TCP, UDP and HTTP when connected to wifi
+    m_Scheduler->add( STAGE_WIFI, PRIORITY_NORMAL, 100, 1000, [ this ]() -> uint16 {
+        m_BootStats.begin( BOOT_WIFI_CONNECT );
+        uint16 result = m_Server->connect();
+        m_WifiConnected = result == SUCCESS;
+        if( m_WifiConnected ) m_BootStats.end( BOOT_WIFI_CONNECT );
+        return result;
+    });
+
+    // Execute HTTP communication and control panel
+    m_Scheduler->add( STAGE_HTTP, PRIORITY_NORMAL, 0, 5000, [ this ]() -> uint16 {
+        if( !m_WifiConnected ) return SUCCESS;
+        m_BootStats.begin( BOOT_HTTP_START );
+        uint16 result = m_Server->updateHttpSerer();
+        m_BootStats.end( BOOT_HTTP_START );
+        return result;
+    });
+
+    // Send the coalesced port expander writes and refresh their inputs, after every stage that executes commands
+    m_Scheduler->add( STAGE_EXPANDER, PRIORITY_NORMAL, 0, 2000, [ this ]() -> uint16 {
+        return m_ExpanderControl->update();
+    });
+
+    // Step the sensor measurements, a step is at most one 1-Wire byte or one DHT answer (about 5 ms)
+    m_Scheduler->add( STAGE_SENSOR, PRIORITY_NORMAL, 0, 6000, [ this ]() -> uint16 {
+        return m_SensorControl->update();
+    });
+
+    // Send the shown LED frame, UART1 takes about 30 us per pixel (9 ms for 300) with the interrupts on
+    m_Scheduler->add( STAGE_PIXELS, PRIORITY_NORMAL, 0, 10000, [ this ]() -> uint16 {
+        return m_PixelControl->update();
+    });
+
+    // Save configuration if an update has occured, a few ms later than the save delay does not matter
+    m_Scheduler->add( STAGE_SAVE, PRIORITY_BACKGROUND, 10, 50000, [ this ]() -> uint16 {
+        m_ConfigControl->saveConfig();
+        return SUCCESS;
+    });
 
+    m_Scheduler->add( STAGE_SAMPLER, PRIORITY_BACKGROUND, 10, 100, [ this ]() -> uint16 {
+        m_Metrics->sampleHeap();
+        return SUCCESS;
+    });
+
+    // Send buffered log messages as far as the UART has room for them
+    m_Scheduler->add( STAGE_LOG, PRIORITY_BACKGROUND, 0, 1000, [ this ]() -> uint16 {
+        Log.flush();
+        m_SerialLink->flushLog();
+        return SUCCESS;
+    });
 }
 
 /**
  * @brief Read serial data if available and save the command.
- * When this function is called it will only handle command line.
+ * When this function is called it will only handle command line, bytes are collected
+ * without waiting and a command is executed once its line is complete.
  * The NodeMCU supports multiple communication protocols but serial will always be available.
  * 
  * @return result code
  */
 uint16 NodeMCU::handle_serial(){
     std::vector<String> command;
+    m_BootStats.end( BOOT_SERIAL_READY );
 
-    if ( Serial.available() > 0 ){
-        String input = Serial.readStringUntil('\n');
-
-        while( input.length() > 0 ) {
-            int spaceIndex = input.indexOf(' ');
-            if( spaceIndex == -1 ) {
-                input.trim();
-                command.push_back( input );
-                input = "";
-            } else {
-                command.push_back( input.substring( 0, spaceIndex ) );
-                input = input.substring( spaceIndex + 1 );
-            }
-        }
+    // The serial bridge has the UART
+    if( m_BridgeControl->active() ) return SUCCESS;
+
+    // In binary mode the serial link reads and executes the command frames
+    m_SerialLink->applyMode();
+    if( m_SerialLink->isBinary() ) return m_SerialLink->update();
+
+    // Collect the bytes that have arrived, a command is only returned once its line is complete
+    uint16 result = m_SerialLink->readLine( command );
+
+    // The command result is counted by execute_command, only serial errors are returned
+    if( command.size() ) {
+        // Replies share the UART with the log, send pending messages first so lines dont get mixed
+        Log.drain();
+        MeteredPrint reply( Serial, m_Metrics, PROTOCOL_SERIAL );
+        reply.printf( "=%04X\n", execute_command( command, PROTOCOL_SERIAL, reply ) );
+        m_SerialLink->applyMode();
     }
-    return command.size() ? execute_command( command ) : FAILED;
+    return result;
 }
 
 /**
@@ -126,53 +219,143 @@ uint16 NodeMCU::handle_serial(){
  * 
  * @return uint16 result code
  */
-uint16 NodeMCU::execute_command( const std::vector<String> &command ){
+uint16 NodeMCU::execute_command( const std::vector<String> &command, const Protocol &protocol, Print &out ){
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+    if( Log.enabled( LOG_NODEMCU, LOG_LEVEL_DEBUG ) ){
+        String line;
+        for(const String &arg: command){
+            line += arg;
+            line += " ";
+        }
+        Log.write( LOG_LEVEL_DEBUG, "NodeMCU::execute_command: %s", line.c_str() );
+    }
+#endif
+
+    // Count the command and its result
+    m_Metrics->countCommand( parseCommand( command[0] ), protocol );
+    uint16 result = dispatch_command( command, out );
+    m_Metrics->countResult( result );
+    return result;
+}
+
+/**
+ * @brief Execute a binary pixel upload, it is counted as a pixels command.
+ * 
+ * @return uint16 result code
+ */
+uint16 NodeMCU::execute_pixels( const uint8_t *data, size_t length, bool show, const Protocol &protocol ){
+    m_Metrics->countCommand( COMMAND_PIXELS, protocol );
+    uint16 result = m_PixelControl->upload( data, length, show );
+    m_Metrics->countResult( result );
+    return result;
+}
+
+/**
+ * @brief Run the command that has been received.
+ * 
+ * @return uint16 result code
+ */
+uint16 NodeMCU::dispatch_command( const std::vector<String> &command, Print &out ){
     uint16 result = SUCCESS;
     int buffer;
 
-    Serial.printf("NodeMCU::execute_command: ");
-        for(String arg: command){
-            Serial.printf(arg.c_str());
-            Serial.printf(" ");
-        }
-        Serial.println();
-
     switch( parseCommand( command[0] ) ){
     case COMMAND_RESET: 
         m_IOControl->reset(); 
         break;
     case COMMAND_CONFIG: 
         if( command.size() < 2 ) return ERROR_CONFIG;
-        result = configure( command ); 
+        result = configure( command, out ); 
         break;
     case COMMAND_READ: 
         if( command.size() < 2 ) return ERROR_READ;
-        result = m_IOControl->read(  parsePinCommand( command[1] ), buffer ); 
+        result = m_IOControl->read(  parsePinCommand( command[1] ), buffer, command.size() > 2 && command[2].equalsIgnoreCase( "reset" ) ); 
+        if( result == SUCCESS ) out.println( buffer );
         break;
     case COMMAND_WRITE: 
+        if( command.size() >= 2 && command[1].indexOf( '=' ) > 0 ) return write_pins( command );
         if( command.size() < 3 ) return ERROR_WRITE;
         result = m_IOControl->write(  parsePinCommand( command[1] ), command[2].toInt() ); 
         break;
+    case COMMAND_BOOT_STATS:
+        m_BootStats.print( out );
+        break;
+    case COMMAND_STATS:
+        if( command.size() > 1 && command[1].equalsIgnoreCase( "reset" ) ) {
+            m_LoopStats.reset();
+            m_Scheduler->reset();
+        } else {
+            m_LoopStats.print( out );
+            m_Scheduler->print( out );
+        }
+        break;
+    case COMMAND_METRICS:
+        m_Metrics->printCompact( out );
+        break;
+    case COMMAND_SERIAL:
+        if( m_BridgeControl->active() ) result = ERROR_SERIAL;
+        else result = m_SerialLink->configure( command );
+        break;
+    case COMMAND_CLIENTS:
+        m_Server->printClients( out );
+        break;
+    case COMMAND_I2C:
+        result = m_BusControl->i2c( command, out );
+        break;
+    case COMMAND_SPI:
+        result = m_BusControl->spi( command, out );
+        break;
+    case COMMAND_SENSOR:
+        result = m_SensorControl->command( command, out );
+        break;
+    case COMMAND_PIXELS:
+        result = m_PixelControl->command( command, out );
+        break;
+    case COMMAND_LOG:
+        if( command.size() == 1 ) Log.print( out );
+        else if( command.size() < 3 || !Log.configure( command[1], command[2] ) ) result = ERROR_LOG;
+        break;
     default: 
-        Serial.printf("NodeMCU::execute_command: error parsing command --> %s)\n",command[0].c_str()); 
+        LOG_WARN( LOG_NODEMCU, "NodeMCU::execute_command: error parsing command --> %s", command[0].c_str() ); 
+        result = COMMAND_ERROR;
         break;
     }
 
     return result;
 }
 
-uint16 NodeMCU::configure(const std::vector<String> &command){
+/**
+ * @brief Execute a write command with several PIN=VALUE arguments, all pins are set at once.
+ * 
+ * @param command the write command and its arguments
+ * @return uint16 result code
+ */
+uint16 NodeMCU::write_pins( const std::vector<String> &command ){
+    std::vector<PinId> pins;
+    std::vector<int> values;
+    for( uint i = 1; i < command.size(); i++ ){
+        int separator = command[i].indexOf( '=' );
+        if( separator <= 0 ) return ERROR_WRITE;
+        pins.push_back( parsePinCommand( command[i].substring( 0, separator ) ) );
+        values.push_back( parsePinValue( command[i].substring( separator + 1 ) ) );
+    }
+    return m_IOControl->write( pins, values );
+}
+
+uint16 NodeMCU::configure(const std::vector<String> &command, Print &out){
     uint16 result = COMMAND_ERROR;
     
     ConfigCommand config = parseConfigCommand( command [1] );
     switch ( config ){
     case CONFIG_SHOW:
-        Serial.println( "NodeMCU::configure: Showing current configuration on the flash memory:" );
-        m_ConfigControl->printConfig();
+        LOG_DEBUG( LOG_NODEMCU, "NodeMCU::configure: Showing current configuration on the flash memory" );
+        m_ConfigControl->printConfig( out );
+        result = SUCCESS;
         break;
     case CONFIG_PIN:
         if( command.size() < 4 ) return CONFIG_ERROR;
-        result = m_IOControl->configurePin( parsePinCommand( command[2] ), parsePinConfigCommand( command[3] ) ); 
+        if( command.size() > 4 && ( command[4].toInt() < 0 || ( command[4].toInt() == 0 && command[4] != "0" ) ) ) return ERROR_CONFIG_PIN;
+        result = m_IOControl->configurePin( parsePinCommand( command[2] ), parsePinConfigCommand( command[3] ), command.size() > 4 ? command[4].toInt() : 0 ); 
         break;
     case CONFIG_SSID:
     case CONFIG_PWD:
@@ -181,6 +364,13 @@ uint16 NodeMCU::configure(const std::vector<String> &command){
     case CONFIG_GATEWAY:
     case CONFIG_PORT_TCP:
     case CONFIG_PORT_HTTP:
+    case CONFIG_PORT_UDP:
+    case CONFIG_MULTICAST:
+    case CONFIG_CLIENT_RATE:
+    case CONFIG_CLIENT_BANDWIDTH:
+    case CONFIG_ADMISSION:
+    case CONFIG_HTTP_KEEP_ALIVE:
+    case CONFIG_HTTP_MAX_REQUESTS:
     case CONFIG_DNS1:
     case CONFIG_DNS2:
     case CONFIG_MAX_CLIENTS:
@@ -188,6 +378,30 @@ uint16 NodeMCU::configure(const std::vector<String> &command){
         if( command.size() < 3 ) return ERROR_CONFIG;
         result = m_Server->configure( config, command[2] );
         break;
+    case CONFIG_EXPANDER:
+        if( command.size() < 4 ) return ERROR_CONFIG_EXPANDER;
+        result = m_ExpanderControl->configure( command[2], command[3], command.size() > 4 ? command[4] : "", command.size() > 5 ? command[5] : "" );
+        break;
+    case CONFIG_SENSOR:
+        if( command.size() < 4 ) return ERROR_CONFIG_SENSOR;
+        result = m_SensorControl->configure( command[2], command[3], command.size() > 4 ? command[4] : "", command.size() > 5 ? command[5] : "" );
+        break;
+    case CONFIG_BRIDGE:
+        if( command.size() < 3 ) return ERROR_CONFIG_BRIDGE;
+        result = m_BridgeControl->configure( command[2], command.size() > 3 ? command[3] : "", command.size() > 4 ? command[4] : "", command.size() > 5 ? command[5] : "" );
+        break;
+    case CONFIG_PIXELS:
+        if( command.size() < 3 ) return ERROR_CONFIG_PIXELS;
+        result = m_PixelControl->configure( command[2], command.size() > 3 ? command[3] : "" );
+        break;
+    case CONFIG_SAVE_DELAY:
+    case CONFIG_EXPANDER_POLL:
+    case CONFIG_BRIDGE_FLUSH:
+    case CONFIG_BRIDGE_STALL:
+    case CONFIG_FAST_BOOT:
+        if( command.size() < 3 ) return ERROR_CONFIG;
+        result = m_ConfigControl->configure( config, command[2] );
+        break;
     case CONFIG_ERROR: /* not possible */ break;
     }
     return result;
@@ -0,0 +1,132 @@
+/**
+ * @file onewire.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "onewire.h"
+
+/**
+ * @brief Construct a new One Wire object, it drives no pin until begin() is called.
+ */
+OneWire::OneWire()
+: m_Gpio( 0 )
+{}
+
+/**
+ * @brief Release the bus on a pin, the level is set before the mode so the line does not glitch low.
+ *
+ * @param gpio the GPIO of the data line
+ */
+void OneWire::begin( uint8 gpio ){
+    m_Gpio = gpio;
+    digitalWrite( m_Gpio, HIGH );
+    pinMode( m_Gpio, OUTPUT_OPEN_DRAIN );
+}
+
+/**
+ * @brief Send a reset pulse: 480 us low, the devices answer 15 to 60 us after the release for 60 to 240 us.
+ *
+ * @return true if a device answered with a presence pulse
+ */
+bool OneWire::reset(){
+    digitalWrite( m_Gpio, LOW );
+    delayMicroseconds( 480 );
+    noInterrupts();
+    digitalWrite( m_Gpio, HIGH );
+    delayMicroseconds( 70 );
+    bool present = digitalRead( m_Gpio ) == LOW;
+    interrupts();
+    delayMicroseconds( 410 );
+    return present;
+}
+
+/**
+ * @brief Write a byte, least significant bit first.
+ */
+void OneWire::writeByte( uint8 value ){
+    for( uint8 i = 0; i < 8; i++ ){
+        writeBit( value & 0x01 );
+        value >>= 1;
+    }
+}
+
+/**
+ * @brief Read a byte, least significant bit first.
+ */
+uint8 OneWire::readByte(){
+    uint8 value = 0;
+    for( uint8 i = 0; i < 8; i++ ){
+        if( readBit() ) value |= 1 << i;
+    }
+    return value;
+}
+
+/**
+ * @brief Calculate the Dallas/Maxim CRC-8 (polynomial x^8 + x^5 + x^4 + 1) of a block of bytes.
+ *
+ * @return uint8 the CRC, 0 over a block that ends with its own CRC
+ */
+uint8 OneWire::crc8( const uint8 *data, size_t length ){
+    uint8 crc = 0;
+    while( length-- ){
+        uint8 byte = *data++;
+        for( uint8 i = 0; i < 8; i++ ){
+            uint8 mix = ( crc ^ byte ) & 0x01;
+            crc >>= 1;
+            if( mix ) crc ^= 0x8C;
+            byte >>= 1;
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief Write one time slot: a 1 is a 6 us low pulse, a 0 holds the line low for 60 us.
+ */
+void OneWire::writeBit( bool bit ){
+    noInterrupts();
+    digitalWrite( m_Gpio, LOW );
+    delayMicroseconds( bit ? 6 : 60 );
+    digitalWrite( m_Gpio, HIGH );
+    interrupts();
+    delayMicroseconds( bit ? 64 : 10 );
+}
+
+/**
+ * @brief Read one time slot: a short low pulse starts it, a device that sends a 0 keeps the line low
+ * past the sample point 13 us after the start.
+ */
+bool OneWire::readBit(){
+    noInterrupts();
+    digitalWrite( m_Gpio, LOW );
+    delayMicroseconds( 3 );
+    digitalWrite( m_Gpio, HIGH );
+    delayMicroseconds( 10 );
+    bool bit = digitalRead( m_Gpio ) == HIGH;
+    interrupts();
+    delayMicroseconds( 53 );
+    return bit;
+}
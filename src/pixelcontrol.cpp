@@ -0,0 +1,306 @@
+/**
+ * @file pixelcontrol.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pixelcontrol.h"
+#include "logger.h"
+
+/**
+ * @brief Convert pixels between the RGB order of the commands and the GRB order of the strip, it swaps red and green.
+ */
+static void swapRedGreen( uint8 *pixels, uint count ){
+    for( ; count > 0; count--, pixels += 3 ) std::swap( pixels[0], pixels[1] );
+}
+
+/**
+ * @brief Construct a new Pixel Control object
+ *
+ * @param configControl instance pointer to the cofiguration control of the flash memory
+ * @param ioControl instance pointer to the pin control that reserves the data pin
+ * @param metrics instance pointer to the metrics counters
+ */
+PixelControl::PixelControl( ConfigControl *configControl, IOControl *ioControl, Metrics *metrics )
+: m_ConfigControl( configControl )
+, m_IOControl( ioControl )
+, m_Metrics( metrics )
+, m_Back( nullptr )
+, m_Front( nullptr )
+, m_Gpio( 0 )
+, m_Pending( false )
+, m_Sent( 0 )
+, m_SendTime( 0 )
+{}
+
+/**
+ * @brief Destroy the Pixel Control object and its framebuffers.
+ */
+PixelControl::~PixelControl(){
+    delete[] m_Back;
+    delete[] m_Front;
+}
+
+/**
+ * @brief Start the LED strip of the flash memory configuration.
+ */
+void PixelControl::load(){
+    if( !m_ConfigControl->PixelCount ) return;
+    uint16 result = attach();
+    if( result != SUCCESS ) LOG_ERROR( LOG_IO, "PixelControl::load: LED strip can not be started: %04X", result );
+}
+
+/**
+ * @brief Execute the configuration command of the LED strip: config pixels PIN COUNT or config pixels off.
+ * On an error the previous strip stays.
+ *
+ * @param pin the data pin, D4, the TX pin of UART1
+ * @param count the amount of pixels, 1 to PIXEL_MAX_COUNT
+ * @return uint16 result code
+ */
+uint16 PixelControl::configure( const String &pin, const String &count ){
+    uint8 data = 0;
+    long number = 0;
+    if( !pin.equalsIgnoreCase( "off" ) ) {
+        PinId id = parsePinCommand( pin );
+        if( id != PIN_DIG4 ) return ERROR_CONFIG_PIXELS;
+        if( !parseNumber( count, 1, PIXEL_MAX_COUNT, number ) ) return ERROR_CONFIG_PIXELS;
+        data = id;
+    }
+
+    uint8 previousPin = m_ConfigControl->PixelPin;
+    uint16 previousCount = m_ConfigControl->PixelCount;
+    detach();
+    m_ConfigControl->PixelPin = data;
+    m_ConfigControl->PixelCount = number;
+    if( number ) {
+        uint16 result = attach();
+        if( result != SUCCESS ) {
+            m_ConfigControl->PixelPin = previousPin;
+            m_ConfigControl->PixelCount = previousCount;
+            if( previousCount ) attach();
+            return result;
+        }
+    }
+    m_ConfigControl->markUpdated();
+    LOG_INFO( LOG_IO, "PixelControl::configure: LED strip with %ld pixels", number );
+    return SUCCESS;
+}
+
+/**
+ * @brief Execute a pixels command:
+ * pixels prints the status, pixels OFFSET RRGGBB... sets pixels from OFFSET on,
+ * pixels fill RRGGBB [OFFSET [COUNT]] sets a range to one color, pixels get [OFFSET [COUNT]] prints the shown pixels
+ * and pixels show shows the frame. The set commands show the frame when show is their last argument.
+ *
+ * @param command commands and arguments
+ * @param out the output for the status and the pixels
+ * @return uint16 result code
+ */
+uint16 PixelControl::command( const std::vector<String> &command, Print &out ){
+    if( !m_Back ) return ERROR_PIXELS_NOT_SET;
+    long count = m_ConfigControl->PixelCount;
+    if( command.size() == 1 ) {
+        out.printf( "pin=%s count=%ld frames=%u skipped=%u send=%u\n", m_ConfigControl->pinData[static_cast<PinId>( m_ConfigControl->PixelPin )].name.c_str(),
+            count, m_Metrics->PixelFrames, m_Metrics->PixelSkipped, m_SendTime );
+        return SUCCESS;
+    }
+
+    uint size = command.size();
+    bool showing = size > 2 && command[size - 1].equalsIgnoreCase( "show" );
+    if( showing ) size--;
+
+    if( command[1].equalsIgnoreCase( "show" ) && size == 2 ) {
+        show();
+        return SUCCESS;
+    }
+
+    if( command[1].equalsIgnoreCase( "get" ) ) {
+        if( showing || size > 4 ) return ERROR_PIXELS;
+        long offset = 0, amount = 0;
+        if( size > 2 && !parseNumber( command[2], 0, 0xFFFF, offset ) ) return ERROR_PIXELS;
+        if( size > 3 && !parseNumber( command[3], 0, 0xFFFF, amount ) ) return ERROR_PIXELS;
+        if( size <= 3 ) amount = count - offset;
+        if( offset >= count || amount < 1 || offset + amount > count ) return ERROR_PIXELS_RANGE;
+        for( const uint8 *pixel = m_Front + offset * 3; amount > 0; amount--, pixel += 3 ){
+            out.printf( "%02X%02X%02X", pixel[1], pixel[0], pixel[2] );
+        }
+        out.print( "\n" );
+        return SUCCESS;
+    }
+
+    if( command[1].equalsIgnoreCase( "fill" ) ) {
+        long offset = 0, amount = 0;
+        uint8 color[3];
+        uint length = 0;
+        if( size < 3 || size > 5 || !parseHex( command[2], color, sizeof( color ), length ) || length != sizeof( color ) ) return ERROR_PIXELS;
+        if( size > 3 && !parseNumber( command[3], 0, 0xFFFF, offset ) ) return ERROR_PIXELS;
+        if( size > 4 && !parseNumber( command[4], 0, 0xFFFF, amount ) ) return ERROR_PIXELS;
+        if( size <= 4 ) amount = count - offset;
+        if( offset >= count || amount < 1 || offset + amount > count ) return ERROR_PIXELS_RANGE;
+        swapRedGreen( color, 1 );
+        for( uint8 *pixel = m_Back + offset * 3; amount > 0; amount--, pixel += 3 ) memcpy( pixel, color, sizeof( color ) );
+        if( showing ) show();
+        return SUCCESS;
+    }
+
+    long offset = 0;
+    if( size != 3 || !parseNumber( command[1], 0, 0xFFFF, offset ) ) return ERROR_PIXELS;
+    const String &hex = command[2];
+    uint digits = hex.length() - ( hex.startsWith( "0x" ) || hex.startsWith( "0X" ) ? 2 : 0 );
+    if( !digits || digits % 6 ) return ERROR_PIXELS;
+    if( offset >= count || offset + digits / 6 > count ) return ERROR_PIXELS_RANGE;
+
+    // The RGB of the text goes to the GRB of the strip
+    uint length = 0;
+    if( !parseHex( hex, m_Back + offset * 3, digits / 2, length ) ) return ERROR_PIXELS;
+    swapRedGreen( m_Back + offset * 3, length / 3 );
+    if( showing ) show();
+    return SUCCESS;
+}
+
+/**
+ * @brief Write binary pixel runs into the back buffer: [offset high][offset low][count][RGB * count] repeated.
+ * The runs are checked before any of them is written, so a bad datagram changes nothing.
+ *
+ * @param data the runs
+ * @param length the length of the runs
+ * @param show true to show the frame afterwards
+ * @return uint16 result code
+ */
+uint16 PixelControl::upload( const uint8_t *data, size_t length, bool show ){
+    if( !m_Back ) return ERROR_PIXELS_NOT_SET;
+    for( size_t position = 0; position < length; ){
+        if( length - position < 3 ) return ERROR_PIXELS;
+        uint offset = data[position] << 8 | data[position + 1];
+        uint amount = data[position + 2];
+        if( length - position - 3 < amount * 3 ) return ERROR_PIXELS;
+        if( offset + amount > m_ConfigControl->PixelCount ) return ERROR_PIXELS_RANGE;
+        position += 3 + amount * 3;
+    }
+
+    for( size_t position = 0; position < length; ){
+        uint offset = data[position] << 8 | data[position + 1];
+        uint amount = data[position + 2];
+        memcpy( m_Back + offset * 3, data + position + 3, amount * 3 );
+        swapRedGreen( m_Back + offset * 3, amount );
+        position += 3 + amount * 3;
+    }
+    if( show ) this->show();
+    return SUCCESS;
+}
+
+/**
+ * @brief Send the last shown frame to the strip once the latch time of the previous one has passed.
+ * The loop waits while the frame is sent, about 30 us per pixel.
+ *
+ * @return uint16 result code
+ */
+uint16 PixelControl::update(){
+    if( !m_Pending ) return SUCCESS;
+    unsigned long start = micros();
+    if( start - m_Sent < PIXEL_LATCH_US ) return SUCCESS;
+
+    transmit();
+    m_Sent = micros();
+    m_SendTime = m_Sent - start;
+    m_Pending = false;
+    m_Metrics->PixelFrames++;
+    return SUCCESS;
+}
+
+/**
+ * @brief Allocate the framebuffers and reserve the data pin, the strip is cleared.
+ * The pin has to be unused or an input, UART1 sends inverted so the idle line is low.
+ *
+ * @return uint16 result code
+ */
+uint16 PixelControl::attach(){
+    PinId pin = static_cast<PinId>( m_ConfigControl->PixelPin );
+    if( pin != PIN_DIG4 ) return ERROR_CONFIG_PIXELS;
+    PinConfig mode = m_ConfigControl->pinData[pin].mode;
+    if( m_IOControl->reserved( pin ) || ( mode != PIN_NOT_SET && mode != PIN_INPUT ) ) return PIN_ERROR | pin;
+
+    size_t length = m_ConfigControl->PixelCount * 3;
+    m_Back = new uint8[length];
+    m_Front = new uint8[length];
+    memset( m_Back, 0, length );
+    memset( m_Front, 0, length );
+    m_Gpio = m_ConfigControl->pinData[pin].gpio;
+    m_IOControl->reserve( pin, true );
+    Serial1.begin( PIXEL_UART_BAUD, SERIAL_6N1, SERIAL_TX_ONLY, m_Gpio, true );
+    m_Sent = micros();
+    m_Pending = true;
+    return SUCCESS;
+}
+
+/**
+ * @brief Free the framebuffers and release the data pin, a frame that has not been sent is dropped.
+ */
+void PixelControl::detach(){
+    if( !m_Back ) return;
+    delete[] m_Back;
+    delete[] m_Front;
+    m_Back = nullptr;
+    m_Front = nullptr;
+    m_Pending = false;
+
+    PinId pin = static_cast<PinId>( m_ConfigControl->PixelPin );
+    Serial1.end();
+    pinMode( m_Gpio, INPUT );
+    m_IOControl->reserve( pin, false );
+}
+
+/**
+ * @brief Copy the back buffer to the front buffer, to be sent by the next update().
+ * The back buffer keeps its pixels, so the next frame only has to change what differs.
+ */
+void PixelControl::show(){
+    if( m_Pending ) m_Metrics->PixelSkipped++;
+    memcpy( m_Front, m_Back, m_ConfigControl->PixelCount * 3 );
+    m_Pending = true;
+}
+
+/**
+ * @brief Send the front buffer to the strip through UART1 and wait until the last bit is out.
+ * Every UART character carries 2 strip bits. Inverted its start bit is the high of the first one,
+ * the 6 data bits (LSB first) the rest of both and its stop bit the low at the end of the second one.
+ * A 0 bit is high for 1 UART bit (312 ns), a 1 bit for 3 (937 ns). The chunks keep the TX FIFO filled,
+ * so there is no gap in the frame which would latch half of it.
+ */
+void PixelControl::transmit(){
+    static const uint8 PIXEL_BITS[4] = { 0x37, 0x07, 0x34, 0x04 };
+    uint8 chunk[PIXEL_CHUNK_SIZE * 4];
+    const uint8 *data = m_Front;
+    for( size_t length = m_ConfigControl->PixelCount * 3; length > 0; ){
+        size_t size = std::min<size_t>( length, PIXEL_CHUNK_SIZE );
+        for( size_t i = 0; i < size; i++, data++ ){
+            for( uint shift = 0; shift < 4; shift++ ) chunk[i * 4 + shift] = PIXEL_BITS[( *data >> ( 6 - shift * 2 ) ) & 0x03];
+        }
+        Serial1.write( chunk, size * 4 );
+        length -= size;
+    }
+    Serial1.flush();
+}
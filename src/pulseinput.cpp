@@ -0,0 +1,158 @@
+/**
+ * @file pulseinput.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pulseinput.h"
+
+/**
+ * @brief Construct a new Pulse Input object, it measures nothing until begin() is called.
+ */
+PulseInput::PulseInput()
+: m_Gpio( 0 )
+, m_Mode( PIN_NOT_SET )
+, m_Active( false )
+, m_FilterCycles( 0 )
+, m_Level( LOW )
+, m_Started( false )
+, m_LastEdge( 0 )
+, m_LastRise( 0 )
+, m_Edges( 0 )
+, m_ReadEdges( 0 )
+, m_EdgeTime( 0 )
+, m_Count( 0 )
+, m_PeriodSum( 0 )
+, m_Periods( 0 )
+, m_WidthSum( 0 )
+, m_Widths( 0 )
+, m_Value( 0 )
+{}
+
+/**
+ * @brief Start measuring a pin.
+ *
+ * @param gpio the GPIO of the pin, GPIO16 has no interrupt
+ * @param mode PIN_COUNTER, PIN_FREQUENCY or PIN_PULSE_WIDTH
+ * @param filter the minimum time (in us) between two edges
+ */
+void PulseInput::begin( uint8 gpio, PinConfig mode, uint32 filter ){
+    end();
+    m_Gpio = gpio;
+    m_Mode = mode;
+    m_FilterCycles = filter * ESP.getCpuFreqMHz();
+    m_Level = digitalRead( gpio );
+    m_Started = false;
+    m_LastEdge = ESP.getCycleCount() - m_FilterCycles;
+    m_Edges = 0;
+    m_ReadEdges = 0;
+    m_EdgeTime = millis();
+    m_Count = 0;
+    m_PeriodSum = 0;
+    m_Periods = 0;
+    m_WidthSum = 0;
+    m_Widths = 0;
+    m_Value = 0;
+    attachInterruptArg( digitalPinToInterrupt( gpio ), handleEdge, this, CHANGE );
+    m_Active = true;
+}
+
+/**
+ * @brief Stop measuring, detaches the interrupt.
+ */
+void PulseInput::end(){
+    if( !m_Active ) return;
+    detachInterrupt( digitalPinToInterrupt( m_Gpio ) );
+    m_Active = false;
+}
+
+/**
+ * @brief Return the measured value of the pin mode.
+ * The accumulators are copied and cleared with the interrupts disabled, the division happens afterwards.
+ *
+ * @param reset true to clear the counter in the same step, so no edge is lost between the read and the reset
+ * @return int the count, the frequency in mHz or the pulse width in us
+ */
+int PulseInput::read( bool reset ){
+    noInterrupts();
+    uint32 count = m_Count;
+    uint64_t periodSum = m_PeriodSum;
+    uint32 periods = m_Periods;
+    uint64_t widthSum = m_WidthSum;
+    uint32 widths = m_Widths;
+    uint32 edges = m_Edges;
+    if( reset ) m_Count = 0;
+    m_PeriodSum = 0;
+    m_Periods = 0;
+    m_WidthSum = 0;
+    m_Widths = 0;
+    interrupts();
+
+    unsigned long now = millis();
+    if( edges != m_ReadEdges ) {
+        m_ReadEdges = edges;
+        m_EdgeTime = now;
+    }
+
+    uint32 mhz = ESP.getCpuFreqMHz();
+    if( m_Mode == PIN_COUNTER ) return count;
+    if( m_Mode == PIN_FREQUENCY && periods ) {
+        uint64_t us = periodSum / mhz;
+        m_Value = us ? periods * 1000000000ULL / us : 0;
+    } else if( m_Mode == PIN_PULSE_WIDTH && widths ) {
+        m_Value = widthSum / widths / mhz;
+    } else if( now - m_EdgeTime > PULSE_TIMEOUT ) {
+        // The signal stopped
+        m_Value = 0;
+    }
+    return m_Value;
+}
+
+/**
+ * @brief The edge interrupt.
+ * The level is read back, so an edge that was filtered out is not counted twice when the next one arrives.
+ */
+void IRAM_ATTR PulseInput::handleEdge( void *arg ){
+    PulseInput *input = static_cast<PulseInput*>( arg );
+    uint32 now = ESP.getCycleCount();
+    uint8 level = digitalRead( input->m_Gpio );
+    if( level == input->m_Level || now - input->m_LastEdge < input->m_FilterCycles ) return;
+    input->m_Level = level;
+    input->m_LastEdge = now;
+    input->m_Edges++;
+
+    if( level == HIGH ) {
+        input->m_Count++;
+        if( input->m_Started ) {
+            input->m_PeriodSum += now - input->m_LastRise;
+            input->m_Periods++;
+        }
+        input->m_LastRise = now;
+        input->m_Started = true;
+    } else if( input->m_Started ) {
+        input->m_WidthSum += now - input->m_LastRise;
+        input->m_Widths++;
+    }
+}
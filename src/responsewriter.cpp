@@ -0,0 +1,112 @@
+/**
+ * @file responsewriter.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "responsewriter.h"
+#include "httpserver.h"
+
+/**
+ * @brief Construct a new Response Writer object for a connection.
+ *
+ * @param out the output the chunks are written to
+ */
+ResponseWriter::ResponseWriter( Print &out )
+: m_Out( &out )
+, m_Server( nullptr )
+, m_ContentType( nullptr )
+, m_Status( 200 )
+, m_HeadersSent( false )
+, m_Length( 0 )
+, m_Written( 0 )
+{}
+
+/**
+ * @brief Construct a new Response Writer object for the response to the current HTTP request.
+ *
+ * @param server the web server that handles the request
+ * @param contentType the content type of the response
+ */
+ResponseWriter::ResponseWriter( HttpServer &server, const char *contentType )
+: m_Out( nullptr )
+, m_Server( &server )
+, m_ContentType( contentType )
+, m_Status( 200 )
+, m_HeadersSent( false )
+, m_Length( 0 )
+, m_Written( 0 )
+{}
+
+/**
+ * @brief Send what is left in the buffer.
+ * A HTTP response that has not been started yet fits in the buffer, so its length is known.
+ */
+ResponseWriter::~ResponseWriter(){
+    if( m_Server && !m_HeadersSent ) sendHeaders( m_Length );
+    flush();
+}
+
+size_t ResponseWriter::write( uint8_t c ){
+    if( m_Length == RESPONSE_CHUNK_SIZE ) flush();
+    m_Buffer[m_Length++] = c;
+    return 1;
+}
+
+size_t ResponseWriter::write( const uint8_t *buffer, size_t size ){
+    for( size_t offset = 0; offset < size; ){
+        if( m_Length == RESPONSE_CHUNK_SIZE ) flush();
+        size_t length = std::min( size - offset, RESPONSE_CHUNK_SIZE - m_Length );
+        memcpy( m_Buffer + m_Length, buffer + offset, length );
+        m_Length += length;
+        offset += length;
+    }
+    return size;
+}
+
+/**
+ * @brief Send the content of the buffer.
+ */
+void ResponseWriter::flush(){
+    if( !m_Length ) return;
+    if( m_Server ) {
+        if( !m_HeadersSent ) sendHeaders( HTTP_CONTENT_CHUNKED );
+        m_Server->sendContent( m_Buffer, m_Length );
+    } else {
+        m_Out->write( reinterpret_cast<const uint8_t*>( m_Buffer ), m_Length );
+    }
+    m_Written += m_Length;
+    m_Length = 0;
+}
+
+/**
+ * @brief Send the HTTP status line and headers.
+ *
+ * @param length the content length or HTTP_CONTENT_CHUNKED for a chunked response
+ */
+void ResponseWriter::sendHeaders( size_t length ){
+    m_Server->send( m_Status, m_ContentType, length );
+    m_HeadersSent = true;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file ringbuffer.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ringbuffer.h"
+
+/**
+ * @brief Construct a new empty Ring Buffer object
+ */
+RingBuffer::RingBuffer()
+: m_Head( 0 )
+, m_Tail( 0 )
+{}
+
+/**
+ * @brief Drop the content.
+ */
+void RingBuffer::clear(){
+    m_Head = 0;
+    m_Tail = 0;
+}
+
+/**
+ * @brief Return the free space after the head up to the end of the buffer, fill it and commit() the added bytes.
+ * When the free space wraps around the rest is returned by the next call after the commit.
+ *
+ * @param length output for the size of the span, 0 when the buffer is full
+ * @return uint8* the start of the span
+ */
+uint8 *RingBuffer::writeSpan( size_t &length ){
+    size_t offset = m_Head & ( RING_BUFFER_SIZE - 1 );
+    length = std::min( room(), RING_BUFFER_SIZE - offset );
+    return m_Buffer + offset;
+}
+
+/**
+ * @brief Return the content after the tail up to the end of the buffer, send it and consume() the sent bytes.
+ * When the content wraps around the rest is returned by the next call after the consume.
+ *
+ * @param length output for the size of the span, 0 when the buffer is empty
+ * @return const uint8* the start of the span
+ */
+const uint8 *RingBuffer::readSpan( size_t &length ) const{
+    size_t offset = m_Tail & ( RING_BUFFER_SIZE - 1 );
+    length = std::min( used(), RING_BUFFER_SIZE - offset );
+    return m_Buffer + offset;
+}
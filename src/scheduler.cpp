@@ -0,0 +1,131 @@
+/**
+ * @file scheduler.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "scheduler.h"
+#include <algorithm>
+
+/**
+ * @brief The names of the task priorities as shown by the stats command.
+ */
+static const char *TASK_PRIORITY_NAMES[] = {
+    "urgent",
+    "normal",
+    "background"
+};
+
+/**
+ * @brief Construct a new Scheduler object
+ *
+ * @param loopStats instance pointer to the loop timing, every task is a loop stage
+ * @param metrics instance pointer to the metrics counters, a failed result of a task is counted when it differs from its previous one
+ */
+Scheduler::Scheduler( LoopStats *loopStats, Metrics *metrics )
+: m_LoopStats( loopStats )
+, m_Metrics( metrics )
+{}
+
+/**
+ * @brief Register a task, it runs for the first time in the next loop iteration.
+ *
+ * @param stage the loop stage of the task, also the name of the task
+ * @param priority the priority of the task
+ * @param period the time (in ms) between two runs, 0 to run in every loop iteration
+ * @param budget the time (in us) the task may take before it counts an overrun
+ * @param task the function of the task, returns a result code
+ */
+void Scheduler::add( LoopStage stage, TaskPriority priority, uint32 period, uint32 budget, std::function<uint16()> task ){
+    m_Tasks.push_back( { stage, priority, period, budget, task, millis() - period, 0, 0, 0, 0, 0, 0, SUCCESS } );
+
+    // Tasks of the same priority keep the order they were added in
+    std::stable_sort( m_Tasks.begin(), m_Tasks.end(), []( const Task &a, const Task &b ){ return a.priority < b.priority; } );
+}
+
+/**
+ * @brief Run one loop iteration.
+ * The expected duration of a task is the running average of its last runs.
+ */
+void Scheduler::run(){
+    uint32 mhz = ESP.getCpuFreqMHz();
+    uint32 loopStart = m_LoopStats->beginLoop();
+    unsigned long now = millis();
+
+    for( Task &task: m_Tasks ){
+        if( task.period && now - task.lastRun < task.period ) continue;
+
+        // A task that does not fit in the rest of the slice waits, but not forever.
+        // A task longer than the slice never fits, it runs when the iteration is still nearly idle
+        uint32 start = ESP.getCycleCount();
+        uint32 elapsed = ( start - loopStart ) / mhz;
+        bool fits = task.estimate <= SCHEDULER_SLICE_US ? elapsed + task.estimate <= SCHEDULER_SLICE_US : elapsed <= SCHEDULER_IDLE_US;
+        if( task.priority != PRIORITY_URGENT && !fits && task.deferrals < SCHEDULER_MAX_DEFER ) {
+            task.deferrals++;
+            task.deferred++;
+            continue;
+        }
+
+        uint16 result = task.run();
+        uint32 duration = ( m_LoopStats->record( task.stage, start ) - start ) / mhz;
+        task.lastRun = now;
+        task.deferrals = 0;
+        task.estimate = ( task.estimate * 3 + duration ) / 4;
+        task.runs++;
+        if( duration > task.maxTime ) task.maxTime = duration;
+        if( duration > task.budget ) task.overruns++;
+
+        // A task that keeps failing the same way (wifi connecting, no connection) is counted once
+        if( result != SUCCESS && result != task.result ) m_Metrics->countResult( result );
+        task.result = result;
+    }
+    m_LoopStats->endLoop();
+}
+
+/**
+ * @brief Clear the counters of the tasks.
+ */
+void Scheduler::reset(){
+    for( Task &task: m_Tasks ){
+        task.runs = 0;
+        task.overruns = 0;
+        task.deferred = 0;
+        task.maxTime = 0;
+    }
+}
+
+/**
+ * @brief Print the tasks and their counters.
+ *
+ * @param out the output to print to
+ */
+void Scheduler::print( Print &out ){
+    out.printf( "Scheduler: slice %u us\n", SCHEDULER_SLICE_US );
+    for( Task &task: m_Tasks ){
+        out.printf( "\t%s: %s, period %u ms, budget %u us, runs %u, overruns %u, deferred %u, avg %u us, max %u us\n",
+            LoopStats::stageName( task.stage ), TASK_PRIORITY_NAMES[task.priority], task.period, task.budget,
+            task.runs, task.overruns, task.deferred, task.estimate, task.maxTime );
+    }
+}
@@ -0,0 +1,291 @@
+/**
+ * @file sensorcontrol.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "sensorcontrol.h"
+#include "logger.h"
+
+/**
+ * @brief The names of the values in the replies and the names of their Prometheus gauges, by value index.
+ */
+static const char *VALUE_NAMES[SENSOR_VALUES] = { "temperature", "humidity" };
+static const char *VALUE_GAUGES[SENSOR_VALUES] = { "nodemcu_sensor_temperature_celsius", "nodemcu_sensor_humidity_percent" };
+
+/**
+ * @brief Print a value in hundredths with two decimals.
+ */
+static void printCenti( Print &out, int value ){
+    out.printf( "%s%d.%02d", value < 0 ? "-" : "", abs( value ) / 100, abs( value ) % 100 );
+}
+
+/**
+ * @brief Construct a new Sensor Control object
+ */
+SensorControl::SensorControl( ConfigControl *configControl, IOControl *ioControl, Metrics *metrics )
+: m_ConfigControl( configControl )
+, m_IOControl( ioControl )
+, m_Metrics( metrics )
+{
+    for( Sensor &sensor: m_Sensors ) sensor = (Sensor){ nullptr, false, false, { 0, 0 }, 0, 0, 0, 0 };
+}
+
+/**
+ * @brief Destroy the Sensor Control object and its drivers.
+ */
+SensorControl::~SensorControl(){
+    for( Sensor &sensor: m_Sensors ) delete sensor.driver;
+}
+
+/**
+ * @brief Start the sensors of the flash memory configuration.
+ */
+void SensorControl::load(){
+    for( uint slot = 0; slot < SENSOR_COUNT; slot++ ){
+        if( m_ConfigControl->Sensors[slot].type == SENSOR_NONE ) continue;
+        uint16 result = attach( slot );
+        if( result != SUCCESS ) LOG_ERROR( LOG_IO, "SensorControl::load: Sensor %u can not be started: %04X", slot, result );
+    }
+}
+
+/**
+ * @brief Execute a configuration command for a sensor: config sensor SLOT TYPE [PIN] [INTERVAL_MS].
+ * On an error the previous sensor stays.
+ * 
+ * @param slot the number of the sensor, 0 to SENSOR_COUNT - 1
+ * @param type the chip, or none to remove the sensor
+ * @param pin the data pin, D1 to D8, D0 (GPIO16) has no open-drain output
+ * @param interval the time between two measurements in ms, empty for the default of the chip
+ * @return uint16 result code
+ */
+uint16 SensorControl::configure( const String &slot, const String &type, const String &pin, const String &interval ){
+    long number = slot.toInt();
+    if( number < 0 || number >= SENSOR_COUNT || ( number == 0 && slot != "0" ) ) return ERROR_CONFIG_SENSOR;
+    SensorType chip = parseSensorType( type );
+    if( chip == SENSOR_ERROR ) return ERROR_CONFIG_SENSOR;
+
+    SENSOR_CONFIG next = { chip, 0, 0 };
+    if( chip != SENSOR_NONE ) {
+        PinId data = parsePinCommand( pin );
+        if( data < PIN_DIG1 || data > PIN_DIG8 ) return ERROR_CONFIG_SENSOR;
+        next.pin = data;
+        next.interval = interval.length() ? interval.toInt() : minimumInterval( chip );
+        if( next.interval < minimumInterval( chip ) ) return ERROR_CONFIG_SENSOR;
+    }
+
+    SENSOR_CONFIG previous = m_ConfigControl->Sensors[number];
+    detach( number );
+    m_ConfigControl->Sensors[number] = next;
+    if( chip != SENSOR_NONE ) {
+        uint16 result = attach( number );
+        if( result != SUCCESS ) {
+            m_ConfigControl->Sensors[number] = previous;
+            if( previous.type != SENSOR_NONE ) attach( number );
+            return result;
+        }
+    }
+    m_ConfigControl->markUpdated();
+    LOG_INFO( LOG_IO, "SensorControl::configure: Sensor %ld is %s", number, sensorName( chip ) );
+    return SUCCESS;
+}
+
+/**
+ * @brief Step the measurements in progress and start the ones that are due, one step per sensor.
+ * 
+ * @return uint16 result code
+ */
+uint16 SensorControl::update(){
+    for( uint slot = 0; slot < SENSOR_COUNT; slot++ ){
+        Sensor &sensor = m_Sensors[slot];
+        if( !sensor.driver ) continue;
+        unsigned long now = millis();
+        if( !sensor.busy ) {
+            if( static_cast<long>( now - sensor.nextStart ) < 0 ) continue;
+            sensor.nextStart = now + m_ConfigControl->Sensors[slot].interval;
+            sensor.driver->start( now );
+            sensor.busy = true;
+            continue;
+        }
+
+        int values[SENSOR_VALUES] = {};
+        SensorStep step = sensor.driver->step( now, values );
+        if( step == SENSOR_BUSY ) continue;
+        sensor.busy = false;
+        if( step == SENSOR_FAILED ) {
+            sensor.errors++;
+            m_Metrics->SensorErrors++;
+            LOG_DEBUG( LOG_IO, "SensorControl::update: Sensor %u measurement failed", slot );
+            continue;
+        }
+        memcpy( sensor.values, values, sizeof( values ) );
+        sensor.valueTime = millis();
+        sensor.valid = true;
+        sensor.reads++;
+        m_Metrics->SensorReads++;
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Execute a sensor command: sensor lists all sensors, sensor SLOT prints the values of one.
+ * 
+ * @param command the command and its arguments
+ * @param out the output the values are printed to
+ * @return uint16 result code
+ */
+uint16 SensorControl::command( const std::vector<String> &command, Print &out ){
+    if( command.size() == 1 ) {
+        for( uint slot = 0; slot < SENSOR_COUNT; slot++ ){
+            SENSOR_CONFIG &config = m_ConfigControl->Sensors[slot];
+            if( config.type == SENSOR_NONE ) continue;
+            out.printf( "%u %s %s ", slot, sensorName( config.type ), m_ConfigControl->pinData[static_cast<PinId>( config.pin )].name.c_str() );
+            if( m_Sensors[slot].valid ) {
+                printValues( out, slot );
+                out.print( " " );
+            }
+            out.printf( "reads=%u errors=%u\n", m_Sensors[slot].reads, m_Sensors[slot].errors );
+        }
+        return SUCCESS;
+    }
+
+    long slot = command[1].toInt();
+    if( slot < 0 || slot >= SENSOR_COUNT || ( slot == 0 && command[1] != "0" ) ) return ERROR_SENSOR;
+    if( !m_Sensors[slot].driver ) return ERROR_SENSOR_NOT_SET | slot;
+    if( !m_Sensors[slot].valid ) return ERROR_SENSOR_NO_VALUE | slot;
+    printValues( out, slot );
+    out.print( "\n" );
+    return SUCCESS;
+}
+
+/**
+ * @brief Print the cached values as Prometheus gauges, with the age of the last measurement.
+ * 
+ * @param out the output to print to
+ */
+void SensorControl::printPrometheus( Print &out ){
+    unsigned long now = millis();
+    for( uint value = 0; value < SENSOR_VALUES + 1; value++ ){
+        bool typed = false;
+        for( uint slot = 0; slot < SENSOR_COUNT; slot++ ){
+            Sensor &sensor = m_Sensors[slot];
+            if( !sensor.valid || ( value < SENSOR_VALUES && value >= sensor.driver->valueCount() ) ) continue;
+            const char *gauge = value < SENSOR_VALUES ? VALUE_GAUGES[value] : "nodemcu_sensor_age_seconds";
+            if( !typed ) out.printf( "# TYPE %s gauge\n", gauge );
+            typed = true;
+            out.printf( "%s{sensor=\"%u\",type=\"%s\"} ", gauge, slot, sensorName( m_ConfigControl->Sensors[slot].type ) );
+            if( value < SENSOR_VALUES ) printCenti( out, sensor.values[value] );
+            else out.printf( "%lu.%03lu", ( now - sensor.valueTime ) / 1000, ( now - sensor.valueTime ) % 1000 );
+            out.print( "\n" );
+        }
+    }
+}
+
+/**
+ * @brief Print the cached values as space separated key=value pairs: sensor.SLOT.NAME=VALUE.
+ * 
+ * @param out the output to print to
+ */
+void SensorControl::printCompact( Print &out ){
+    unsigned long now = millis();
+    for( uint slot = 0; slot < SENSOR_COUNT; slot++ ){
+        Sensor &sensor = m_Sensors[slot];
+        if( !sensor.valid ) continue;
+        for( uint value = 0; value < sensor.driver->valueCount(); value++ ){
+            out.printf( "sensor.%u.%s=", slot, VALUE_NAMES[value] );
+            printCenti( out, sensor.values[value] );
+            out.print( " " );
+        }
+        out.printf( "sensor.%u.age=%lu ", slot, now - sensor.valueTime );
+    }
+}
+
+/**
+ * @brief Reserve the data pin of a sensor and create its driver, the first measurement starts right away.
+ * The pin has to be unused or an input.
+ * 
+ * @return uint16 result code
+ */
+uint16 SensorControl::attach( uint slot ){
+    SENSOR_CONFIG &config = m_ConfigControl->Sensors[slot];
+    PinId pin = static_cast<PinId>( config.pin );
+    if( pin < PIN_DIG1 || pin > PIN_DIG8 ) return ERROR_CONFIG_SENSOR;
+    PinConfig mode = m_ConfigControl->pinData[pin].mode;
+    if( m_IOControl->reserved( pin ) || ( mode != PIN_NOT_SET && mode != PIN_INPUT ) ) return PIN_ERROR | pin;
+
+    uint8 gpio = m_ConfigControl->pinData[pin].gpio;
+    Sensor &sensor = m_Sensors[slot];
+    if( config.type == SENSOR_DS18B20 ) sensor.driver = new Ds18b20( gpio );
+    else sensor.driver = new DhtSensor( gpio, config.type == SENSOR_DHT11 );
+    m_IOControl->reserve( pin, true );
+    sensor.driver->begin();
+    sensor.busy = false;
+    sensor.valid = false;
+    sensor.nextStart = millis();
+    sensor.reads = 0;
+    sensor.errors = 0;
+    return SUCCESS;
+}
+
+/**
+ * @brief Delete the driver of a sensor and release its data pin, a measurement in progress is dropped.
+ */
+void SensorControl::detach( uint slot ){
+    Sensor &sensor = m_Sensors[slot];
+    if( !sensor.driver ) return;
+    delete sensor.driver;
+    sensor.driver = nullptr;
+    sensor.busy = false;
+    sensor.valid = false;
+
+    PinId pin = static_cast<PinId>( m_ConfigControl->Sensors[slot].pin );
+    pinMode( m_ConfigControl->pinData[pin].gpio, INPUT );
+    m_IOControl->reserve( pin, false );
+}
+
+/**
+ * @brief Print the values of a sensor as name=value pairs and their age in ms.
+ */
+void SensorControl::printValues( Print &out, uint slot ){
+    Sensor &sensor = m_Sensors[slot];
+    for( uint value = 0; value < sensor.driver->valueCount(); value++ ){
+        out.printf( "%s=", VALUE_NAMES[value] );
+        printCenti( out, sensor.values[value] );
+        out.print( " " );
+    }
+    out.printf( "age=%lu", millis() - sensor.valueTime );
+}
+
+/**
+ * @brief Return the default and shortest measurement interval of a chip.
+ */
+uint32 SensorControl::minimumInterval( SensorType type ){
+    switch( type ){
+    case SENSOR_DS18B20: return SENSOR_INTERVAL_DS18B20;
+    case SENSOR_DHT11: return SENSOR_INTERVAL_DHT11;
+    case SENSOR_DHT22: return SENSOR_INTERVAL_DHT22;
+    default: return 0;
+    }
+}
@@ -0,0 +1,204 @@
+/**
+ * @file sensordriver.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "sensordriver.h"
+
+/**
+ * @brief The 1-Wire commands of a DS18B20.
+ */
+#define DS18B20_SKIP_ROM 0xCC
+#define DS18B20_CONVERT_T 0x44
+#define DS18B20_READ_SCRATCHPAD 0xBE
+
+/**
+ * @brief Construct a new Ds18b20 object
+ *
+ * @param gpio the GPIO of the data line
+ */
+Ds18b20::Ds18b20( uint8 gpio )
+: m_Gpio( gpio )
+, m_State( DS18B20_RESET )
+, m_ConvertTime( 0 )
+, m_Length( 0 )
+{}
+
+/**
+ * @brief Release the 1-Wire bus.
+ */
+void Ds18b20::begin(){
+    m_Bus.begin( m_Gpio );
+}
+
+/**
+ * @brief Start a measurement.
+ */
+void Ds18b20::start( unsigned long ){
+    m_State = DS18B20_RESET;
+    m_Length = 0;
+}
+
+/**
+ * @brief Do the next step of the measurement, a reset takes 1 ms and a byte about 0.6 ms.
+ *
+ * @param now the time in ms
+ * @param values output buffer for the temperature in centidegrees
+ * @return SensorStep SENSOR_BUSY until the measurement is done or has failed
+ */
+SensorStep Ds18b20::step( unsigned long now, int *values ){
+    switch( m_State ){
+    case DS18B20_RESET:
+    case DS18B20_READ_RESET:
+        if( !m_Bus.reset() ) return SENSOR_FAILED;
+        m_State = m_State == DS18B20_RESET ? DS18B20_SKIP : DS18B20_READ_SKIP;
+        return SENSOR_BUSY;
+    case DS18B20_SKIP:
+    case DS18B20_READ_SKIP:
+        m_Bus.writeByte( DS18B20_SKIP_ROM );
+        m_State = m_State == DS18B20_SKIP ? DS18B20_CONVERT : DS18B20_READ_COMMAND;
+        return SENSOR_BUSY;
+    case DS18B20_CONVERT:
+        m_Bus.writeByte( DS18B20_CONVERT_T );
+        m_ConvertTime = now;
+        m_State = DS18B20_WAIT;
+        return SENSOR_BUSY;
+    case DS18B20_WAIT:
+        if( now - m_ConvertTime < DS18B20_CONVERSION_TIME ) return SENSOR_BUSY;
+        m_State = DS18B20_READ_RESET;
+        return SENSOR_BUSY;
+    case DS18B20_READ_COMMAND:
+        m_Bus.writeByte( DS18B20_READ_SCRATCHPAD );
+        m_Length = 0;
+        m_State = DS18B20_READ;
+        return SENSOR_BUSY;
+    case DS18B20_READ:
+        m_Scratchpad[m_Length++] = m_Bus.readByte();
+        if( m_Length < sizeof( m_Scratchpad ) ) return SENSOR_BUSY;
+        break;
+    }
+
+    // A line that is stuck low reads all zeros, which has a valid CRC as well
+    bool zero = true;
+    for( uint8 byte: m_Scratchpad ) if( byte ) zero = false;
+    if( zero || OneWire::crc8( m_Scratchpad, sizeof( m_Scratchpad ) ) != 0 ) return SENSOR_FAILED;
+
+    // The temperature is a signed 12 bit value in 1/16 degrees
+    int16_t raw = static_cast<int16_t>( m_Scratchpad[0] | m_Scratchpad[1] << 8 );
+    values[0] = raw * 100 / 16;
+    return SENSOR_DONE;
+}
+
+/**
+ * @brief Construct a new Dht Sensor object
+ *
+ * @param gpio the GPIO of the data line
+ * @param dht11 true for a DHT11, false for a DHT22
+ */
+DhtSensor::DhtSensor( uint8 gpio, bool dht11 )
+: m_Gpio( gpio )
+, m_Dht11( dht11 )
+, m_StartTime( 0 )
+{}
+
+/**
+ * @brief Release the line, the level is set before the mode so the line does not glitch low.
+ */
+void DhtSensor::begin(){
+    digitalWrite( m_Gpio, HIGH );
+    pinMode( m_Gpio, OUTPUT_OPEN_DRAIN );
+}
+
+/**
+ * @brief Start a measurement by pulling the line low.
+ *
+ * @param now the time in ms
+ */
+void DhtSensor::start( unsigned long now ){
+    digitalWrite( m_Gpio, LOW );
+    m_StartTime = now;
+}
+
+/**
+ * @brief Do the next step of the measurement: wait until the start signal is long enough, then read the answer.
+ * The start time has to pass by more than its ms, a millis() step can come right after the start.
+ *
+ * @param now the time in ms
+ * @param values output buffer for the temperature and the humidity
+ * @return SensorStep SENSOR_BUSY until the measurement is done or has failed
+ */
+SensorStep DhtSensor::step( unsigned long now, int *values ){
+    if( now - m_StartTime <= ( m_Dht11 ? DHT11_START_TIME : DHT22_START_TIME ) ) return SENSOR_BUSY;
+
+    uint8 data[5] = {};
+    if( !collect( data ) ) return SENSOR_FAILED;
+    if( static_cast<uint8>( data[0] + data[1] + data[2] + data[3] ) != data[4] ) return SENSOR_FAILED;
+
+    if( m_Dht11 ) {
+        // Integral and decimal parts, the sign is the top bit of the decimal temperature byte
+        values[1] = data[0] * 100 + data[1] * 10;
+        values[0] = data[2] * 100 + ( data[3] & 0x7F ) * 10;
+        if( data[3] & 0x80 ) values[0] = -values[0];
+    } else {
+        // Tenths, the temperature in sign and magnitude
+        values[1] = ( data[0] << 8 | data[1] ) * 10;
+        values[0] = ( ( data[2] & 0x7F ) << 8 | data[3] ) * 10;
+        if( data[2] & 0x80 ) values[0] = -values[0];
+    }
+    return SENSOR_DONE;
+}
+
+/**
+ * @brief Release the line and read the 5 bytes of the answer: the sensor pulls the line low for 80 us
+ * and releases it for 80 us, then every bit is 50 us low followed by 26 us (0) or 70 us (1) high.
+ *
+ * @return true if all bits have been received
+ */
+bool DhtSensor::collect( uint8 *data ){
+    digitalWrite( m_Gpio, HIGH );
+    if( waitLevel( LOW ) < 0 || waitLevel( HIGH ) < 0 || waitLevel( LOW ) < 0 ) return false;
+    for( uint8 i = 0; i < 40; i++ ){
+        noInterrupts();
+        int high = waitLevel( HIGH ) < 0 ? -1 : waitLevel( LOW );
+        interrupts();
+        if( high < 0 ) return false;
+        if( high > DHT_BIT_THRESHOLD ) data[i / 8] |= 0x80 >> ( i % 8 );
+    }
+    return true;
+}
+
+/**
+ * @brief Wait until the line has a level.
+ *
+ * @return int the time waited in us, -1 after DHT_LEVEL_TIMEOUT
+ */
+int DhtSensor::waitLevel( uint8 level ){
+    unsigned long start = micros();
+    while( digitalRead( m_Gpio ) != level ){
+        if( micros() - start > DHT_LEVEL_TIMEOUT ) return -1;
+    }
+    return micros() - start;
+}
@@ -0,0 +1,364 @@
+/**
+ * @file seriallink.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "seriallink.h"
+#include "nodemcu.h"
+#include "logger.h"
+
+/**
+ * @brief Calculate the CRC-16/CCITT-FALSE checksum (polynomial 0x1021, initial value 0xFFFF).
+ * 
+ * @param data the bytes to check
+ * @param length the amount of bytes
+ * @return uint16 the checksum
+ */
+static uint16 crc16( const uint8_t *data, size_t length ){
+    uint16 crc = 0xFFFF;
+    while( length-- ){
+        crc ^= static_cast<uint16>( *data++ ) << 8;
+        for( uint i = 0; i < 8; i++ ) crc = crc & 0x8000 ? ( crc << 1 ) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+/**
+ * @brief COBS encode a packet so it contains no 0x00 bytes.
+ * 
+ * @param in the packet bytes
+ * @param length the amount of packet bytes
+ * @param out output buffer, must hold length + length / 254 + 1 bytes
+ * @return size_t amount of encoded bytes
+ */
+static size_t cobsEncode( const uint8_t *in, size_t length, uint8_t *out ){
+    size_t write = 1;
+    size_t codeIndex = 0;
+    uint8_t code = 1;
+    for( size_t read = 0; read < length; read++ ){
+        if( in[read] == 0 ) {
+            out[codeIndex] = code;
+            code = 1;
+            codeIndex = write++;
+        } else {
+            out[write++] = in[read];
+            if( ++code == 0xFF ) {
+                out[codeIndex] = code;
+                code = 1;
+                codeIndex = write++;
+            }
+        }
+    }
+    out[codeIndex] = code;
+    return write;
+}
+
+/**
+ * @brief Decode a COBS encoded packet.
+ * 
+ * @param in the encoded bytes, without the 0x00 delimiter
+ * @param length the amount of encoded bytes
+ * @param out output buffer, must hold length bytes
+ * @return size_t amount of decoded bytes, 0 if the encoding is invalid
+ */
+static size_t cobsDecode( const uint8_t *in, size_t length, uint8_t *out ){
+    size_t read = 0;
+    size_t write = 0;
+    while( read < length ){
+        uint8_t code = in[read++];
+        if( code == 0 || read + code - 1 > length ) return 0;
+        for( uint8_t i = 1; i < code; i++ ) out[write++] = in[read++];
+        if( code != 0xFF && read < length ) out[write++] = 0;
+    }
+    return write;
+}
+
+/**
+ * @brief Construct a new Serial Link object
+ * 
+ * @param nodeMCU instance to the NodeMCU singleton
+ * @param metrics instance pointer to the metrics counters
+ * @param baudRate the baud rate of the text mode
+ */
+SerialLink::SerialLink( NodeMCU *nodeMCU, Metrics *metrics, const uint &baudRate )
+: m_NodeMCU( nodeMCU )
+, m_Metrics( metrics )
+, m_TextBaud( baudRate )
+, m_Binary( false )
+, m_ModePending( false )
+, m_PendingBinary( false )
+, m_PendingBaud( baudRate )
+, m_RxLength( 0 )
+, m_RxOverflow( false )
+, m_LineLength( 0 )
+, m_LineStart( 0 )
+, m_LineOverflow( false )
+{}
+
+/**
+ * @brief Return if the serial port is in binary mode.
+ */
+bool SerialLink::isBinary(){
+    return m_Binary;
+}
+
+/**
+ * @brief Execute a serial command, the mode change is applied after the reply has been sent.
+ * serial binary [baud] switches to binary mode, serial text switches back.
+ * 
+ * @param command commands and arguments
+ * @return uint16 result code
+ */
+uint16 SerialLink::configure( const std::vector<String> &command ){
+    if( command.size() < 2 ) return ERROR_SERIAL;
+
+    if( command[1].equalsIgnoreCase( "binary" ) ) {
+        uint32 baud = command.size() > 2 ? command[2].toInt() : SERIAL_BINARY_BAUD;
+        if( baud < 9600 || baud > 4000000 ) return ERROR_SERIAL;
+        m_PendingBinary = true;
+        m_PendingBaud = baud;
+    } else if( command[1].equalsIgnoreCase( "text" ) ) {
+        m_PendingBinary = false;
+        m_PendingBaud = m_TextBaud;
+    } else {
+        return ERROR_SERIAL;
+    }
+    m_ModePending = true;
+    return SUCCESS;
+}
+
+/**
+ * @brief Switch to the requested mode and baud rate if a change is pending.
+ */
+void SerialLink::applyMode(){
+    if( !m_ModePending ) return;
+    m_ModePending = false;
+
+    // Text log messages still belong to the old mode and baud rate
+    Log.drain();
+    Serial.flush();
+    Serial.updateBaudRate( m_PendingBaud );
+    m_Binary = m_PendingBinary;
+    Log.Framed = m_Binary;
+    m_RxLength = 0;
+    m_RxOverflow = false;
+    LOG_INFO( LOG_NODEMCU, "SerialLink::applyMode: Switched to %s mode at %u baud.", m_Binary ? "binary" : "text", m_PendingBaud );
+}
+
+/**
+ * @brief Return to text mode and drop what has been received, for when the UART has been used by something else.
+ * The baud rate is left to the caller.
+ */
+void SerialLink::reset(){
+    m_ModePending = false;
+    m_Binary = false;
+    Log.Framed = false;
+    m_RxLength = 0;
+    m_RxOverflow = false;
+    m_LineLength = 0;
+    m_LineOverflow = false;
+}
+
+/**
+ * @brief Read available bytes in text mode until a command line is complete.
+ * Never waits for bytes that have not arrived yet, a line that is too long or
+ * incomplete for longer than SERIAL_LINE_TIMEOUT is discarded.
+ * 
+ * @param command output buffer for the command and arguments of a complete line
+ * @return uint16 result code
+ */
+uint16 SerialLink::readLine( std::vector<String> &command ){
+    uint16 result = SUCCESS;
+    size_t received = 0;
+
+    // Stop at the end of a line, the next line stays in the UART buffer for the next loop
+    while( Serial.available() > 0 ){
+        char c = Serial.read();
+        received++;
+
+        if( c == '\n' ) {
+            if( m_LineOverflow ) {
+                LOG_WARN( LOG_NODEMCU, "SerialLink::readLine: Discarded command line longer than %u bytes.", SERIAL_LINE_SIZE );
+                result = ERROR_SERIAL;
+            } else {
+                String line;
+                line.concat( m_Line, m_LineLength );
+                splitCommand( line, command );
+            }
+            m_LineLength = 0;
+            m_LineOverflow = false;
+            break;
+        }
+        if( c == '\r' ) continue;
+
+        if( !m_LineLength && !m_LineOverflow ) m_LineStart = millis();
+        if( m_LineLength < sizeof( m_Line ) ) m_Line[m_LineLength++] = c;
+        else m_LineOverflow = true;
+    }
+    m_Metrics->countBytesIn( PROTOCOL_SERIAL, received );
+
+    // Dont keep a half line forever, the rest of it is probably lost
+    if( ( m_LineLength || m_LineOverflow ) && millis() - m_LineStart > SERIAL_LINE_TIMEOUT ) {
+        LOG_WARN( LOG_NODEMCU, "SerialLink::readLine: Discarded incomplete command line." );
+        m_LineLength = 0;
+        m_LineOverflow = false;
+        result = ERROR_SERIAL;
+    }
+    return result;
+}
+
+/**
+ * @brief Read available bytes and execute every complete command frame.
+ * 
+ * @return uint16 result code
+ */
+uint16 SerialLink::update(){
+    uint16 result = SUCCESS;
+    size_t received = 0;
+
+    // Read byte by byte, a frame can switch back to text mode and the following bytes belong to it
+    while( m_Binary && Serial.available() > 0 ){
+        uint8_t c = Serial.read();
+        received++;
+
+        // A 0x00 byte ends the frame
+        if( c == 0 ) {
+            if( m_RxOverflow ) result = ERROR_SERIAL;
+            else if( m_RxLength ) result = handleFrame();
+            m_RxLength = 0;
+            m_RxOverflow = false;
+        } else if( m_RxLength < sizeof( m_RxBuffer ) ) {
+            m_RxBuffer[m_RxLength++] = c;
+        } else {
+            m_RxOverflow = true;
+        }
+    }
+    m_Metrics->countBytesIn( PROTOCOL_SERIAL, received );
+    return result;
+}
+
+/**
+ * @brief Decode, check and execute a received frame.
+ * 
+ * @return uint16 result code
+ */
+uint16 SerialLink::handleFrame(){
+    uint8_t packet[SERIAL_FRAME_SIZE];
+    size_t length = cobsDecode( m_RxBuffer, m_RxLength, packet );
+
+    // channel, sequence and CRC are always present
+    if( length < 4 ) return ERROR_SERIAL;
+    uint16 crc = ( packet[length - 2] << 8 ) | packet[length - 1];
+    if( crc16( packet, length - 2 ) != crc || packet[0] != CHANNEL_COMMAND ) return ERROR_SERIAL;
+
+    String line;
+    line.concat( reinterpret_cast<const char*>( packet + 2 ), length - 4 );
+    std::vector<String> command;
+    splitCommand( line, command );
+    if( !command.size() ) return ERROR_SERIAL;
+
+    FrameWriter reply( this, packet[1] );
+    reply.finish( m_NodeMCU->execute_command( command, PROTOCOL_SERIAL, reply ) );
+    applyMode();
+    return SUCCESS;
+}
+
+/**
+ * @brief Send buffered log messages as log frames as far as the UART has room for them.
+ */
+void SerialLink::flushLog(){
+    char payload[SERIAL_LOG_PAYLOAD];
+    while( m_Binary && Serial.availableForWrite() >= SERIAL_LOG_PAYLOAD + 8 ){
+        size_t length = Log.read( payload, sizeof( payload ) );
+        if( !length ) return;
+        sendFrame( CHANNEL_LOG, 0, reinterpret_cast<const uint8_t*>( payload ), length );
+    }
+}
+
+/**
+ * @brief Encode and send a frame.
+ * 
+ * @param channel the channel ID
+ * @param sequence the sequence number of the command the frame belongs to
+ * @param payload the payload bytes
+ * @param length the amount of payload bytes
+ */
+void SerialLink::sendFrame( uint8 channel, uint8 sequence, const uint8_t *payload, size_t length ){
+    uint8_t packet[SERIAL_FRAME_PAYLOAD + 4];
+    uint8_t frame[SERIAL_FRAME_SIZE];
+    if( length > SERIAL_FRAME_PAYLOAD ) length = SERIAL_FRAME_PAYLOAD;
+
+    packet[0] = channel;
+    packet[1] = sequence;
+    memcpy( packet + 2, payload, length );
+    uint16 crc = crc16( packet, length + 2 );
+    packet[length + 2] = crc >> 8;
+    packet[length + 3] = crc & 0xFF;
+
+    size_t size = cobsEncode( packet, length + 4, frame );
+    frame[size++] = 0;
+    Serial.write( frame, size );
+    m_Metrics->countBytesOut( PROTOCOL_SERIAL, size );
+}
+
+/**
+ * @brief Construct a new Frame Writer object
+ * 
+ * @param link the serial link to send the frames on
+ * @param sequence the sequence number of the command
+ */
+FrameWriter::FrameWriter( SerialLink *link, uint8 sequence )
+: m_Link( link )
+, m_Sequence( sequence )
+, m_Length( 2 )
+{}
+
+size_t FrameWriter::write( uint8_t c ){
+    // The first two bytes are kept for the result code of the final frame
+    if( m_Length == sizeof( m_Buffer ) ) {
+        m_Link->sendFrame( CHANNEL_REPLY_DATA, m_Sequence, m_Buffer + 2, m_Length - 2 );
+        m_Length = 2;
+    }
+    m_Buffer[m_Length++] = c;
+    return 1;
+}
+
+size_t FrameWriter::write( const uint8_t *buffer, size_t size ){
+    for( size_t i = 0; i < size; i++ ) write( buffer[i] );
+    return size;
+}
+
+/**
+ * @brief Send the final reply frame with the result code and the remaining text.
+ * 
+ * @param result the result code of the command
+ */
+void FrameWriter::finish( uint16 result ){
+    m_Buffer[0] = result >> 8;
+    m_Buffer[1] = result & 0xFF;
+    m_Link->sendFrame( CHANNEL_REPLY, m_Sequence, m_Buffer, m_Length );
+    m_Length = 2;
+}
@@ -29,19 +29,32 @@
 #include "tcpclient.h"
 #include "command.h"
 #include "nodemcu.h"
+#include "logger.h"
+#include "responsewriter.h"
 
 /**
  * @brief Construct a new Tcp Client object
  * 
  * @param m_WifiClient The ESP8266 WiFiClient retrieed from a WiFiSerer
+ * @param id the unique id of the connection
  */
-TcpClient::TcpClient( ConfigControl *configControl, WiFiClient wificlient )
-: m_ConfigControl( configControl )
+TcpClient::TcpClient( ConfigControl *configControl, Metrics *metrics, WiFiClient wificlient, uint32 id )
+: Id( id )
+, Deficit( 0 )
+, Commands( 0 )
+, BytesIn( 0 )
+, BytesOut( 0 )
+, Throttled( 0 )
+, m_ConfigControl( configControl )
+, m_Metrics( metrics )
 , m_WifiClient( wificlient )
-, m_InActiveTime( 0 )
+, m_Length( 0 )
+, m_Overflow( false )
+, m_Throttled( false )
 {
-    Serial.println( "TcpClient: A TCP connection has been esthablished" );
+    LOG_INFO( LOG_TCP, "TcpClient: A TCP connection has been esthablished" );
     m_ActiveTime = millis();
+    m_ConnectTime = m_ActiveTime;
 }
 
 /**
@@ -51,53 +64,138 @@ TcpClient::~TcpClient()
 {}
 
 /**
- * @brief Read client data and execute the command
+ * @brief Read the data that has arrived without waiting, as far as the receive buffer has room.
+ * The rest stays in the TCP window, so a client that sends too much is slowed down by flow control.
  * 
- * @return uint16 result code
+ * @return uint16 result code, ERROR_CLIENT_DISCONNECTED when the connection is closed
  */
-uint16 TcpClient::handleCommand( NodeMCU *nodeMCU ){
-    // Check if connection has data
-    if( !m_WifiClient.available() ) {
-        m_InActiveTime = millis() - m_ActiveTime;
-        if( !isActive() ){
-            m_WifiClient.stop();
-            Serial.println( "TcpClient::handleCommand: Connection timed out and terminated." );
-            return ERROR_CLIENT_DISCONNECTED;
+uint16 TcpClient::receive(){
+    int available = m_WifiClient.available();
+    if( available > 0 && m_Length < sizeof( m_Buffer ) ) {
+        int received = m_WifiClient.read( reinterpret_cast<uint8_t*>( m_Buffer ) + m_Length, std::min<size_t>( available, sizeof( m_Buffer ) - m_Length ) );
+        if( received > 0 ) {
+            m_Length += received;
+            BytesIn += received;
+            m_Metrics->countBytesIn( PROTOCOL_TCP, received );
+            m_ActiveTime = millis();
         }
-        return SUCCESS;
     }
 
-    // Read the incoming command from the client
-    std::vector<String> command;
-    String receivedData = m_WifiClient.readStringUntil('\n');
-
-    // Check if there is data else increase the inactive time or terminate the connection if timed out
-    if( !receivedData.length() ){
-        m_InActiveTime = millis() - m_ActiveTime;
-        if( !isActive() ){
-            m_WifiClient.stop();
-            Serial.println( "TcpClient::handleCommand: Connection timed out and terminated." );
-            return ERROR_CLIENT_DISCONNECTED;
+    // A line longer than the buffer is discarded up to its end, its reply is an error
+    if( m_Overflow || ( m_Length == sizeof( m_Buffer ) && !pendingCommand() ) ) {
+        char *end = static_cast<char*>( memchr( m_Buffer, '\n', m_Length ) );
+        if( !m_Overflow ) LOG_WARN( LOG_TCP, "TcpClient::receive: Discarded command line longer than %u bytes.", TCP_LINE_SIZE );
+        m_Overflow = !end;
+        size_t discarded = end ? end - m_Buffer + 1 : m_Length;
+        memmove( m_Buffer, m_Buffer + discarded, m_Length - discarded );
+        m_Length -= discarded;
+        if( !m_Overflow ) {
+            MeteredPrint reply( m_WifiClient, m_Metrics, PROTOCOL_TCP );
+            reply.printf( "=%04X\n", ERROR_TCP );
+            BytesOut += reply.written();
         }
-        return SUCCESS;
     }
 
-    // Convert the receive data in to a vector of command and arguments 
-    while( receivedData.length() > 0 ) {
-        int spaceIndex = receivedData.indexOf(' ');
-        if( spaceIndex == -1 ) {
-            receivedData.trim();
-            command.push_back( receivedData );
-            receivedData = "";
-        } else {
-            command.push_back( receivedData.substring( 0, spaceIndex ) );
-            receivedData = receivedData.substring( spaceIndex + 1 );
-        }
+    // Commands that were received before the connection closed are still executed
+    if( !pendingCommand() && !m_WifiClient.available() && !m_WifiClient.connected() ) {
+        m_WifiClient.stop();
+        LOG_INFO( LOG_TCP, "TcpClient::receive: Connection closed by the client." );
+        return ERROR_CLIENT_DISCONNECTED;
     }
-    // Execute the command
-    m_ActiveTime = millis();
-    return nodeMCU->execute_command( command );
-    
+    return SUCCESS;
+}
+
+/**
+ * @brief Close the connection.
+ * 
+ * @param result the result code sent to the client as reason, nothing is sent for SUCCESS
+ */
+void TcpClient::stop( uint16 result ){
+    if( result != SUCCESS ) {
+        MeteredPrint reply( m_WifiClient, m_Metrics, PROTOCOL_TCP );
+        reply.printf( "=%04X\n", result );
+        BytesOut += reply.written();
+    }
+    m_WifiClient.stop();
+}
+
+/**
+ * @brief Return the time (in ms) since data has been received.
+ */
+unsigned long TcpClient::idleTime() const {
+    return millis() - m_ActiveTime;
+}
+
+/**
+ * @brief Return the size of the next complete command line.
+ * 
+ * @return size_t the size including the newline, 0 if no line is complete
+ */
+size_t TcpClient::pendingCommand() const {
+    if( m_Overflow ) return 0;
+    const char *end = static_cast<const char*>( memchr( m_Buffer, '\n', m_Length ) );
+    return end ? end - m_Buffer + 1 : 0;
+}
+
+/**
+ * @brief Check the command and bandwidth limits of the client.
+ * A command that has to wait is counted as throttled once.
+ * 
+ * @return true if the next command may be executed
+ */
+bool TcpClient::allowed(){
+    // The bandwidth is paid afterwards, a client in debt waits until it is paid off
+    bool allowed = m_CommandRate.available( m_ConfigControl->ClientRate ) && m_ByteRate.available( m_ConfigControl->ClientBandwidth, 0 );
+    if( !allowed && !m_Throttled ) {
+        Throttled++;
+        m_Metrics->TcpThrottled++;
+    }
+    m_Throttled = !allowed;
+    return allowed;
+}
+
+/**
+ * @brief Execute the next complete command line and send the reply.
+ * 
+ * @return uint16 result code
+ */
+uint16 TcpClient::handleCommand( NodeMCU *nodeMCU ){
+    size_t size = pendingCommand();
+    if( !size ) return SUCCESS;
+
+    // Take the line out of the buffer and convert it in to a vector of command and arguments
+    std::vector<String> command;
+    String receivedData;
+    receivedData.concat( m_Buffer, size - 1 );
+    memmove( m_Buffer, m_Buffer + size, m_Length - size );
+    m_Length -= size;
+    receivedData.trim();
+    if( !receivedData.length() ) return SUCCESS;
+    splitCommand( receivedData, command );
+
+    // Execute the command, the reply is sent in chunks instead of a write for every line
+    ResponseWriter response( m_WifiClient );
+    MeteredPrint reply( response, m_Metrics, PROTOCOL_TCP );
+    uint16 result = nodeMCU->execute_command( command, PROTOCOL_TCP, reply );
+
+    // The result line ends the reply, so a client can send the next commands without waiting
+    reply.printf( "=%04X\n", result );
+    Commands++;
+    BytesOut += reply.written();
+    m_CommandRate.take( m_ConfigControl->ClientRate );
+    m_ByteRate.take( m_ConfigControl->ClientBandwidth, size + reply.written() );
+    return result;
+}
+
+/**
+ * @brief Print the address and the counters of the client on one line.
+ * 
+ * @param out the output to print to
+ */
+void TcpClient::print( Print &out ){
+    out.printf( "#%u %s:%u connected %lu s, idle %lu ms, commands %u, throttled %u, in %u B, out %u B, queued %u B\n",
+        Id, m_WifiClient.remoteIP().toString().c_str(), m_WifiClient.remotePort(), ( millis() - m_ConnectTime ) / 1000,
+        idleTime(), Commands, Throttled, BytesIn, BytesOut, static_cast<uint>( m_Length ) );
 }
 
 /**
@@ -107,5 +205,5 @@ uint16 TcpClient::handleCommand( NodeMCU *nodeMCU ){
  * @return false if last command was longer then 5 minutes in the past
  */
 bool TcpClient::isActive(){
-    return m_InActiveTime < m_ConfigControl->InActiveTimeout;
+    return idleTime() < m_ConfigControl->InActiveTimeout;
 }
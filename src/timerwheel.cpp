@@ -0,0 +1,80 @@
+/**
+ * @file timerwheel.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "timerwheel.h"
+
+/**
+ * @brief Construct a new Timer Wheel object
+ * 
+ * @param resolution the time (in ms) of one slot
+ */
+TimerWheel::TimerWheel( uint32 resolution )
+: m_Resolution( resolution ? resolution : 1 )
+, m_Current( 0 )
+, m_Tick( millis() )
+{}
+
+/**
+ * @brief Start a timer.
+ * 
+ * @param id the id that is returned when the timer expires
+ * @param delay the time (in ms) until the timer expires, rounded up to the resolution
+ */
+void TimerWheel::schedule( uint32 id, uint32 delay ){
+    // The current tick already started, so it counts as the first slot
+    uint32 ticks = ( delay + m_Resolution - 1 ) / m_Resolution;
+    if( !ticks ) ticks = 1;
+    m_Slots[( m_Current + ticks ) % TIMER_WHEEL_SLOTS].push_back( { id, ( ticks - 1 ) / TIMER_WHEEL_SLOTS } );
+}
+
+/**
+ * @brief Collect the timers that expired since the last call.
+ * 
+ * @param ids output buffer for the ids of the expired timers
+ * @return true if a timer expired
+ */
+bool TimerWheel::expired( std::vector<uint32> &ids ){
+    unsigned long now = millis();
+    while( now - m_Tick >= m_Resolution ){
+        m_Tick += m_Resolution;
+        m_Current = ( m_Current + 1 ) % TIMER_WHEEL_SLOTS;
+
+        // Timers that still have turns to go stay in the slot
+        std::vector<Timer> &slot = m_Slots[m_Current];
+        for( size_t i = 0; i < slot.size(); ){
+            if( slot[i].turns ) {
+                slot[i++].turns--;
+                continue;
+            }
+            ids.push_back( slot[i].id );
+            slot[i] = slot.back();
+            slot.pop_back();
+        }
+    }
+    return ids.size();
+}
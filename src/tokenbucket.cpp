@@ -0,0 +1,83 @@
+/**
+ * @file tokenbucket.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "tokenbucket.h"
+
+/**
+ * @brief Construct a new full Token Bucket object
+ */
+TokenBucket::TokenBucket()
+: m_Tokens( 0 )
+, m_Refilled( millis() - 1000 )
+{}
+
+/**
+ * @brief Check if tokens are available.
+ * 
+ * @param rate the tokens per second, 0 for no limit
+ * @param tokens the amount of tokens that are needed
+ * @return true if the tokens are available or there is no limit
+ */
+bool TokenBucket::available( uint32 rate, uint32 tokens ){
+    if( !rate ) return true;
+    refill( rate );
+    return m_Tokens >= static_cast<sint32>( std::min( tokens, rate ) );
+}
+
+/**
+ * @brief Take tokens from the bucket, the bucket can get in debt.
+ * 
+ * @param rate the tokens per second, 0 for no limit
+ * @param tokens the amount of tokens to take
+ */
+void TokenBucket::take( uint32 rate, uint32 tokens ){
+    if( !rate ) return;
+    refill( rate );
+    m_Tokens -= static_cast<sint32>( std::min<uint32>( tokens, INT32_MAX / 2 ) );
+    if( m_Tokens < -INT32_MAX / 2 ) m_Tokens = -INT32_MAX / 2;
+}
+
+/**
+ * @brief Add the tokens of the time that passed since the last refill.
+ * 
+ * @param rate the tokens per second
+ */
+void TokenBucket::refill( uint32 rate ){
+    unsigned long now = millis();
+    sint32 burst = static_cast<sint32>( std::min<uint32>( rate, INT32_MAX / 2 ) );
+
+    // Only whole tokens are added, the time of a partial token is kept for the next refill
+    uint64_t tokens = static_cast<uint64_t>( now - m_Refilled ) * rate / 1000;
+    if( m_Tokens + static_cast<int64_t>( tokens ) >= burst ) {
+        m_Tokens = burst;
+        m_Refilled = now;
+    } else if( tokens ) {
+        m_Tokens += tokens;
+        m_Refilled += tokens * 1000 / rate;
+    }
+}
@@ -0,0 +1,233 @@
+/**
+ * @file udpserver.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "udpserver.h"
+#include "nodemcu.h"
+#include <StreamString.h>
+#include "logger.h"
+
+/**
+ * @brief Construct a new Udp Server object
+ *
+ * @param nodeMCU instance to the NodeMCU singleton
+ * @param configControl instance pointer to the cofiguration control of the flash memory
+ * @param metrics instance pointer to the metrics counters
+ */
+UdpServer::UdpServer( NodeMCU *nodeMCU, ConfigControl *configControl, Metrics *metrics )
+: m_NodeMCU( nodeMCU )
+, m_ConfigControl( configControl )
+, m_Metrics( metrics )
+, m_Started( false )
+{
+    for( UdpSource &source: m_Sources ) source = UdpSource();
+}
+
+/**
+ * @brief Start listening on the UDP port and join the multicast group of the configuration.
+ *
+ * @return uint16 result code
+ */
+uint16 UdpServer::begin(){
+    stop();
+    bool started = m_ConfigControl->MulticastGroup.isSet()
+        ? m_Udp.beginMulticast( WiFi.localIP(), m_ConfigControl->MulticastGroup, m_ConfigControl->PortUDP )
+        : m_Udp.begin( m_ConfigControl->PortUDP );
+    if( !started ) {
+        LOG_ERROR( LOG_WIFI, "UdpServer::begin: Failed to listen on UDP port %u.", m_ConfigControl->PortUDP );
+        return ERROR_UDP;
+    }
+    m_Started = true;
+    LOG_INFO( LOG_WIFI, "UdpServer::begin: UDP server started on port %u, multicast group: %s.", m_ConfigControl->PortUDP,
+        m_ConfigControl->MulticastGroup.isSet() ? m_ConfigControl->MulticastGroup.toString().c_str() : "none" );
+    return SUCCESS;
+}
+
+/**
+ * @brief Stop listening.
+ */
+void UdpServer::stop(){
+    if( m_Started ) m_Udp.stop();
+    m_Started = false;
+    for( UdpSource &source: m_Sources ) source = UdpSource();
+}
+
+/**
+ * @brief Handle the datagrams that have arrived, at most UDP_PACKETS_PER_LOOP.
+ *
+ * @return uint16 result code
+ */
+uint16 UdpServer::update(){
+    if( !m_Started ) return SUCCESS;
+
+    uint16 result = SUCCESS;
+    for( uint packets = 0; packets < UDP_PACKETS_PER_LOOP; packets++ ){
+        int size = m_Udp.parsePacket();
+        if( size <= 0 ) break;
+
+        uint8_t *packet = m_Packet;
+        size_t length = m_Udp.read( packet, sizeof( m_Packet ) );
+        m_Metrics->countBytesIn( PROTOCOL_UDP, size );
+        if( length < UDP_HEADER_SIZE || packet[0] != UDP_MAGIC || ( packet[1] & UDP_FLAG_REPLY )
+            || size > ( packet[4] == UDP_PIXELS ? UDP_MAX_PACKET_SIZE : UDP_PACKET_SIZE ) ) {
+            m_Metrics->UdpInvalid++;
+            result = ERROR_UDP;
+            continue;
+        }
+
+        uint8 flags = packet[1];
+        uint16 sequence = packet[2] << 8 | packet[3];
+        uint8 operation = packet[4];
+        uint8_t reply[UDP_PACKET_SIZE] = { UDP_MAGIC, static_cast<uint8_t>( flags | UDP_FLAG_REPLY ), packet[2], packet[3], operation };
+
+        // A write is only executed once, a repeated write gets the result of the first one again
+        UdpSource *source = nullptr;
+        if( !accept( sequence, flags & UDP_FLAG_SYNC, source ) ) {
+            m_Metrics->UdpDuplicates++;
+            if( operation != UDP_READ && source->sequence == sequence && ( flags & UDP_FLAG_ACK ) ) {
+                reply[UDP_HEADER_SIZE] = source->result >> 8;
+                reply[UDP_HEADER_SIZE + 1] = source->result & 0xFF;
+                sendReply( reply, UDP_HEADER_SIZE + 2 );
+            }
+            continue;
+        }
+
+        size_t replyLength = execute( flags, operation, packet + UDP_HEADER_SIZE, length - UDP_HEADER_SIZE, reply );
+        source->result = reply[UDP_HEADER_SIZE] << 8 | reply[UDP_HEADER_SIZE + 1];
+        m_Metrics->UdpPackets++;
+        if( operation == UDP_READ || ( flags & UDP_FLAG_ACK ) ) sendReply( reply, replyLength );
+    }
+    return result;
+}
+
+/**
+ * @brief Check the sequence number of a datagram against the last one of its sender.
+ *
+ * @param sequence the sequence number of the datagram
+ * @param sync true if the sender started a new sequence
+ * @param source output pointer to the sender
+ * @return true if the datagram is new, false if it is a duplicate or out of order
+ */
+bool UdpServer::accept( uint16 sequence, bool sync, UdpSource *&source ){
+    IPAddress ip = m_Udp.remoteIP();
+    uint16 port = m_Udp.remotePort();
+    unsigned long now = millis();
+
+    // Find the sender, a new sender replaces the one that was silent for the longest time
+    source = nullptr;
+    UdpSource *oldest = &m_Sources[0];
+    for( uint i = 0; i < UDP_SOURCES; i++ ){
+        UdpSource &candidate = m_Sources[i];
+        if( candidate.used && candidate.ip == ip && candidate.port == port ) source = &candidate;
+        if( !candidate.used || ( oldest->used && now - candidate.lastSeen > now - oldest->lastSeen ) ) oldest = &candidate;
+    }
+
+    // Sequence numbers wrap around, a datagram is newer when it is less than half the range ahead.
+    // A sender that starts a new sequence is accepted as long as it is not a copy of its last datagram
+    bool known = source && now - source->lastSeen < UDP_SOURCE_TIMEOUT;
+    if( known && ( sync ? sequence == source->sequence : static_cast<int16_t>( sequence - source->sequence ) <= 0 ) ) return false;
+
+    if( !source ) {
+        source = oldest;
+        source->ip = ip;
+        source->port = port;
+        source->used = true;
+    }
+    source->sequence = sequence;
+    source->lastSeen = now;
+    return true;
+}
+
+/**
+ * @brief Execute the pins or pixels of a datagram and build the reply.
+ *
+ * @param flags the flags of the datagram
+ * @param operation the operation of the datagram
+ * @param data the pin data after the header
+ * @param length the length of the pin data
+ * @param reply output buffer for the reply, the header is already filled in
+ * @return size_t the length of the reply
+ */
+size_t UdpServer::execute( uint8 flags, uint8 operation, const uint8_t *data, size_t length, uint8_t *reply ){
+    uint16 result = SUCCESS;
+    size_t replyLength = UDP_HEADER_SIZE + 2;
+    if( operation == UDP_PIXELS ) {
+        result = m_NodeMCU->execute_pixels( data, length, flags & UDP_FLAG_SHOW, PROTOCOL_UDP );
+        reply[UDP_HEADER_SIZE] = result >> 8;
+        reply[UDP_HEADER_SIZE + 1] = result & 0xFF;
+        return replyLength;
+    }
+
+    size_t itemSize = operation == UDP_WRITE ? 3 : 1;
+    StreamString output;
+    std::vector<String> write = { "write" };
+
+    // A read replies 3 bytes per pin, more than UDP_MAX_PINS would not fit the reply buffer
+    if( ( operation != UDP_WRITE && operation != UDP_READ ) || !length || length % itemSize || length / itemSize > UDP_MAX_PINS ) {
+        m_Metrics->UdpInvalid++;
+        result = ERROR_UDP;
+        length = 0;
+    }
+    for( size_t i = 0; i < length; i += itemSize ){
+        auto pin = m_ConfigControl->pinData.find( static_cast<PinId>( data[i] ) );
+        if( pin == m_ConfigControl->pinData.end() ) {
+            if( operation == UDP_WRITE ) {
+                result = PIN_ERROR;
+                break;
+            }
+            result = ERROR_READ;
+            continue;
+        }
+
+        // The pins of a write are collected and set at once
+        if( operation == UDP_WRITE ) {
+            write.push_back( pin->second.name + "=" + String( data[i + 1] << 8 | data[i + 2] ) );
+            continue;
+        }
+        uint16 pinResult = m_NodeMCU->execute_command( { "read", pin->second.name }, PROTOCOL_UDP, output );
+        uint16 value = pin->second.value;
+        reply[replyLength++] = data[i];
+        reply[replyLength++] = value >> 8;
+        reply[replyLength++] = value & 0xFF;
+        if( pinResult != SUCCESS ) result = pinResult;
+        output.clear();
+    }
+    if( result == SUCCESS && write.size() > 1 ) result = m_NodeMCU->execute_command( write, PROTOCOL_UDP, output );
+    reply[UDP_HEADER_SIZE] = result >> 8;
+    reply[UDP_HEADER_SIZE + 1] = result & 0xFF;
+    return replyLength;
+}
+
+/**
+ * @brief Send a reply to the sender of the current datagram.
+ */
+void UdpServer::sendReply( const uint8_t *reply, size_t length ){
+    m_Udp.beginPacket( m_Udp.remoteIP(), m_Udp.remotePort() );
+    m_Udp.write( reply, length );
+    m_Udp.endPacket();
+    m_Metrics->countBytesOut( PROTOCOL_UDP, length );
+}
@@ -28,16 +28,32 @@
  */
 #include "wificontrol.h"
 #include "nodemcu.h"
+#include <StreamString.h>
+#include <algorithm>
+#include "logger.h"
 
 /**
  * @brief Construct a new Wifi Control:: Wifi Control object
  * @param nodeMCU instance to the NodeMCU singleton
- * @param maxClients maximum allowed client connections
+ * @param configControl instance pointer to the cofiguration control of the flash memory
+ * @param metrics instance pointer to the metrics counters
  */
-WifiControl::WifiControl( NodeMCU *nodeMCU, ConfigControl *configControl )
+WifiControl::WifiControl( NodeMCU *nodeMCU, ConfigControl *configControl, Metrics *metrics )
 : m_NodeMCU( nodeMCU ) 
+, m_NextClient( 0 )
+, m_NextClientId( 0 )
+, m_Timeouts( TCP_TIMEOUT_RESOLUTION )
+, m_TcpServer( nullptr )
+, m_HttpServer( nullptr )
+, m_UdpServer( nodeMCU, configControl, metrics )
+, m_UdpServerChanged( true )
+, m_TcpServerStarted( false )
+, m_HttpServerStarted( false )
 , m_ConfigControl( configControl )
+, m_Metrics( metrics )
 , m_ConnectRetries( 0 )
+, m_Connecting( false )
+, m_ConnectStart( 0 )
 {}
 
 /**
@@ -56,10 +72,9 @@ uint16 WifiControl::connect(){
     // Check if MAX retries has been reached to skipp connecting to wifi (so that erial communication wont be delayed with connecting to wifi)
     if( m_ConnectRetries >= MAX_RETRY ) return ERROR_WIFI_CONNECTION;
 
-    if( WiFi.status() != WL_CONNECTED ){
+    if( WiFi.status() != WL_CONNECTED && !m_Connecting ){
         if( !WiFi.config( m_ConfigControl->StaticIP, m_ConfigControl->Gateway, m_ConfigControl->Subnet, m_ConfigControl->DnsPrimary, m_ConfigControl->DnsSecundary ) ){
-            Serial.println( "WifiControl::connect: STA configuration failed" );
-            Serial.printf( "\tStatic IP: %s\n\tSubnet: %s\n\tGateway: %s\n\tPrimary DNS: %s\n\tSecundary DNS: %s\n"
+            LOG_ERROR( LOG_WIFI, "WifiControl::connect: STA configuration failed (Static IP: %s, Subnet: %s, Gateway: %s, Primary DNS: %s, Secundary DNS: %s)"
                 , m_ConfigControl->StaticIP.toString().c_str()
                 , m_ConfigControl->Gateway.toString().c_str()
                 , m_ConfigControl->Subnet.toString().c_str()
@@ -69,23 +84,34 @@ uint16 WifiControl::connect(){
             return ERROR_WIFI_CONFIG;
         }
 
-        Serial.print( "WifiControl::connect Connecting to " );
-        Serial.print( m_ConfigControl->SSID );
+        LOG_INFO( LOG_WIFI, "WifiControl::connect: Connecting to %s", m_ConfigControl->SSID.c_str() );
         WiFi.begin( m_ConfigControl->SSID, m_ConfigControl->PWD );
-        int attempt = 0;
-        while( attempt < 10 ){
-            if( WiFi.status() == WL_CONNECTED ) break;
-            delay(500);
-            Serial.print(".");
-            attempt++;
+        m_Connecting = true;
+        m_ConnectStart = millis();
+    }
+
+    if( WiFi.status() != WL_CONNECTED ){
+        if( m_ConfigControl->FastBoot ){
+            // Fast boot polls the connection every time the wifi task runs so serial keeps being handled while connecting
+            if( millis() - m_ConnectStart < WIFI_CONNECT_TIMEOUT ) return ERROR_WIFI_CONNECTING;
+        } else {
+            while( millis() - m_ConnectStart < WIFI_CONNECT_TIMEOUT ){
+                if( WiFi.status() == WL_CONNECTED ) break;
+                Log.flush();
+                delay(500);
+            }
         }
-        Serial.println("");
-        if( attempt == 10 ) {
-            Serial.printf( "WifiControl::connect: Connecting to %s failed!\n", m_ConfigControl->SSID.c_str() );
+        if( WiFi.status() != WL_CONNECTED ) {
+            LOG_WARN( LOG_WIFI, "WifiControl::connect: Connecting to %s failed!", m_ConfigControl->SSID.c_str() );
+            m_Connecting = false;
             m_ConnectRetries++;
             return ERROR_WIFI_CONNECTION;
         }
-        Serial.println( "WifiControl::connect: Connected to wifi successfully!" );
+    }
+
+    if( m_Connecting ){
+        LOG_INFO( LOG_WIFI, "WifiControl::connect: Connected to wifi successfully!" );
+        m_Connecting = false;
     }
     m_ConnectRetries = 0;
     return SUCCESS;
@@ -103,22 +129,145 @@ uint16 WifiControl::updateTcpServer(){
         if( !m_TcpServer ) m_TcpServer = new WiFiServer( m_ConfigControl->PortTCP );
         m_TcpServer->begin();
         m_TcpServerStarted = true;
-        Serial.println( "WifiControl::updateTcpServer: TCP server started." );
+        LOG_INFO( LOG_WIFI, "WifiControl::updateTcpServer: TCP server started." );
     }
 
-    // Listen for incomming clients
-    if( ( m_TcpClients.size() < m_ConfigControl->MaxClients ) && m_TcpServer->hasClient() ) {
-        m_TcpClients.emplace_back( TcpClient( m_ConfigControl, m_TcpServer->accept() ) );
-    }
-    for( uint i = 0; i < m_TcpClients.size(); i++ ) {
-        if( m_TcpClients[i].handleCommand( m_NodeMCU ) == ERROR_CLIENT_DISCONNECTED ) {
+    // Listen for incomming clients, a waiting connection is always answered so it does not hang in the backlog
+    for( uint accepted = 0; accepted < TCP_ACCEPT_PER_LOOP && m_TcpServer->hasClient(); accepted++ ) admitTcpClient();
+
+    // Collect the received data and remove the closed connections
+    for( uint i = 0; i < m_TcpClients.size(); ) {
+        if( m_TcpClients[i].receive() == ERROR_CLIENT_DISCONNECTED ) {
             m_TcpClients.erase( m_TcpClients.begin() + i );
+        } else {
+            i++;
         }
-
     }
+    expireTcpClients();
+    m_Metrics->TcpClients = m_TcpClients.size();
+
+    scheduleTcpClients();
     return SUCCESS;
 }
 
+/**
+ * @brief Accept a waiting TCP connection, when the server is full the admission policy decides.
+ * With ADMISSION_EVICT the client that has been idle the longest makes room, if it has been idle for at least
+ * TCP_EVICT_IDLE and has no data waiting. Otherwise the connection is answered with ERROR_CLIENT_BUSY and closed.
+ */
+void WifiControl::admitTcpClient(){
+    WiFiClient connection = m_TcpServer->accept();
+    if( m_TcpClients.size() >= m_ConfigControl->MaxClients ) {
+        auto idle = m_TcpClients.end();
+        if( m_ConfigControl->Admission == ADMISSION_EVICT ) {
+            for( auto client = m_TcpClients.begin(); client != m_TcpClients.end(); client++ ){
+                if( client->queued() || client->idleTime() < TCP_EVICT_IDLE ) continue;
+                if( idle == m_TcpClients.end() || client->idleTime() > idle->idleTime() ) idle = client;
+            }
+        }
+        if( idle == m_TcpClients.end() ) {
+            MeteredPrint reply( connection, m_Metrics, PROTOCOL_TCP );
+            reply.printf( "=%04X\n", ERROR_CLIENT_BUSY );
+            connection.stop();
+            m_Metrics->TcpRejected++;
+            LOG_WARN( LOG_TCP, "WifiControl::admitTcpClient: Server is full, connection rejected." );
+            return;
+        }
+        LOG_INFO( LOG_TCP, "WifiControl::admitTcpClient: Evicting client %u, idle for %lu ms.", idle->Id, idle->idleTime() );
+        idle->stop( ERROR_CLIENT_EVICTED );
+        m_TcpClients.erase( idle );
+        m_Metrics->TcpEvicted++;
+    }
+    m_TcpClients.emplace_back( TcpClient( m_ConfigControl, m_Metrics, connection, m_NextClientId ) );
+    m_Timeouts.schedule( m_NextClientId++, m_ConfigControl->InActiveTimeout );
+    m_Metrics->TcpAccepted++;
+}
+
+/**
+ * @brief Close the TCP clients whose timeout expired.
+ * A timer can not be cancelled, so a timer of a closed client is ignored
+ * and a client that received data since its timer started gets a new timer for the rest of its timeout.
+ */
+void WifiControl::expireTcpClients(){
+    m_Expired.clear();
+    if( !m_Timeouts.expired( m_Expired ) ) return;
+
+    for( uint32 id: m_Expired ){
+        auto client = std::find_if( m_TcpClients.begin(), m_TcpClients.end(), [ id ]( const TcpClient &c ){ return c.Id == id; } );
+        if( client == m_TcpClients.end() ) continue;
+
+        // A waiting command is executed first, its reply would otherwise be lost
+        unsigned long idle = client->idleTime();
+        if( idle < m_ConfigControl->InActiveTimeout || client->pendingCommand() ) {
+            m_Timeouts.schedule( id, idle < m_ConfigControl->InActiveTimeout ? m_ConfigControl->InActiveTimeout - idle : 0 );
+            continue;
+        }
+        LOG_INFO( LOG_TCP, "WifiControl::expireTcpClients: Connection %u timed out and terminated.", id );
+        client->stop( SUCCESS );
+        m_TcpClients.erase( client );
+        m_Metrics->TcpTimeouts++;
+    }
+}
+
+/**
+ * @brief Execute the waiting commands of the TCP clients with deficit round robin.
+ * Every round a client with a complete command line gets TCP_QUANTUM bytes of credit and executes
+ * commands as long as its credit covers their size, so a client that floods gets the same share as
+ * a client that sends now and then. After TCP_LOOP_BUDGET bytes the rest waits for the next iteration,
+ * which starts with the next client. Clients over their rate limit are skipped.
+ */
+void WifiControl::scheduleTcpClients(){
+    size_t count = m_TcpClients.size();
+    if( !count ) return;
+
+    uint32 budget = TCP_LOOP_BUDGET;
+    bool served = true;
+    while( budget && served ){
+        served = false;
+        for( size_t n = 0; n < count && budget; n++ ){
+            TcpClient &client = m_TcpClients[( m_NextClient + n ) % count];
+            size_t size = client.pendingCommand();
+
+            // Credit is only saved up while commands are waiting
+            if( !size ) {
+                client.Deficit = 0;
+                continue;
+            }
+            if( !client.allowed() ) continue;
+
+            client.Deficit += TCP_QUANTUM;
+            served = true;
+            while( size && size <= client.Deficit && budget && client.allowed() ){
+                client.Deficit -= size;
+                budget -= std::min<uint32>( size, budget );
+                client.handleCommand( m_NodeMCU );
+                size = client.pendingCommand();
+            }
+        }
+    }
+    if( !budget ) {
+        for( TcpClient &client: m_TcpClients ){
+            if( client.pendingCommand() ) {
+                m_Metrics->TcpDeferred++;
+                break;
+            }
+        }
+    }
+    m_NextClient = ( m_NextClient + 1 ) % count;
+}
+
+/**
+ * @brief Print the connected TCP clients and their counters.
+ * 
+ * @param out the output to print to
+ */
+void WifiControl::printClients( Print &out ){
+    out.printf( "TCP clients: %u of %u, client rate: %u commands/s, client bandwidth: %u bytes/s\n",
+        static_cast<uint>( m_TcpClients.size() ), m_ConfigControl->MaxClients, m_ConfigControl->ClientRate, m_ConfigControl->ClientBandwidth );
+    for( TcpClient &client: m_TcpClients ) client.print( out );
+    if( m_HttpServer ) m_HttpServer->printConnections( out );
+}
+
 /**
  * @brief Handle incomming request of HTTP clients
  * and start the HTTP server if it has not been started already
@@ -127,67 +276,115 @@ uint16 WifiControl::updateTcpServer(){
  */
 uint16 WifiControl::updateHttpSerer(){
     if( !m_HttpServerStarted ){
-        if( !m_HttpServer ) m_HttpServer = new ESP8266WebServer( m_ConfigControl->PortHTTP );
+        if( !m_HttpServer ) m_HttpServer = new HttpServer( m_ConfigControl->PortHTTP, m_ConfigControl, m_Metrics );
 
-        m_HttpServer->on( "/", HTTP_GET, [ this ](){ handleFileRequest( "/index.html" ); });
+        m_HttpServer->on( "/", HTTP_METHOD_GET, [ this ](){ handleFileRequest( "/index.html" ); });
 
         m_HttpServer->onNotFound( [ this ]() { handleFileRequest (m_HttpServer->uri() ); });
 
-        m_HttpServer->on( "/configure/show", HTTP_GET, [ this ](){
-            m_HttpServer->send( 200, "text/plain", m_ConfigControl->readConfig() );
+        m_HttpServer->on( "/configure/show", HTTP_METHOD_GET, [ this ](){
+            ResponseWriter response( *m_HttpServer, "text/plain" );
+            m_ConfigControl->readConfig( response );
         });
 
-        m_HttpServer->on( "/configure", HTTP_POST, [ this ](){
+        m_HttpServer->on( "/configure", HTTP_METHOD_POST, [ this ](){
             std::vector<String> command = { "config" };
             if( m_HttpServer->hasArg( "arg1" ) ) command.push_back( m_HttpServer->arg( "arg1" ) );
             if( m_HttpServer->hasArg( "arg2" ) ) command.push_back( m_HttpServer->arg( "arg2" ) );
             if( m_HttpServer->hasArg( "arg3" ) ) command.push_back( m_HttpServer->arg( "arg3" ) );
             
-            m_HttpServer->send( 200, "text/plain", String( m_NodeMCU->execute_command( command ) ) );
+            NullPrint discard;
+            uint16 result = m_NodeMCU->execute_command( command, PROTOCOL_HTTP, discard );
+            ResponseWriter response( *m_HttpServer, "text/plain" );
+            response.print( result );
         });
 
-        m_HttpServer->on( "/read", HTTP_GET, [ this ](){
+        m_HttpServer->on( "/read", HTTP_METHOD_GET, [ this ](){
             if( m_HttpServer->hasArg( "pin" ) ) {
-                m_NodeMCU->execute_command( { "read", m_HttpServer->arg( "pin" ) } );
-                m_HttpServer->send( 200, "text/plain", String( m_ConfigControl->pinData[ parsePinCommand( m_HttpServer->arg( "pin" ) ) ].value ) );
+                // The reply is the pin data, the printed value is not needed
+                NullPrint discard;
+                PinId pin = parsePinCommand( m_HttpServer->arg( "pin" ) );
+                uint16 result = m_NodeMCU->execute_command( { "read", m_HttpServer->arg( "pin" ) }, PROTOCOL_HTTP, discard );
+                ResponseWriter response( *m_HttpServer, "text/plain" );
+                if( result == SUCCESS ) {
+                    response.print( m_ConfigControl->pinData[ pin ].value );
+                } else {
+                    response.setStatus( 400 );
+                    response.print( result );
+                }
+            } else {
+                sendResponse( 400, "text/plain", String( ERROR_READ ) );
             }
         });
 
-        m_HttpServer->on( "/read_all", HTTP_GET, [ this ](){
-            m_NodeMCU->execute_command( { "read",  "A0" } );
-            m_NodeMCU->execute_command( { "read",  "D0" } );
-            m_NodeMCU->execute_command( { "read",  "D1" } );
-            m_NodeMCU->execute_command( { "read",  "D3" } );
-            m_NodeMCU->execute_command( { "read",  "D4" } );
-            m_NodeMCU->execute_command( { "read",  "D5" } );
-            m_NodeMCU->execute_command( { "read",  "D6" } );
-            m_NodeMCU->execute_command( { "read",  "D7" } );
-            m_NodeMCU->execute_command( { "read",  "D8" } );
-            m_NodeMCU->execute_command( { "read",  "D9" } );
-            m_HttpServer->send( 200, "text/plain", String( m_ConfigControl->pinData[ PIN_ANA0 ].value )
-                    + "," + String( m_ConfigControl->pinData[ PIN_DIG0 ].value )
-                    + "," + String( m_ConfigControl->pinData[ PIN_DIG1 ].value )
-                    + "," + String( m_ConfigControl->pinData[ PIN_DIG2 ].value )
-                    + "," + String( m_ConfigControl->pinData[ PIN_DIG3 ].value )
-                    + "," + String( m_ConfigControl->pinData[ PIN_DIG4 ].value )
-                    + "," + String( m_ConfigControl->pinData[ PIN_DIG5 ].value )
-                    + "," + String( m_ConfigControl->pinData[ PIN_DIG6 ].value )
-                    + "," + String( m_ConfigControl->pinData[ PIN_DIG7 ].value )
-                    + "," + String( m_ConfigControl->pinData[ PIN_DIG8 ].value )
-                );
+        m_HttpServer->on( "/read_all", HTTP_METHOD_GET, [ this ](){
+            // The reply is built from the pin data, the printed values are not needed
+            static const PinId pins[] = { PIN_ANA0, PIN_DIG0, PIN_DIG1, PIN_DIG2, PIN_DIG3, PIN_DIG4, PIN_DIG5, PIN_DIG6, PIN_DIG7, PIN_DIG8 };
+            NullPrint discard;
+            ResponseWriter response( *m_HttpServer, "text/plain" );
+            for( PinId pin: pins ){
+                IO_PIN &data = m_ConfigControl->pinData[ pin ];
+                m_NodeMCU->execute_command( { "read", data.name }, PROTOCOL_HTTP, discard );
+                if( pin != PIN_ANA0 ) response.print( ',' );
+                response.print( data.value );
+            }
         });
         
-        m_HttpServer->on( "/write", HTTP_POST, [ this ](){
+        m_HttpServer->on( "/stats", HTTP_METHOD_GET, [ this ](){
+            std::vector<String> command = { "stats" };
+            if( m_HttpServer->hasArg( "reset" ) ) command.push_back( "reset" );
+            ResponseWriter response( *m_HttpServer, "text/plain" );
+            m_NodeMCU->execute_command( command, PROTOCOL_HTTP, response );
+        });
+
+        m_HttpServer->on( "/clients", HTTP_METHOD_GET, [ this ](){
+            ResponseWriter response( *m_HttpServer, "text/plain" );
+            m_NodeMCU->execute_command( { "clients" }, PROTOCOL_HTTP, response );
+        });
+
+        m_HttpServer->on( "/sensor", HTTP_METHOD_GET, [ this ](){
+            std::vector<String> command = { "sensor" };
+            if( m_HttpServer->hasArg( "id" ) ) command.push_back( m_HttpServer->arg( "id" ) );
+            ResponseWriter response( *m_HttpServer, "text/plain" );
+            uint16 result = m_NodeMCU->execute_command( command, PROTOCOL_HTTP, response );
+            if( result != SUCCESS ) {
+                response.setStatus( 400 );
+                response.print( result );
+            }
+        });
+
+        m_HttpServer->on( "/metrics", HTTP_METHOD_GET, [ this ](){
+            ResponseWriter response( *m_HttpServer, "text/plain; version=0.0.4" );
+            m_Metrics->printPrometheus( response );
+        });
+
+        m_HttpServer->on( "/write", HTTP_METHOD_POST, [ this ](){
+            NullPrint discard;
+            uint16 result = ERROR_WRITE;
             if( m_HttpServer->hasArg( "pin" ) && m_HttpServer->hasArg( "value" ) ){
-                m_NodeMCU->execute_command( { "write", m_HttpServer->arg( "pin" ), m_HttpServer->arg( "value" ) } );
-                m_HttpServer->send( 200, "text/plain", "OK" );
+                result = m_NodeMCU->execute_command( { "write", m_HttpServer->arg( "pin" ), m_HttpServer->arg( "value" ) }, PROTOCOL_HTTP, discard );
+            } else {
+                // PIN=VALUE arguments are written at once, all of them or none
+                std::vector<String> command = { "write" };
+                for( int i = 0; i < m_HttpServer->args(); i++ ){
+                    if( parsePinCommand( m_HttpServer->argName( i ) ) == PIN_ERROR ) continue;
+                    command.push_back( m_HttpServer->argName( i ) + "=" + m_HttpServer->arg( i ) );
+                }
+                if( command.size() > 1 ) result = m_NodeMCU->execute_command( command, PROTOCOL_HTTP, discard );
+            }
+            ResponseWriter response( *m_HttpServer, "text/plain" );
+            if( result == SUCCESS ) {
+                response.print( "OK" );
+            } else {
+                response.setStatus( 400 );
+                response.print( result );
             }
         });
 
         // Start the HTTP server
         m_HttpServer->begin();
         m_HttpServerStarted = true;
-        Serial.println( "WifiControl::updateHttpSerer: HTTP server started." );
+        LOG_INFO( LOG_WIFI, "WifiControl::updateHttpSerer: HTTP server started." );
     }
 
     // Handle a client request
@@ -195,6 +392,25 @@ uint16 WifiControl::updateHttpSerer(){
     return SUCCESS;
 }
 
+/**
+ * @brief Handle incomming UDP datagrams
+ * and start or stop the UDP server when the UDP port or the multicast group has changed
+ * 
+ * @return uint16 result code
+ */
+uint16 WifiControl::updateUdpServer(){
+    if( m_UdpServerChanged ){
+        m_UdpServerChanged = false;
+        if( !m_ConfigControl->PortUDP ) {
+            m_UdpServer.stop();
+            return SUCCESS;
+        }
+        uint16 result = m_UdpServer.begin();
+        if( result != SUCCESS ) return result;
+    }
+    return m_UdpServer.update();
+}
+
 /**
  * @brief Configure the server settings.
  * 
@@ -206,65 +422,117 @@ uint16 WifiControl::configure( const ConfigCommand &command, const String &value
     switch ( command ){
     case CONFIG_SSID:
         m_ConfigControl->SSID = value;
-        Serial.printf( "WifiControl::configure: Changed SSID to: %s\n", value.c_str() );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed SSID to: %s", value.c_str() );
         break;
     case CONFIG_PWD:
         m_ConfigControl->PWD = value; 
-        Serial.printf( "WifiControl::configure: Changed wifi password to: %s\n", value.c_str() );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed wifi password to: %s", value.c_str() );
         break;
     case CONFIG_IP:
         if( !IPAddress::isValid( value.c_str() ) ) return ERROR_CONFIG_IP;
         m_ConfigControl->StaticIP.fromString( value );
-        Serial.printf( "WifiControl::configure: Changed StaticIP to: %s\n", value.c_str() );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed StaticIP to: %s", value.c_str() );
         break;
     case CONFIG_SUBNET:
         if( !IPAddress::isValid( value.c_str() ) ) return ERROR_CONFIG_SUBNET;
         m_ConfigControl->Subnet.fromString( value );
-        Serial.printf( "WifiControl::configure: Changed Subnet to: %s\n", value.c_str() );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed Subnet to: %s", value.c_str() );
         break;
     case CONFIG_GATEWAY:
         if( !IPAddress::isValid( value.c_str() ) ) return ERROR_CONFIG_GATEWAY;
         m_ConfigControl->Gateway.fromString( value );
-        Serial.printf( "WifiControl::configure: Changed Gateway to: %s\n", value.c_str() );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed Gateway to: %s", value.c_str() );
         break;
     case CONFIG_PORT_TCP:
         if( value.toInt() < 1 ) return ERROR_CONFIG_PORT_TCP;
         m_ConfigControl->PortTCP = value.toInt();
-        Serial.printf( "WifiControl::configure: Changed TCP Port to: \n%d", m_ConfigControl->PortTCP );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed TCP Port to: %d", m_ConfigControl->PortTCP );
         break;
     case CONFIG_PORT_HTTP:
         if( value.toInt() < 1 ) return ERROR_CONFIG_PORT_HTTP;
         m_ConfigControl->PortHTTP = value.toInt();
-        Serial.printf( "WifiControl::configure: Changed HTTP Port to: \n%d", m_ConfigControl->PortHTTP );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed HTTP Port to: %d", m_ConfigControl->PortHTTP );
+        break;
+    case CONFIG_PORT_UDP:
+        if( value.toInt() < 0 || ( value.toInt() == 0 && value != "0" ) ) return ERROR_CONFIG_PORT_UDP;
+        m_ConfigControl->PortUDP = value.toInt();
+        m_UdpServerChanged = true;
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed UDP Port to: %d", m_ConfigControl->PortUDP );
+        break;
+    case CONFIG_MULTICAST:
+        if( value == "off" ) {
+            m_ConfigControl->MulticastGroup = IPAddress();
+        } else {
+            IPAddress group;
+            if( !group.fromString( value ) || group[0] < 224 || group[0] > 239 ) return ERROR_CONFIG_MULTICAST;
+            m_ConfigControl->MulticastGroup = group;
+        }
+        m_UdpServerChanged = true;
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed multicast group to: %s", value.c_str() );
+        break;
+    case CONFIG_CLIENT_RATE:
+        if( value.toInt() < 0 || ( value.toInt() == 0 && value != "0" ) ) return ERROR_CONFIG_CLIENT_RATE;
+        m_ConfigControl->ClientRate = value.toInt();
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed ClientRate to: %u", m_ConfigControl->ClientRate );
+        break;
+    case CONFIG_CLIENT_BANDWIDTH:
+        if( value.toInt() < 0 || ( value.toInt() == 0 && value != "0" ) ) return ERROR_CONFIG_CLIENT_BANDWIDTH;
+        m_ConfigControl->ClientBandwidth = value.toInt();
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed ClientBandwidth to: %u", m_ConfigControl->ClientBandwidth );
+        break;
+    case CONFIG_ADMISSION:
+        if( value.equalsIgnoreCase( "reject" ) ) m_ConfigControl->Admission = ADMISSION_REJECT;
+        else if( value.equalsIgnoreCase( "evict" ) ) m_ConfigControl->Admission = ADMISSION_EVICT;
+        else return ERROR_CONFIG_ADMISSION;
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed admission policy to: %s", value.c_str() );
+        break;
+    case CONFIG_HTTP_KEEP_ALIVE:
+        if( value.toInt() < 0 || ( value.toInt() == 0 && value != "0" ) ) return ERROR_CONFIG_HTTP_KEEP_ALIVE;
+        m_ConfigControl->HttpKeepAlive = value.toInt();
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed HttpKeepAlive to: %u", m_ConfigControl->HttpKeepAlive );
+        break;
+    case CONFIG_HTTP_MAX_REQUESTS:
+        if( value.toInt() < 0 || ( value.toInt() == 0 && value != "0" ) ) return ERROR_CONFIG_HTTP_MAX_REQUESTS;
+        m_ConfigControl->HttpMaxRequests = value.toInt();
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed HttpMaxRequests to: %u", m_ConfigControl->HttpMaxRequests );
         break;
     case CONFIG_DNS1:
         if( !IPAddress::isValid( value.c_str() ) ) return ERROR_CONFIG_DNS1;
         m_ConfigControl->DnsPrimary.fromString( value );
-        Serial.printf( "WifiControl::configure: Changed DnsPrimary to: %s\n", value.c_str() );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed DnsPrimary to: %s", value.c_str() );
         break;
     case CONFIG_DNS2:
         if( !IPAddress::isValid( value.c_str() ) ) return ERROR_CONFIG_DNS2;
         m_ConfigControl->DnsSecundary.fromString( value );
-        Serial.printf( "WifiControl::configure: Changed DnsSecundary to: %s\n", value.c_str() );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed DnsSecundary to: %s", value.c_str() );
         break;
     case CONFIG_MAX_CLIENTS:
         if( value.toInt() < 1 ) return ERROR_CONFIG_PORT_TCP;
         m_ConfigControl->MaxClients = value.toInt();
-        Serial.printf( "WifiControl::configure: Changed MaxClients to: \n%d", m_ConfigControl->MaxClients );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed MaxClients to: %d", m_ConfigControl->MaxClients );
         break;
     case CONFIG_INACTIVE_TIMEOUT:
         if( value.toInt() < 1 ) return ERROR_CONFIG_PORT_TCP;
         m_ConfigControl->InActiveTimeout = value.toInt();
-        Serial.printf( "WifiControl::configure: Changed InActiveTimeout to: \n%d", m_ConfigControl->InActiveTimeout );
+        LOG_INFO( LOG_WIFI, "WifiControl::configure: Changed InActiveTimeout to: %d", m_ConfigControl->InActiveTimeout );
         break;
     case CONFIG_SHOW:
     case CONFIG_PIN:
+    case CONFIG_SAVE_DELAY:
+    case CONFIG_FAST_BOOT:
+    case CONFIG_EXPANDER:
+    case CONFIG_EXPANDER_POLL:
+    case CONFIG_SENSOR:
+    case CONFIG_BRIDGE:
+    case CONFIG_BRIDGE_FLUSH:
+    case CONFIG_BRIDGE_STALL:
+    case CONFIG_PIXELS:
     case CONFIG_ERROR:
         // not possible
         return ERROR_CONFIG;
         break;
     }
-    m_ConfigControl->updated = true;
+    m_ConfigControl->markUpdated();
     return SUCCESS;
 }
 
@@ -279,12 +547,25 @@ void WifiControl::handleFileRequest( String path ) {
     else if (path.endsWith(".woff2")) contentType = "font/woff2";
     
     if (!LittleFS.exists(path)) {
-        Serial.println( "WifiControl::handleFileRequest: Could not find file: "+path );
-        m_HttpServer->send(404, "text/plain", "Could not find file: "+path);
+        LOG_WARN( LOG_WIFI, "WifiControl::handleFileRequest: Could not find file: %s", path.c_str() );
+        sendResponse(404, "text/plain", "Could not find file: "+path);
         return;
     }
 
     File file = LittleFS.open(path, "r");
-    m_HttpServer->streamFile(file, contentType);
+    m_HttpServer->streamFile( file, contentType.c_str() );
     file.close();
+}
+
+/**
+ * @brief Send the response to the current HTTP request.
+ * 
+ * @param code the HTTP status code
+ * @param contentType the content type of the response
+ * @param content the response body
+ */
+void WifiControl::sendResponse( int code, const char *contentType, const String &content ){
+    ResponseWriter response( *m_HttpServer, contentType );
+    response.setStatus( code );
+    response.print( content );
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+/**
+ * @file test_scheduler.cpp
+ * @author Ammon Ayisi-Mensah (ammon.mensah@gmail.com)
+ * @version 1.0.0
+ * @date 2026-10-19
+ * 
+ * @copyright
+ * MIT License
+ * Copyright (c) 2025 Ammon Ayisi-Mensah
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <unity.h>
+#include "hal.h"
+#include "scheduler.h"
+
+/**
+ * @brief A board with a manual clock, the tasks advance it by the time they take.
+ */
+static hal::Board board;
+
+void setUp(){
+    board.ManualClock = true;
+    hal::select( &board );
+}
+
+void tearDown(){
+    hal::select( nullptr );
+}
+
+/**
+ * @brief Run loop iterations of a scheduler, the clock moves 1 ms between them so the periods pass.
+ */
+static void runLoops( Scheduler &scheduler, uint count ){
+    for( uint i = 0; i < count; i++ ){
+        scheduler.run();
+        hal::advance( 1000 );
+    }
+}
+
+/**
+ * @brief A task longer than the slice runs in every iteration of an otherwise idle loop, it never fits the slice
+ * so waiting would only delay it.
+ */
+static void test_long_task_on_idle_loop(){
+    ConfigControl configControl;
+    Metrics metrics( &configControl );
+    LoopStats loopStats;
+    Scheduler scheduler( &loopStats, &metrics );
+    uint runs = 0;
+    scheduler.add( STAGE_PIXELS, PRIORITY_NORMAL, 0, 10000, [ & ]() -> uint16 {
+        hal::advance( SCHEDULER_SLICE_US + 1000 );
+        runs++;
+        return SUCCESS;
+    } );
+
+    runLoops( scheduler, 20 );
+    TEST_ASSERT_EQUAL_UINT( 20, runs );
+}
+
+/**
+ * @brief A task longer than the slice waits while an urgent task already used the iteration,
+ * until it has been deferred SCHEDULER_MAX_DEFER times.
+ */
+static void test_long_task_after_busy_task(){
+    ConfigControl configControl;
+    Metrics metrics( &configControl );
+    LoopStats loopStats;
+    Scheduler scheduler( &loopStats, &metrics );
+    uint runs = 0;
+    scheduler.add( STAGE_SERIAL, PRIORITY_URGENT, 0, 10000, []() -> uint16 {
+        hal::advance( SCHEDULER_IDLE_US * 2 );
+        return SUCCESS;
+    } );
+    scheduler.add( STAGE_PIXELS, PRIORITY_NORMAL, 0, 10000, [ & ]() -> uint16 {
+        hal::advance( SCHEDULER_SLICE_US * 4 );
+        runs++;
+        return SUCCESS;
+    } );
+
+    // The first run has no estimate yet, then every run follows SCHEDULER_MAX_DEFER deferrals
+    runLoops( scheduler, 1 + 2 * ( SCHEDULER_MAX_DEFER + 1 ) );
+    TEST_ASSERT_EQUAL_UINT( 3, runs );
+}
+
+/**
+ * @brief A task that fits an empty slice but not the rest of this one waits for the next iteration.
+ */
+static void test_short_task_waits_for_next_slice(){
+    ConfigControl configControl;
+    Metrics metrics( &configControl );
+    LoopStats loopStats;
+    Scheduler scheduler( &loopStats, &metrics );
+    uint urgent = 0, runs = 0;
+    scheduler.add( STAGE_SERIAL, PRIORITY_URGENT, 0, 10000, [ & ]() -> uint16 {
+        // Only every other iteration is busy
+        if( urgent++ % 2 ) hal::advance( SCHEDULER_SLICE_US - 100 );
+        return SUCCESS;
+    } );
+    scheduler.add( STAGE_SENSOR, PRIORITY_NORMAL, 0, 10000, [ & ]() -> uint16 {
+        hal::advance( SCHEDULER_SLICE_US / 2 );
+        runs++;
+        return SUCCESS;
+    } );
+
+    runLoops( scheduler, 20 );
+    TEST_ASSERT_EQUAL_UINT( 10, runs );
+}
+
+int main( int argc, char **argv ){
+    UNITY_BEGIN();
+    RUN_TEST( test_long_task_on_idle_loop );
+    RUN_TEST( test_long_task_after_busy_task );
+    RUN_TEST( test_short_task_waits_for_next_slice );
+    return UNITY_END();
+}